@@ -0,0 +1,29 @@
+## Copyright (C) 2026 The Octave Forge communications package developers
+##
+## This program is free software; you can redistribute it and/or modify it under
+## the terms of the GNU General Public License as published by the Free Software
+## Foundation; either version 3 of the License, or (at your option) any later
+## version.
+##
+## This program is distributed in the hope that it will be useful, but WITHOUT
+## ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+## FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+## details.
+##
+## You should have received a copy of the GNU General Public License along with
+## this program; if not, see <http://www.gnu.org/licenses/>.
+
+## -*- texinfo -*-
+## @deftypefn  {Loadable Function} {@var{r} =} rref (@var{a})
+## @deftypefnx {Loadable Function} {[@var{r}, @var{k}] =} rref (@var{a})
+## Reduce the Galois array @var{a} to its reduced row echelon form @var{r},
+## with the columns of the pivots in @var{k}. Sparse Galois arrays are
+## reduced in sparse form.
+## @end deftypefn
+
+function varargout = rref (varargin)
+
+  varargout = cell (1, max (1, nargout));
+  [varargout{:}] = grref (varargin{:});
+
+endfunction
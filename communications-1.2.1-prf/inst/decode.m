@@ -44,14 +44,16 @@
 ## A linear block code is assumed with the message @var{msg} being in a
 ## binary format. In this case the argument @var{opt1} is the generator
 ## matrix, and is required. Additionally, @var{opt2} containing the
-## syndrome lookup table (see @code{syndtable}) can also be passed.
+## syndrome lookup table (see @code{syndtable}) can also be passed, in any
+## of the formats that @code{syndtable} returns.
 ## @item  "cyclic"
 ## @itemx "cyclic/binary"
 ## A cyclic code is assumed with the message @var{msg} being in a binary
 ## format. The generator polynomial to use can be defined in @var{opt1}.
 ## The default generator polynomial to use will be
 ## @code{cyclpoly (@var{n}, @var{k})}. Additionally, @var{opt2} containing the
-## syndrome lookup table (see @code{syndtable}) can also be passed.
+## syndrome lookup table (see @code{syndtable}) can also be passed, in any
+## of the formats that @code{syndtable} returns.
 ## @item  "hamming"
 ## @itemx "hamming/binary"
 ## A Hamming code is assumed with the message @var{msg} being in a binary
@@ -102,9 +104,11 @@
 ## recalculate this matrix at each iteration. In this case @var{typ} should
 ## be "linear". The exception to this case is BCH codes, where the required
 ## syndrome table is too large. The BCH decoder, decodes directly from the
-## polynomial never explicitly forming the syndrome table.
+## polynomial never explicitly forming the syndrome table. For the other
+## codes, the generator matrix can also be prepared once with @code{blkcode}
+## and the codewords decoded with @code{blkdecode}.
 ##
-## @seealso{encode, cyclgen, cyclpoly, hammgen, bchdeco, bchpoly, syndtable}
+## @seealso{encode, cyclgen, cyclpoly, hammgen, bchdeco, bchpoly, syndtable, syndecode, blkcode}
 ## @end deftypefn
 
 function [msg, err, ccode, cerr] = decode (code, n, k, typ, opt1, opt2)
@@ -203,17 +207,20 @@ function [msg, err, ccode, cerr] = decode (code, n, k, typ, opt1, opt2)
     endif
     cerr = err;
   else
+    ## Without a syndrome table the generator and parity check matrices
+    ## are bit-packed once by blkcode, and the codewords decoded natively
+    blk = [];
     if (strcmp (coding, "linear"))
       if (nargin > 4)
         gen = opt1;
         if ((size (gen, 1) != k) || (size (gen, 2) != n))
           error ("decode: generator matrix must be of size KxN");
         endif
-        par = gen2par (gen);
         if (nargin > 5)
+          par = gen2par (gen);
           st = opt2;
         else
-          st = syndtable (par);
+          blk = blkcode (gen);
         endif
       else
         error ("decode: linear coding requires a generator matrix");
@@ -230,7 +237,7 @@ function [msg, err, ccode, cerr] = decode (code, n, k, typ, opt1, opt2)
         ## this case???
         st = opt2;
       else
-        st = syndtable (par);
+        blk = blkcode (gen, par);
       endif
     else
       m = log2 (n + 1);
@@ -247,22 +254,30 @@ function [msg, err, ccode, cerr] = decode (code, n, k, typ, opt1, opt2)
       endif
       if (nargin > 5)
         error ("decode: too many arguments for Hamming decoder");
-      else
-        st = syndtable (par);
+      elseif (ncodewords < 64)
+        blk = blkcode (gen, par);
       endif
     endif
 
-    errvec = st(bi2de ((mod (par * code', 2))', "left-msb") + 1,:);
-    ccode = mod (code+errvec, 2);
-    err = sum (errvec');
-    cerr = err;
-    if (isequal (gen(:,1:k), eye (k)))
-      msg = ccode(:,1:k);
-    elseif (isequal (gen(:,n-k+1:n), eye (k)))
-      msg = ccode(:,n-k+1:n);
+    if (! isempty (blk))
+      [msg, err, ccode] = blkdecode (blk, code);
     else
-      error ("decode: generator matrix must be in standard form");
+      if (strcmp (coding, "hamming"))
+        ## Large batches are decoded bit-sliced
+        [ccode, err] = __hammdeco__ (par, code);
+      else
+        [ccode, err] = syndecode (code, par, st);
+      endif
+      if (isequal (gen(:,1:k), eye (k)))
+        msg = ccode(:,1:k);
+      elseif (isequal (gen(:,n-k+1:n), eye (k)))
+        msg = ccode(:,n-k+1:n);
+      else
+        error ("decode: generator matrix must be in standard form");
+      endif
     endif
+    err = err';
+    cerr = err;
   endif
 
   if (strcmp (msgtyp, "binary") && vecttyp == 1)
@@ -293,3 +308,28 @@ endfunction
 %!error decode (1, 2, 3)
 %!error decode (1, 5, 6)
 %!error decode (1, 5, 3, "invalid")
+
+%!test
+%! ## Large batches of Hamming codewords are decoded bit-sliced
+%! msg = randi ([0 1], 300, 11);
+%! code = encode (msg, 15, 11, "hamming");
+%! code(:, 3) = ! code(:, 3);
+%! [dec, err] = decode (code, 15, 11, "hamming");
+%! assert (dec, msg)
+%! assert (err, ones (300, 1))
+%! [dec, err] = decode (code(1:10, :), 15, 11, "hamming");
+%! assert (dec, msg(1:10, :))
+%! assert (err, ones (10, 1))
+
+%!test
+%! ## Linear and cyclic codes give the same results with a syndrome table
+%! [par, gen] = cyclgen (15, cyclpoly (15, 5));
+%! msg = randi ([0 1], 20, 5);
+%! code = mod (encode (msg, 15, 5, "linear", gen) + randerr (20, 15, 2), 2);
+%! [dec1, err1, ccode1, cerr1] = decode (code, 15, 5, "linear", gen);
+%! [dec2, err2, ccode2, cerr2] = decode (code, 15, 5, "linear", gen, syndtable (par));
+%! assert (dec1, dec2)
+%! assert (err1, err2)
+%! assert (ccode1, ccode2)
+%! assert (cerr1, cerr2)
+%! assert (decode (code, 15, 5, "cyclic", cyclpoly (15, 5)), dec1)
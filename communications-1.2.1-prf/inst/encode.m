@@ -86,8 +86,9 @@
 ## recalculate this matrix at each iteration. In this case @var{typ} should
 ## be "linear". The exception to this case is BCH codes, whose encoder
 ## is implemented directly from the polynomial and is significantly faster.
+## The linear, cyclic and Hamming codes are encoded with @code{blkencode}.
 ##
-## @seealso{decode, cyclgen, cyclpoly, hammgen, bchenco, bchpoly}
+## @seealso{decode, cyclgen, cyclpoly, hammgen, bchenco, bchpoly, blkencode}
 ## @end deftypefn
 
 function [code, added] = encode (msg, n, k, typ, opt)
@@ -204,7 +205,7 @@ function [code, added] = encode (msg, n, k, typ, opt)
         [par, gen] = hammgen (m);
       endif
     endif
-    code = mod (msg * gen, 2);
+    code = blkencode (gen, msg);
   endif
 
   if (strcmp (msgtyp, "binary") && vecttyp == 1)
@@ -18,6 +18,7 @@
 ## @deftypefnx {Function File} {@var{w} =} gfweight (@var{gen}, "gen")
 ## @deftypefnx {Function File} {@var{w} =} gfweight (@var{par}, "par")
 ## @deftypefnx {Function File} {@var{w} =} gfweight (@var{p}, n)
+## @deftypefnx {Function File} {[@var{w}, @var{a}] =} gfweight (@dots{})
 ##
 ## Calculate the minimum weight or distance of a linear block code. The
 ## code can be either defined by its generator or parity check matrix, or
@@ -30,10 +31,16 @@
 ## generator polynomial of the code. In this case a second argument is
 ## required that defines the codeword length.
 ##
+## If requested, the weight distribution of the code is returned in the
+## row vector @var{a}, whose element @var{a}(@var{i}+1) is the number of
+## codewords of weight @var{i}. The codewords of the code, or those of
+## its dual code if there are fewer, are counted, and the distribution of
+## the dual code is converted with the MacWilliams identity.
+##
 ## @seealso{hammgen, cyclpoly, bchpoly}
 ## @end deftypefn
 
-function w = gfweight (arg1, arg2)
+function [w, a] = gfweight (arg1, arg2)
 
   if (nargin < 1 || nargin > 2)
     print_usage ();
@@ -72,12 +79,26 @@ function w = gfweight (arg1, arg2)
   ## We only need to test codewords 1:2^k-1 against the zero code word
   ## We do the equivalent of
   ## w = min (sum ((mod (de2bi ([1:2^k-1]') * gen, 2))'));
-  ## But in a more memory efficient manner in an oct-file
+  ## But in an oct-file that stops well before 2^k-1 codewords with the
+  ## algorithm of Brouwer and Zimmermann
   w = __gfweight__ (gen);
 
+  if (nargout > 1)
+    a = __gfwtdist__ (gen);
+  endif
+
 endfunction
 
 %% Test input validation
 %!error gfweight ()
 %!error gfweight (1, 2, 3)
 %!error gfweight ([1 2 3])
+
+%!assert (gfweight (hammgen (4), "par"), 3)
+%!assert (gfweight (egolaygen ()), 8)
+%!assert (gfweight ([1 1 0 1], 7), 3)
+
+%!test
+%! [w, a] = gfweight (hammgen (3), "par");
+%! assert (w, 3)
+%! assert (a, [1 0 0 7 7 0 0 1])
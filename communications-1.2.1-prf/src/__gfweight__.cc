@@ -18,44 +18,437 @@
 // program with any Open Source program, as defined by the Open Source
 // Initiative (www.opensource.org)
 
+#include <cmath>
+#include <vector>
+
 #include <octave/oct.h>
 
+#include "bitpack.h"
+#include "parallel.h"
+
+// PKG_ADD: autoload ("__gfwtdist__", "__gfweight__.oct");
+// PKG_DEL: autoload ("__gfwtdist__", "__gfweight__.oct", "remove");
+
+// Below this number of combinations per round, threads cost more than
+// they save
+#define __OCTAVE_GFWEIGHT_MIN_PARALLEL  (1 << 14)
+
+// A generator matrix row reduced to the identity on rank of the columns
+// not used by the previous information sets, the other rows being zero
+// on these columns
+struct gfweight_infoset
+{
+  std::vector<bitpack_word> rows;
+  int rank;
+};
+
+// Row reduce the k packed rows g of length n to the identity on as many
+// as possible of the columns not yet used, taken in order, and mark them
+// as used. The pivot column of row i is returned in piv[i]. Returns the
+// number of pivots r, the rows from r on being zero on the unused columns
 static int
-get_weight (const Array<char>& codeword, const Matrix& gen,
-            int weight, int depth, int start, int n, int k)
+gfweight_reduce (std::vector<bitpack_word>& g, int k, int n,
+                 std::vector<bool>& used, std::vector<int>& piv)
 {
-  int retval = weight;
+  int nw = BITPACK_WORDS (n);
+  int r = 0;
 
-  for (int i = start; i < k ; i++)
+  piv.resize (k);
+  for (int c = 0; (c < n) && (r < k); c++)
     {
-      OCTAVE_QUIT;
+      if (used[c])
+        continue;
+
+      int p = r;
+      while ((p < k) && ! bitpack_get (&g[p*nw], c))
+        p++;
+      if (p == k)
+        continue;
+
+      if (p != r)
+        for (int i = 0; i < nw; i++)
+          std::swap (g[p*nw+i], g[r*nw+i]);
+      for (int q = 0; q < k; q++)
+        if ((q != r) && bitpack_get (&g[q*nw], c))
+          bitpack_xor (&g[q*nw], &g[r*nw], nw);
 
-      Array<char> new_codeword (codeword);
-      int tmp = 0;
-      for (int j = 0; j < n; j++)
-        if (new_codeword (j) ^= (char)gen(i,j))
-          tmp++;
-      if (tmp < retval)
-        retval = tmp;
-      if (depth < retval)
-        retval = get_weight (new_codeword, gen, retval, depth+1, i+1, n, k);
-    }
-  return retval;
+      used[c] = true;
+      piv[r++] = c;
+    }
+
+  return r;
+}
+
+// Find disjoint information sets of the k packed rows g of length n.
+// Returns false if the rows are linearly dependent
+static bool
+gfweight_infosets (std::vector<gfweight_infoset>& sets,
+                   const std::vector<bitpack_word>& g, int k, int n)
+{
+  std::vector<bitpack_word> cur (g);
+  std::vector<bool> used (n, false);
+  std::vector<int> piv;
+
+  while (true)
+    {
+      int r = gfweight_reduce (cur, k, n, used, piv);
+
+      if (sets.empty () && (r < k))
+        return false;
+      if (r == 0)
+        break;
+
+      gfweight_infoset set;
+      set.rows = cur;
+      set.rank = r;
+      sets.push_back (set);
+    }
+
+  return true;
+}
+
+// The least weight of the sums of w of the k packed rows g whose first
+// row is i0, or best if none is lighter. The other rows are walked in
+// lexicographic order, part[d] being the sum of the rows pos[0..d], so
+// that each sum costs one exclusive or and popcount per word. Stops as
+// soon as a weight of at most stop is found
+static int
+gfweight_min_sum (const bitpack_word *g, int k, int nw, int w, int i0,
+                  int best, int stop)
+{
+  std::vector<bitpack_word> part (w * nw);
+  std::vector<int> pos (w);
+
+  const bitpack_word *row = g + i0 * nw;
+  if (w == 1)
+    {
+      int wt = bitpack_weight (row, nw);
+      return (wt < best ? wt : best);
+    }
+
+  pos[0] = i0;
+  for (int i = 0; i < nw; i++)
+    part[i] = row[i];
+  for (int d = 1; d < w - 1; d++)
+    {
+      pos[d] = pos[d-1] + 1;
+      for (int i = 0; i < nw; i++)
+        part[d*nw+i] = part[(d-1)*nw+i] ^ g[pos[d]*nw+i];
+    }
+
+  while (true)
+    {
+      const bitpack_word *p = &part[(w-2)*nw];
+      for (int j = pos[w-2] + 1; j < k; j++)
+        {
+          const bitpack_word *q = g + j * nw;
+          int wt = 0;
+          for (int i = 0; i < nw; i++)
+            wt += bitpack_popcount (p[i] ^ q[i]);
+          if (wt < best)
+            {
+              best = wt;
+              if (best <= stop)
+                return best;
+            }
+        }
+
+      int d = w - 2;
+      while ((d >= 1) && (pos[d] == k - w + d))
+        d--;
+      if (d < 1)
+        break;
+
+      pos[d]++;
+      for (int e = d; e < w - 1; e++)
+        {
+          if (e > d)
+            pos[e] = pos[e-1] + 1;
+          for (int i = 0; i < nw; i++)
+            part[e*nw+i] = part[(e-1)*nw+i] ^ g[pos[e]*nw+i];
+        }
+    }
+
+  return best;
+}
+
+static double
+binomial (int n, int k)
+{
+  double r = 1.;
+  for (int i = 1; i <= k; i++)
+    r = r * (n - k + i) / i;
+  return r;
+}
+
+// Minimum distance by the algorithm of Brouwer and Zimmermann. At round
+// w, the sums of w rows of each information set are enumerated. A
+// codeword not yet found then has more than w message bits set in every
+// information set, and so a weight of at least w+1-(k-rank) on the
+// columns of each. The search stops when this lower bound meets the
+// least weight found
+static int
+gfweight_bz (const Matrix& gen, int nthreads)
+{
+  int k = gen.rows ();
+  int n = gen.columns ();
+  int nw = BITPACK_WORDS (n);
+
+  std::vector<bitpack_word> g (k * nw);
+  for (int i = 0; i < k; i++)
+    bitpack_row (&g[i*nw], gen, i, n);
+
+  std::vector<gfweight_infoset> sets;
+  if (! gfweight_infosets (sets, g, k, n))
+    return 0;
+
+  int nsets = sets.size ();
+  int ub = n - k + 1;
+  int lb = 0;
+  for (int j = 0; j < nsets; j++)
+    lb += (sets[j].rank == k ? 1 : 0);
+
+  for (int w = 1; (w <= k) && (lb < ub); w++)
+    {
+      int nt = (binomial (k, w) < __OCTAVE_GFWEIGHT_MIN_PARALLEL ? 1 : nthreads);
+
+      for (int j = 0; (j < nsets) && (lb < ub); j++)
+        {
+          const bitpack_word *rows = &sets[j].rows[0];
+          parallel_int best (ub);
+          int stop = lb;
+
+          parallel_for (k - w + 1, nt,
+            [&] (int i0)
+            {
+              int b = best;
+              if (b > stop)
+                parallel_min (best, gfweight_min_sum (rows, k, nw, w, i0,
+                                                      b, stop));
+            });
+          ub = best;
+
+          // The sets up to j are now complete for w, the others for w-1
+          lb = 0;
+          for (int i = 0; i < nsets; i++)
+            {
+              int c = (i <= j ? w + 1 : w) - (k - sets[i].rank);
+              if (c > 0)
+                lb += c;
+            }
+        }
+    }
+
+  return ub;
 }
 
 DEFUN_DLD (__gfweight__, args, ,
   "-*- texinfo -*-\n\
-@deftypefn {Loadable Function} {@var{w} =} __gfweight__ (@var{gen})\n\
+@deftypefn  {Loadable Function} {@var{w} =} __gfweight__ (@var{gen})\n\
+@deftypefnx {Loadable Function} {@var{w} =} __gfweight__ (@var{gen}, @var{nthreads})\n\
 Returns the minimum distance @var{w} of the generator matrix @var{gen}.\n\
-The codeword length is @var{k}.\n\
+The codewords are enumerated over several information sets with the\n\
+algorithm of Brouwer and Zimmermann, on up to @var{nthreads} threads.\n\
+By default all the available processors are used.\n\
+\n\
+This is an internal function of @code{gfweight}. You should use\n\
+@code{gfweight} rather than use this function directly.\n\
+@seealso{gfweight}\n\
+@end deftypefn")
+{
+  int nargin = args.length ();
+
+  if (nargin < 1 || nargin > 2)
+    {
+      print_usage ();
+      return octave_value ();
+    }
+
+  Matrix gen = args(0).matrix_value ();
+  int nthreads = parallel_threads ();
+
+  if (nargin > 1)
+    {
+      nthreads = args(1).int_value ();
+      if (nthreads < 1)
+        {
+          error ("__gfweight__: NTHREADS must be a positive integer");
+          return octave_value ();
+        }
+    }
+
+  return octave_value ((double)gfweight_bz (gen, nthreads));
+}
+
+/*
+%% Test input validation
+%!error __gfweight__ ()
+%!error __gfweight__ (1, 2, 3)
+%!error <NTHREADS> __gfweight__ (1, 0)
+
+%!test
+%! [par, gen] = hammgen (3);
+%! assert (__gfweight__ (gen), 3)
+%! assert (__gfweight__ ([gen, mod(sum (gen, 2), 2)]), 4)
+%! assert (__gfweight__ ([1 1 0; 1 1 0]), 0)
+
+%!test
+%! gen = egolaygen ();
+%! assert (__gfweight__ (gen), 8)
+%! assert (__gfweight__ (gen, 1), 8)
+%! assert (__gfweight__ (gen(:, [13:24, 1:12])), 8)
+*/
+
+// The number of codewords of each weight, accumulated in a, among the
+// 2^r sums of the r packed rows g of length n. The sums are walked in
+// Gray code order, so that each costs a single exclusive or, in 2^c
+// blocks shared between the threads
+static void
+gfweight_count (std::vector<uint64_t>& a, const std::vector<bitpack_word>& g,
+                int r, int n, int nthreads)
+{
+  int nw = BITPACK_WORDS (n);
+  int c = (r < 8 ? r : 8);
+  int nblocks = 1 << c;
+  uint64_t len = (uint64_t)1 << (r - c);
+  std::vector<uint64_t> count ((size_t)nblocks * (n + 1), 0);
+
+  parallel_for (nblocks, (r > 16 ? nthreads : 1),
+    [&] (int q)
+    {
+      uint64_t *cnt = &count[(size_t)q * (n + 1)];
+      uint64_t start = (uint64_t)q * len;
+      uint64_t gray = start ^ (start >> 1);
+      std::vector<bitpack_word> cw (nw, 0);
+
+      for (int i = 0; i < r; i++)
+        if ((gray >> i) & 1)
+          bitpack_xor (&cw[0], &g[i*nw], nw);
+      cnt[bitpack_weight (&cw[0], nw)]++;
+
+      for (uint64_t x = start + 1; x < start + len; x++)
+        {
+          int i = 0;
+          while (! ((x >> i) & 1))
+            i++;
+          bitpack_xor (&cw[0], &g[i*nw], nw);
+          cnt[bitpack_weight (&cw[0], nw)]++;
+        }
+    });
+
+  for (int q = 0; q < nblocks; q++)
+    for (int i = 0; i <= n; i++)
+      a[i] += count[(size_t)q * (n + 1) + i];
+}
+
+// Fixed width two's complement integers of nl 32-bit limbs, enough for
+// the exact MacWilliams transform of codes of any length
+
+static void
+bigint_sub_from (uint32_t *a, const uint32_t *b, int nl)
+{
+  uint64_t borrow = 0;
+  for (int l = 0; l < nl; l++)
+    {
+      uint64_t d = (uint64_t)a[l] - b[l] - borrow;
+      a[l] = (uint32_t)d;
+      borrow = (d >> 32) & 1;
+    }
+}
+
+static void
+bigint_add_to (uint32_t *a, const uint32_t *b, int nl)
+{
+  uint64_t carry = 0;
+  for (int l = 0; l < nl; l++)
+    {
+      uint64_t s = (uint64_t)a[l] + b[l] + carry;
+      a[l] = (uint32_t)s;
+      carry = s >> 32;
+    }
+}
+
+// a += b * m, for a non-negative b
+static void
+bigint_add_mul (uint32_t *a, const uint32_t *b, uint64_t m, int nl)
+{
+  for (int h = 0; h < 2; h++)
+    {
+      uint64_t mh = (h == 0 ? m & 0xFFFFFFFFULL : m >> 32);
+      uint64_t carry = 0;
+      for (int l = h; l < nl; l++)
+        {
+          uint64_t s = (uint64_t)a[l] + (uint64_t)b[l-h] * mh + carry;
+          a[l] = (uint32_t)s;
+          carry = s >> 32;
+        }
+    }
+}
+
+// The weight distribution a of a code of length n with a dual code of
+// dimension m and weight distribution b, by the MacWilliams identity
+//
+//   sum (a(i) z^i) = 2^-m sum (b(j) (1-z)^j (1+z)^(n-j))
+//
+// evaluated by Horner's rule in (1-z)/(1+z) on polynomials with exact
+// integer coefficients
+static void
+gfweight_macwilliams (std::vector<double>& a, const std::vector<uint64_t>& b,
+                      int n, int m)
+{
+  int nl = (2 * n + 66) / 32 + 1;
+  std::vector<uint32_t> s ((size_t)(n + 1) * nl, 0);
+  std::vector<uint32_t> v ((size_t)(n + 1) * nl, 0);
+
+  // v = (1+z)^(n-j)
+  v[0] = 1;
+  for (int j = n; j >= 0; j--)
+    {
+      OCTAVE_QUIT;
+
+      if (j < n)
+        {
+          for (int i = n; i > 0; i--)
+            bigint_sub_from (&s[(size_t)i*nl], &s[(size_t)(i-1)*nl], nl);
+          for (int i = n - j; i > 0; i--)
+            bigint_add_to (&v[(size_t)i*nl], &v[(size_t)(i-1)*nl], nl);
+        }
+
+      if (b[j] != 0)
+        for (int i = 0; i <= n - j; i++)
+          bigint_add_mul (&s[(size_t)i*nl], &v[(size_t)i*nl], b[j], nl);
+    }
+
+  // The coefficients are non-negative multiples of 2^m
+  a.resize (n + 1);
+  for (int i = 0; i <= n; i++)
+    {
+      const uint32_t *x = &s[(size_t)i*nl];
+      double r = 0.;
+      for (int l = nl - 1; l >= 0; l--)
+        r = r * 4294967296. + x[l];
+      a[i] = std::ldexp (r, -m);
+    }
+}
+
+DEFUN_DLD (__gfwtdist__, args, ,
+  "-*- texinfo -*-\n\
+@deftypefn  {Loadable Function} {@var{a} =} __gfwtdist__ (@var{gen})\n\
+@deftypefnx {Loadable Function} {@var{a} =} __gfwtdist__ (@var{gen}, @var{nthreads})\n\
+Returns the weight distribution of the code generated by @var{gen}, as a\n\
+row vector @var{a} with @var{a}(@var{i}+1) codewords of weight @var{i}.\n\
+The 2^k codewords, or the 2^(n-k) codewords of the dual code followed by\n\
+the MacWilliams transform if there are fewer of them, are enumerated on\n\
+up to @var{nthreads} threads.\n\
 \n\
 This is an internal function of @code{gfweight}. You should use\n\
 @code{gfweight} rather than use this function directly.\n\
 @seealso{gfweight}\n\
 @end deftypefn")
 {
+  int nargin = args.length ();
 
-  if (args.length () != 1)
+  if (nargin < 1 || nargin > 2)
     {
       print_usage ();
       return octave_value ();
@@ -64,22 +457,92 @@ This is an internal function of @code{gfweight}. You should use\n\
   Matrix gen = args(0).matrix_value ();
   int k = gen.rows ();
   int n = gen.columns ();
+  int nw = BITPACK_WORDS (n);
+  int nthreads = parallel_threads ();
+
+  if (nargin > 1)
+    {
+      nthreads = args(1).int_value ();
+      if (nthreads < 1)
+        {
+          error ("__gfwtdist__: NTHREADS must be a positive integer");
+          return octave_value ();
+        }
+    }
+
+  std::vector<bitpack_word> g (k * nw);
+  for (int i = 0; i < k; i++)
+    bitpack_row (&g[i*nw], gen, i, n);
 
-  if (k > 128)
+  std::vector<bool> used (n, false);
+  std::vector<int> piv;
+  int r = gfweight_reduce (g, k, n, used, piv);
+  int m = n - r;
+
+  if ((r < m ? r : m) > 62)
     {
-      octave_stdout << "__gfweight__: this is likely to take a very long time!!\n";
-      flush_octave_stdout ();
+      error ("__gfwtdist__: the code and its dual have more than 2^62 codewords");
+      return octave_value ();
     }
 
-  Array<char> codeword (dim_vector (n, 1), 0);
-  return octave_value ((double)get_weight (codeword, gen, n - k + 1, 1,
-                                           0, n, k));
+  std::vector<uint64_t> count (n + 1, 0);
+  RowVector a (n + 1, 0.);
+
+  if (r <= m)
+    {
+      gfweight_count (count, g, r, n, nthreads);
+      for (int i = 0; i <= n; i++)
+        a(i) = count[i];
+    }
+  else
+    {
+      // The dual code has a row for each non-pivot column c, with ones at
+      // c and at the pivots of the rows having a one at c
+      std::vector<bitpack_word> h (m * nw, 0);
+      for (int c = 0, j = 0; c < n; c++)
+        if (! used[c])
+          {
+            bitpack_set (&h[j*nw], c);
+            for (int i = 0; i < r; i++)
+              if (bitpack_get (&g[i*nw], c))
+                bitpack_set (&h[j*nw], piv[i]);
+            j++;
+          }
+
+      gfweight_count (count, h, m, n, nthreads);
+
+      std::vector<double> dist;
+      gfweight_macwilliams (dist, count, n, m);
+      for (int i = 0; i <= n; i++)
+        a(i) = dist[i];
+    }
+
+  return octave_value (a);
 }
 
 /*
 %% Test input validation
-%!error __gfweight__ ()
-%!error __gfweight__ (1, 2)
+%!error __gfwtdist__ ()
+%!error __gfwtdist__ (1, 2, 3)
+
+%!test
+%! [par, gen] = hammgen (3);
+%! assert (__gfwtdist__ (gen), [1 0 0 7 7 0 0 1])
+%! assert (__gfwtdist__ (par), [1 0 0 0 7 0 0 0])
+
+%!test
+%! [par, gen] = hammgen (4);
+%! a = [1 0 0 35 105 168 280 435 435 280 168 105 35 0 0 1];
+%! assert (__gfwtdist__ (gen), a)
+%! assert (__gfwtdist__ (gen, 1), a)
+
+%!test
+%! gen = egolaygen ();
+%! a = [1, zeros(1, 7), 759, 0, 0, 0, 2576, 0, 0, 0, 759, zeros(1, 7), 1];
+%! assert (__gfwtdist__ (gen), a)
+%! gen = gen(1:4, :);
+%! w = sum (mod ((dec2bin (0:15) - "0") * gen, 2), 2);
+%! assert (__gfwtdist__ (gen), accumarray (w + 1, 1, [25, 1])')
 */
 
 /*
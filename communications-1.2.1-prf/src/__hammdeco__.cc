@@ -0,0 +1,145 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+#include <octave/oct.h>
+#include <octave/oct-locbuf.h>
+
+#include "bitslice.h"
+
+DEFUN_DLD (__hammdeco__, args, ,
+  "-*- texinfo -*-\n\
+@deftypefn {Loadable Function} {[@var{ccode}, @var{err}] =} __hammdeco__ (@var{par}, @var{code})\n\
+Corrects the codewords in the rows of @var{code} for a Hamming code with\n\
+the parity check matrix @var{par}. The codewords are decoded in bit-sliced\n\
+blocks. The corrected codewords are returned in @var{ccode} and the number\n\
+of corrected bits in each codeword in @var{err}.\n\
+\n\
+This is an internal function of @code{decode}. You should use\n\
+@code{decode} rather than use this function directly.\n\
+@seealso{decode}\n\
+@end deftypefn")
+{
+  octave_value_list retval;
+
+  if (args.length () != 2)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  Matrix par = args(0).matrix_value ();
+  Matrix code = args(1).matrix_value ();
+  int m = par.rows ();
+  int n = par.cols ();
+  int nsym = code.rows ();
+
+  if (code.cols () != n)
+    {
+      error ("__hammdeco__: CODE must have the same number of columns as PAR");
+      return retval;
+    }
+
+  const int W = __OCTAVE_BITSLICE_WORDS;
+  const int L = __OCTAVE_BITSLICE_LANES;
+
+  OCTAVE_LOCAL_BUFFER (bitslice_word, c, n * W);
+  OCTAVE_LOCAL_BUFFER (bitslice_word, syn, m * W);
+  OCTAVE_LOCAL_BUFFER (bitslice_word, match, W);
+  OCTAVE_LOCAL_BUFFER (bitslice_word, any, W);
+  ColumnVector err (nsym, 0.);
+
+  for (int l0 = 0; l0 < nsym; l0 += L)
+    {
+      OCTAVE_QUIT;
+
+      int nlanes = (nsym - l0 < L ? nsym - l0 : L);
+
+      for (int j = 0; j < n; j++)
+        {
+          bitslice_word *cj = c + j * W;
+          bitslice_clear (cj);
+          for (int lane = 0; lane < nlanes; lane++)
+            if (code(l0+lane, j) != 0)
+              bitslice_set_lane (cj, lane);
+        }
+
+      bitslice_clear (any);
+      for (int b = 0; b < m; b++)
+        {
+          bitslice_word *sb = syn + b * W;
+          bitslice_clear (sb);
+          for (int j = 0; j < n; j++)
+            if (par(b, j) != 0)
+              bitslice_xor (sb, c + j * W);
+          bitslice_or (any, sb);
+        }
+
+      if (! bitslice_any (any))
+        continue;
+
+      // The single bit in error is the one whose column of the parity
+      // check matrix equals the syndrome
+      for (int j = 0; j < n; j++)
+        {
+          bitslice_copy (match, any);
+          for (int b = 0; b < m; b++)
+            if (par(b, j) != 0)
+              bitslice_and (match, syn + b * W);
+            else
+              bitslice_andnot (match, syn + b * W);
+
+          if (bitslice_any (match))
+            for (int lane = 0; lane < nlanes; lane++)
+              if (bitslice_lane (match, lane))
+                code(l0+lane, j) = (int)code(l0+lane, j) ^ 1;
+        }
+
+      for (int lane = 0; lane < nlanes; lane++)
+        if (bitslice_lane (any, lane))
+          err(l0+lane) = 1;
+    }
+
+  retval(1) = octave_value (err);
+  retval(0) = octave_value (code);
+  return retval;
+}
+
+/*
+%% Test input validation
+%!error __hammdeco__ ()
+%!error __hammdeco__ (1)
+%!error __hammdeco__ (1, 2, 3)
+%!error __hammdeco__ ([1 0 1], [1 0])
+
+%!test
+%! [par, gen] = hammgen (3);
+%! code = mod (randi ([0 1], 100, 4) * gen, 2);
+%! noisy = code;
+%! noisy(1:7, :) = mod (noisy(1:7, :) + eye (7), 2);
+%! [ccode, err] = __hammdeco__ (par, noisy);
+%! assert (ccode, code)
+%! assert (err, [ones(7, 1); zeros(93, 1)])
+*/
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
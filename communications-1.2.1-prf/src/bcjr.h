@@ -0,0 +1,385 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+
+#if !defined (octave_bcjr_h)
+#define octave_bcjr_h 1
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <octave/oct.h>
+
+#include "trellis.h"
+
+enum bcjr_algorithm
+{
+  BCJR_MAX_LOG=0,
+  BCJR_LOG_MAP
+};
+
+// The metric of the impossible paths, finite so that differences and
+// sums of metrics stay defined
+#define BCJR_NEG (-1e30f)
+
+// The BCJR algorithm on the trellis t, from the log-likelihood ratios
+// log (P(0) / P(1)) of the output bits and of the input bits of each
+// step, to the a posteriori log-likelihood ratios of both. The metric of
+// a branch is minus the sum of the ratios of its bits that are 1, and
+// the path metrics are combined with max*, max (a, b) + log (1 +
+// exp (-|a-b|)), or only max for max-log.
+//
+// The decoder starts in the all-zeros state, and ends in it if term is
+// true. With a window w > 0, the forward and branch metrics are kept
+// for w steps at a time, and the backward recursion of each window
+// starts from equal metrics w steps beyond it, so that the memory does
+// not grow with the length of the frame. The recursions of a butterfly
+// trellis are loops over the states without any dependencies between
+// iterations, as in the Viterbi decoder
+class bcjr
+{
+public:
+
+  bcjr (const conv_trellis& _t, bcjr_algorithm _alg, bool _term, int _window)
+    : t (_t), S (_t.nstates), H (_t.nstates / 2), alg (_alg), term (_term),
+      window (_window)
+  {
+    // The branches are listed with their source and destination states
+    // and their input and output symbols. Those of a butterfly trellis
+    // go to the lower half of the states from p at p, and to the upper
+    // half at S+p, and those of any other trellis are in the order of
+    // nextStates, with the predecessors of each state in pedge
+    E = S * t.ninputs;
+    src.resize (E);
+    dst.resize (E);
+    ein.resize (E);
+    eout.resize (E);
+    if (t.butterfly)
+      for (int e = 0; e < E; e++)
+        {
+          int p = e % S;
+          src[e] = p;
+          dst[e] = (p >> 1) + (e >= S ? H : 0);
+          ein[e] = t.bf_in[e];
+          eout[e] = t.bf_out[e];
+        }
+    else
+      {
+        for (int e = 0; e < E; e++)
+          {
+            src[e] = e / t.ninputs;
+            dst[e] = t.next[e];
+            ein[e] = e % t.ninputs;
+            eout[e] = t.out[e];
+          }
+        pedge.assign ((size_t)S * t.npred, -1);
+        std::vector<int> deg (S, 0);
+        for (int e = 0; e < E; e++)
+          pedge[(size_t)dst[e]*t.npred + deg[dst[e]]++] = e;
+      }
+
+    // The branches sorted on each input bit and each output bit, those
+    // with the bit at 0 first
+    order.resize ((size_t)(t.k + t.n) * E);
+    nzero.resize (t.k + t.n);
+    for (int b = 0; b < t.k + t.n; b++)
+      {
+        int *o = &order[(size_t)b*E];
+        int i = 0;
+        for (int v = 0; v < 2; v++)
+          {
+            for (int e = 0; e < E; e++)
+              {
+                int x = (b < t.k ? ein[e] >> (t.k - b - 1)
+                         : eout[e] >> (t.n - b + t.k - 1));
+                if ((x & 1) == v)
+                  o[i++] = e;
+              }
+            if (v == 0)
+              nzero[b] = i;
+          }
+      }
+
+    // log (1 + exp (-d)) at the middle of the intervals of 1/8 from 0 to
+    // 8, and 0 beyond
+    for (int i = 0; i < 64; i++)
+      table[i] = std::log1p (std::exp (-(i + 0.5) / 8));
+    table[64] = 0;
+  }
+
+  // Decode the nsteps steps of lc, n ratios per step, and lu, k ratios
+  // per step or null if there is no a priori information, into the a
+  // posteriori ratios ou of the input bits, and oc of the output bits
+  // if it is not null
+  void decode (const float *lc, const float *lu, octave_idx_type nsteps,
+               float *ou, float *oc) const
+  {
+    if (alg == BCJR_LOG_MAP)
+      run<true> (lc, lu, nsteps, ou, oc);
+    else
+      run<false> (lc, lu, nsteps, ou, oc);
+  }
+
+private:
+
+  template <bool LOGMAP>
+  float maxstar (float a, float b) const
+  {
+    float m = (a > b ? a : b);
+    if (LOGMAP)
+      {
+        float d = (a > b ? a - b : b - a) * 8;
+        m += table[(int)(d < 64 ? d : 64)];
+      }
+    return m;
+  }
+
+  // The branch metrics g of the step u
+  void branches (const float *lc, const float *lu, octave_idx_type u,
+                 std::vector<float>& bo, std::vector<float>& bi,
+                 float *g) const
+  {
+    int n = t.n;
+    int k = t.k;
+    const float *c = lc + u*n;
+
+    // The metrics of the output symbols are built bit by bit, when there
+    // are fewer of them than branches
+    if (t.noutputs <= E)
+      {
+        bo[0] = 0;
+        for (int b = 0; b < n; b++)
+          {
+            int w = 1 << (n - b - 1);
+            for (int o = 0; o < t.noutputs; o += 2*w)
+              for (int i = 0; i < w; i++)
+                bo[o+w+i] = bo[o+i] - c[b];
+          }
+        for (int e = 0; e < E; e++)
+          g[e] = bo[eout[e]];
+      }
+    else
+      for (int e = 0; e < E; e++)
+        {
+          float x = 0;
+          for (int b = 0; b < n; b++)
+            if ((eout[e] >> (n - b - 1)) & 1)
+              x -= c[b];
+          g[e] = x;
+        }
+
+    if (lu)
+      {
+        const float *a = lu + u*k;
+        for (int i = 0; i < t.ninputs; i++)
+          {
+            float x = 0;
+            for (int b = 0; b < k; b++)
+              if ((i >> (k - b - 1)) & 1)
+                x -= a[b];
+            bi[i] = x;
+          }
+        for (int e = 0; e < E; e++)
+          g[e] += bi[ein[e]];
+      }
+  }
+
+  // The forward metrics nx after the step of branch metrics g, from a
+  template <bool LOGMAP>
+  void forward (const float *a, const float *g, float *nx) const
+  {
+    if (t.butterfly)
+      for (int j = 0; j < H; j++)
+        {
+          nx[j] = maxstar<LOGMAP> (a[2*j] + g[2*j], a[2*j+1] + g[2*j+1]);
+          nx[j+H] = maxstar<LOGMAP> (a[2*j] + g[S+2*j],
+                                     a[2*j+1] + g[S+2*j+1]);
+        }
+    else
+      for (int j = 0; j < S; j++)
+        {
+          float x = BCJR_NEG;
+          for (int i = 0; i < t.npred; i++)
+            {
+              int e = pedge[(size_t)j*t.npred+i];
+              if (e >= 0)
+                x = maxstar<LOGMAP> (x, a[src[e]] + g[e]);
+            }
+          nx[j] = x;
+        }
+    normalize (nx);
+  }
+
+  // The backward metrics b before the step of branch metrics g, from nb
+  template <bool LOGMAP>
+  void backward (const float *nb, const float *g, float *b) const
+  {
+    if (t.butterfly)
+      for (int p = 0; p < S; p++)
+        b[p] = maxstar<LOGMAP> (g[p] + nb[p >> 1], g[S+p] + nb[(p >> 1) + H]);
+    else
+      for (int s = 0; s < S; s++)
+        {
+          float x = BCJR_NEG;
+          for (int i = 0; i < t.ninputs; i++)
+            {
+              int e = s*t.ninputs + i;
+              x = maxstar<LOGMAP> (x, g[e] + nb[dst[e]]);
+            }
+          b[s] = x;
+        }
+    normalize (b);
+  }
+
+  // Keep the largest metric at 0
+  void normalize (float *m) const
+  {
+    float mx = BCJR_NEG;
+    for (int s = 0; s < S; s++)
+      mx = (m[s] > mx ? m[s] : mx);
+    for (int s = 0; s < S; s++)
+      m[s] -= mx;
+  }
+
+  // The a posteriori ratios of the step u, from the forward metrics a
+  // before it, its branch metrics g and the backward metrics nb after it
+  template <bool LOGMAP>
+  void ratios (const float *a, const float *g, const float *nb,
+               octave_idx_type u, std::vector<float>& m, float *ou,
+               float *oc) const
+  {
+    for (int e = 0; e < E; e++)
+      m[e] = a[src[e]] + g[e] + nb[dst[e]];
+
+    for (int b = 0; b < t.k; b++)
+      ou[u*t.k+b] = ratio<LOGMAP> (m, b);
+
+    if (oc)
+      for (int b = 0; b < t.n; b++)
+        oc[u*t.n+b] = ratio<LOGMAP> (m, t.k + b);
+  }
+
+  // The ratio of the bit b, of the branch metrics m of the branches
+  // listed in order with the bit at 0 first
+  template <bool LOGMAP>
+  float ratio (const std::vector<float>& m, int b) const
+  {
+    const int *o = &order[(size_t)b*E];
+    int nz = nzero[b];
+    float x0 = BCJR_NEG;
+    float x1 = BCJR_NEG;
+    for (int i = 0; i < nz; i++)
+      x0 = maxstar<LOGMAP> (x0, m[o[i]]);
+    for (int i = nz; i < E; i++)
+      x1 = maxstar<LOGMAP> (x1, m[o[i]]);
+    return x0 - x1;
+  }
+
+  template <bool LOGMAP>
+  void run (const float *lc, const float *lu, octave_idx_type nsteps,
+            float *ou, float *oc) const
+  {
+    // A window longer than the frame is the frame
+    octave_idx_type w = std::max (nsteps, (octave_idx_type)1);
+    if (window > 0)
+      w = std::min ((octave_idx_type)window, w);
+    std::vector<float> alpha ((size_t)(w + 1) * S);
+    std::vector<float> gamma ((size_t)w * E);
+    std::vector<float> beta (S);
+    std::vector<float> nbeta (S);
+    std::vector<float> g (E);
+    std::vector<float> m (E);
+    std::vector<float> bo (t.noutputs <= E ? t.noutputs : 0);
+    std::vector<float> bi (t.ninputs);
+
+    // The forward and branch metrics of the window are kept for the
+    // backward recursion, and the forward metrics at the start of the
+    // window are carried in the first slot
+    std::fill (alpha.begin (), alpha.begin () + S, BCJR_NEG);
+    alpha[0] = 0;
+
+    for (octave_idx_type w0 = 0; w0 < nsteps; w0 += w)
+      {
+        octave_idx_type w1 = std::min (w0 + w, nsteps);
+
+        for (octave_idx_type u = w0; u < w1; u++)
+          {
+            float *gu = &gamma[(u-w0)*E];
+            branches (lc, lu, u, bo, bi, gu);
+            forward<LOGMAP> (&alpha[(u-w0)*S], gu, &alpha[(u-w0+1)*S]);
+          }
+
+        // The backward recursion starts at the end of the frame, or from
+        // equal metrics w steps after the window
+        octave_idx_type u1 = std::min (w1 + w, nsteps);
+        if (u1 == nsteps && term)
+          {
+            std::fill (nbeta.begin (), nbeta.end (), BCJR_NEG);
+            nbeta[0] = 0;
+          }
+        else
+          std::fill (nbeta.begin (), nbeta.end (), 0.f);
+
+        for (octave_idx_type u = u1 - 1; u >= w1; u--)
+          {
+            branches (lc, lu, u, bo, bi, &g[0]);
+            backward<LOGMAP> (&nbeta[0], &g[0], &beta[0]);
+            nbeta.swap (beta);
+          }
+
+        for (octave_idx_type u = w1 - 1; u >= w0; u--)
+          {
+            const float *gu = &gamma[(u-w0)*E];
+            ratios<LOGMAP> (&alpha[(u-w0)*S], gu, &nbeta[0], u, m, ou, oc);
+            backward<LOGMAP> (&nbeta[0], gu, &beta[0]);
+            nbeta.swap (beta);
+          }
+
+        std::copy (alpha.begin () + (w1-w0)*S,
+                   alpha.begin () + (w1-w0+1)*S, alpha.begin ());
+      }
+  }
+
+  const conv_trellis& t;
+  int S;
+  int H;
+  int E;
+  bcjr_algorithm alg;
+  bool term;
+  int window;
+
+  std::vector<int> src;
+  std::vector<int> dst;
+  std::vector<int> ein;
+  std::vector<int> eout;
+  std::vector<int> pedge;
+  std::vector<int> order;
+  std::vector<int> nzero;
+  float table[65];
+};
+
+#endif
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
@@ -0,0 +1,569 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+
+#include <string>
+#include <vector>
+
+#include <octave/oct.h>
+
+#include "bcjr.h"
+#include "parallel.h"
+#include "trellis.h"
+
+// PKG_ADD: autoload ("turbodec", "bcjrdec.oct");
+// PKG_DEL: autoload ("turbodec", "bcjrdec.oct", "remove");
+
+struct bcjr_options
+{
+  bcjr_algorithm alg;
+  bool term;
+  int window;
+  int maxiter;
+  bool early;
+  double scaling;
+};
+
+// Read the properties of bcjrdec, or of turbodec if turbo is true, from
+// args(i) onwards
+static bool
+bcjr_get_options (const octave_value_list& args, int i, bool turbo,
+                  const char *fcn, bcjr_options& opt)
+{
+  opt.alg = BCJR_MAX_LOG;
+  opt.term = false;
+  opt.window = 0;
+  opt.maxiter = 8;
+  opt.early = true;
+  opt.scaling = -1;
+
+  for (; i < args.length (); i += 2)
+    {
+      if (! args(i).is_string ())
+        {
+          error ("%s: property names must be strings", fcn);
+          return false;
+        }
+      std::string prop = args(i).string_value ();
+      octave_value val = args(i+1);
+
+      if (prop == "algorithm" || prop == "termination")
+        {
+          if (! val.is_string ())
+            {
+              error ("%s: %s must be a string", fcn, prop.c_str ());
+              return false;
+            }
+          std::string s = val.string_value ();
+          if (prop == "algorithm" && (s == "max-log" || s == "log-map"))
+            opt.alg = (s == "log-map" ? BCJR_LOG_MAP : BCJR_MAX_LOG);
+          else if (prop == "termination" && ! turbo
+                   && (s == "trunc" || s == "term"))
+            opt.term = (s == "term");
+          else if (prop == "termination" && turbo
+                   && (s == "early" || s == "max"))
+            opt.early = (s == "early");
+          else
+            {
+              error ("%s: invalid %s \"%s\"", fcn, prop.c_str (), s.c_str ());
+              return false;
+            }
+        }
+      else if (prop == "window")
+        {
+          double w = val.double_value ();
+          if (! (w >= 0 && w == std::floor (w) && w < (1 << 24)))
+            {
+              error ("%s: window must be a non-negative integer less than "
+                     "2^24", fcn);
+              return false;
+            }
+          opt.window = (int)w;
+        }
+      else if (prop == "maxiter" && turbo)
+        {
+          opt.maxiter = val.int_value ();
+          if (opt.maxiter < 1)
+            {
+              error ("%s: maxiter must be a positive integer", fcn);
+              return false;
+            }
+        }
+      else if (prop == "scaling" && turbo)
+        {
+          opt.scaling = val.double_value ();
+          if (! (opt.scaling > 0 && opt.scaling <= 1))
+            {
+              error ("%s: scaling must be in the range (0, 1]", fcn);
+              return false;
+            }
+        }
+      else
+        {
+          error ("%s: unknown property \"%s\"", fcn, prop.c_str ());
+          return false;
+        }
+    }
+
+  if (opt.scaling < 0)
+    opt.scaling = (opt.alg == BCJR_MAX_LOG ? 0.75 : 1);
+
+  return true;
+}
+
+// Copy the row f of the nframes rows of a into the floats x
+static void
+bcjr_get_row (const double *a, octave_idx_type nframes, octave_idx_type f,
+              octave_idx_type len, float *x)
+{
+  for (octave_idx_type i = 0; i < len; i++)
+    x[i] = a[f + i*nframes];
+}
+
+static void
+bcjr_put_row (const float *x, octave_idx_type nframes, octave_idx_type f,
+              octave_idx_type len, double *a)
+{
+  for (octave_idx_type i = 0; i < len; i++)
+    a[f + i*nframes] = x[i];
+}
+
+DEFUN_DLD (bcjrdec, args, nargout,
+  "-*- texinfo -*-\n\
+@deftypefn  {Loadable Function} {@var{lu} =} bcjrdec (@var{lc}, @var{t})\n\
+@deftypefnx {Loadable Function} {@var{lu} =} bcjrdec (@var{lc}, @var{t}, @var{la})\n\
+@deftypefnx {Loadable Function} {@var{lu} =} bcjrdec (@var{lc}, @var{t}, @var{la}, @var{prop}, @var{val}, @dots{})\n\
+@deftypefnx {Loadable Function} {[@var{lu}, @var{lc}] =} bcjrdec (@dots{})\n\
+Decode the frames in the rows of @var{lc} with the BCJR algorithm on\n\
+the trellis structure @var{t}. The elements of @var{lc} are the\n\
+log-likelihood ratios log (P(0) / P(1)) of the encoded bits, @math{n}\n\
+for each step of the trellis, so that positive values favour zero. The\n\
+optional matrix @var{la} holds the a priori log-likelihood ratios of the\n\
+input bits, @math{k} for each step, and may be empty.\n\
+\n\
+The a posteriori log-likelihood ratios of the input bits are returned in\n\
+the rows of @var{lu}, and those of the encoded bits in the rows of\n\
+@var{lc}. The properties are\n\
+\n\
+@table @asis\n\
+@item \"algorithm\"\n\
+\"max-log\", the default, combines the path metrics with their maximum,\n\
+and \"log-map\" adds the correction log (1 + exp (-|a-b|)) from a table.\n\
+@item \"termination\"\n\
+\"trunc\", the default, for an encoder that starts in the all-zeros\n\
+state, and \"term\" for one that also ends in it.\n\
+@item \"window\"\n\
+The number of steps of the windows of the forward recursion, each of\n\
+whose backward recursions starts as many steps after it. The memory\n\
+used is then independent of the length of the frames. The default, 0,\n\
+decodes each frame in a single window, as do windows longer than the\n\
+frames. It must be less than 2^24.\n\
+@end table\n\
+\n\
+The recursions of codes of one input bit are vectorized over the\n\
+states, and the frames are decoded on all available processors.\n\
+@seealso{turbodec, vitdec, poly2trellis}\n\
+@end deftypefn")
+{
+  octave_value_list retval;
+  int nargin = args.length ();
+
+  if (nargin < 2 || (nargin > 2 && (nargin % 2) == 0))
+    {
+      print_usage ();
+      return retval;
+    }
+
+  conv_trellis t;
+  if (! get_trellis (args(1), "bcjrdec", t))
+    return retval;
+
+  bcjr_options opt;
+  if (! bcjr_get_options (args, 3, false, "bcjrdec", opt))
+    return retval;
+
+  Matrix lc = args(0).matrix_value ();
+  octave_idx_type nframes = lc.rows ();
+  octave_idx_type nsteps = lc.columns () / t.n;
+  if (lc.columns () % t.n != 0)
+    {
+      error ("bcjrdec: the number of columns of LC must be a multiple of %d",
+             t.n);
+      return retval;
+    }
+
+  Matrix la;
+  if (nargin > 2 && ! args(2).is_empty ())
+    {
+      la = args(2).matrix_value ();
+      if (la.rows () != nframes || la.columns () != nsteps * t.k)
+        {
+          error ("bcjrdec: LA must be a %d by %d matrix", nframes,
+                 nsteps * t.k);
+          return retval;
+        }
+    }
+
+  Matrix lu (nframes, nsteps * t.k);
+  Matrix lco;
+  if (nargout > 1)
+    lco = Matrix (nframes, nsteps * t.n);
+
+  // The outputs are unshared before the threads write to them
+  double *plu = lu.fortran_vec ();
+  double *plco = (nargout > 1 ? lco.fortran_vec () : 0);
+  const double *plc = lc.data ();
+  const double *pla = (la.is_empty () ? 0 : la.data ());
+
+  bcjr dec (t, opt.alg, opt.term, opt.window);
+  parallel_for (nframes, parallel_threads (), [&] (int f)
+    {
+      int n = t.n;
+      int k = t.k;
+      std::vector<float> c (nsteps * n);
+      std::vector<float> a (pla ? nsteps * k : 0);
+      std::vector<float> ou (nsteps * k);
+      std::vector<float> oc (plco ? nsteps * n : 0);
+
+      bcjr_get_row (plc, nframes, f, nsteps * n, c.data ());
+      if (pla)
+        bcjr_get_row (pla, nframes, f, nsteps * k, a.data ());
+      dec.decode (c.data (), (pla ? a.data () : 0), nsteps, ou.data (),
+                  (plco ? oc.data () : 0));
+      bcjr_put_row (ou.data (), nframes, f, nsteps * k, plu);
+      if (plco)
+        bcjr_put_row (oc.data (), nframes, f, nsteps * n, plco);
+    });
+
+  if (nargout > 1)
+    retval(1) = octave_value (lco);
+  retval(0) = octave_value (lu);
+  return retval;
+}
+
+/*
+%!shared t, U
+%! t = poly2trellis (3, [7 5]);
+%! U = dec2bin (0:63) - "0";
+
+%!test
+%! ## log-MAP gives the a posteriori ratios of all the messages
+%! lc = 2 * randn (1, 12);
+%! la = randn (1, 6);
+%! p = zeros (64, 1);
+%! for i = 1:64
+%!   p(i) = -sum (convenc (U(i,:), t) .* lc) - sum (U(i,:) .* la);
+%! endfor
+%! ref = zeros (1, 6);
+%! for j = 1:6
+%!   ref(j) = log (sum (exp (p(U(:,j) == 0))))
+%!            - log (sum (exp (p(U(:,j) == 1))));
+%! endfor
+%! assert (bcjrdec (lc, t, la, "algorithm", "log-map"), ref, 0.15)
+
+%!test
+%! ## The decisions of max-log are those of the Viterbi algorithm
+%! t = poly2trellis (7, [171 133]);
+%! msg = [randi([0 1], 1, 500) zeros(1, 6)];
+%! lc = 2 * (1 - 2 * convenc (msg, t)) + 1.5 * randn (1, 1012);
+%! [lu, lco] = bcjrdec (lc, t, [], "termination", "term");
+%! dec = vitdec (lc, t, 40, "term", "unquant");
+%! assert (double (lu < 0), dec)
+%! assert (double (lco < 0), convenc (dec, t))
+%! lw = bcjrdec ([lc; lc(end:-1:1)], t, [], "termination", "term", ...
+%!               "window", 64);
+%! assert (double (lw(1,:) < 0), dec)
+%! assert (lw(2,:), bcjrdec (lc(end:-1:1), t, [], "termination", "term", ...
+%!                           "window", 64), 1e-4)
+%! ## A window longer than the frame is the whole frame
+%! assert (bcjrdec (lc, t, [], "termination", "term", "window", 2^20), lu)
+
+%!test
+%! ## Codes of several input bits
+%! t = poly2trellis ([5 4], [23 35 0; 0 5 13]);
+%! msg = randi ([0 1], 1, 300);
+%! lc = 4 * (1 - 2 * convenc (msg, t));
+%! lc(10) = -lc(10);
+%! assert (double (bcjrdec (lc, t, [], "algorithm", "log-map") < 0), msg)
+
+%% Test input validation
+%!error bcjrdec ()
+%!error bcjrdec (1)
+%!error bcjrdec (1, t, [], "window")
+%!error <valid trellis> bcjrdec ([0 0], struct ())
+%!error <multiple of 2> bcjrdec ([0 0 0], t)
+%!error <LA> bcjrdec ([0 0], t, [0 0])
+%!error <algorithm> bcjrdec ([0 0], t, [], "algorithm", "foo")
+%!error <window> bcjrdec ([0 0], t, [], "window", -1)
+%!error <less than 2\^24> bcjrdec ([0 0], t, [], "window", 2^24)
+%!error <unknown property> bcjrdec ([0 0], t, [], "maxiter", 5)
+*/
+
+// Check that the trellis t is of a systematic code of rate 1/n, the
+// first output bit of each branch being its input bit
+static bool
+turbo_systematic (const conv_trellis& t)
+{
+  if (t.k != 1 || t.n < 2)
+    return false;
+  for (int e = 0; e < t.nstates * t.ninputs; e++)
+    if (((t.out[e] >> (t.n - 1)) & 1) != (e & 1))
+      return false;
+  return true;
+}
+
+// Decode the frame c of nsteps steps of 2n-1 ratios with the
+// permutation perm of the message into the a posteriori ratios app of
+// the message bits. Returns the number of iterations
+static int
+turbo_decode (const bcjr& dec, int n, const std::vector<int>& perm,
+              const bcjr_options& opt, const float *c,
+              octave_idx_type nsteps, float *app)
+{
+  int m = 2*n - 1;
+  std::vector<float> ls (nsteps);
+  std::vector<float> lc1 (nsteps * n);
+  std::vector<float> lc2 (nsteps * n);
+  std::vector<float> la (nsteps, 0.f);
+  std::vector<float> le (nsteps);
+  std::vector<float> app1 (nsteps);
+  std::vector<float> app2 (nsteps);
+
+  // The first encoder sends the systematic and parity bits of the
+  // message, and the second the parity bits of the permuted message
+  for (octave_idx_type u = 0; u < nsteps; u++)
+    {
+      ls[u] = c[u*m];
+      for (int b = 0; b < n; b++)
+        lc1[u*n+b] = c[u*m+b];
+    }
+  for (octave_idx_type u = 0; u < nsteps; u++)
+    {
+      lc2[u*n] = ls[perm[u]];
+      for (int b = 1; b < n; b++)
+        lc2[u*n+b] = c[u*m+n+b-1];
+    }
+
+  float s = opt.scaling;
+  int it;
+  for (it = 1; it <= opt.maxiter; it++)
+    {
+      dec.decode (lc1.data (), la.data (), nsteps, app1.data (), 0);
+      for (octave_idx_type u = 0; u < nsteps; u++)
+        le[u] = s * (app1[u] - la[u] - ls[u]);
+      for (octave_idx_type u = 0; u < nsteps; u++)
+        la[u] = le[perm[u]];
+
+      dec.decode (lc2.data (), la.data (), nsteps, app2.data (), 0);
+      for (octave_idx_type u = 0; u < nsteps; u++)
+        le[u] = s * (app2[u] - la[u] - ls[perm[u]]);
+
+      // The extrinsic ratios of the second decoder are the a priori
+      // ratios of the first one in the next iteration, and the decoding
+      // stops when both decoders agree on the message
+      bool agree = true;
+      for (octave_idx_type u = 0; u < nsteps; u++)
+        {
+          la[perm[u]] = le[u];
+          app[perm[u]] = app2[u];
+          agree = agree && ((app2[u] < 0) == (app1[perm[u]] < 0));
+        }
+
+      if (opt.early && agree)
+        break;
+    }
+
+  return std::min (it, opt.maxiter);
+}
+
+DEFUN_DLD (turbodec, args, nargout,
+  "-*- texinfo -*-\n\
+@deftypefn  {Loadable Function} {@var{msg} =} turbodec (@var{llr}, @var{t}, @var{perm})\n\
+@deftypefnx {Loadable Function} {@var{msg} =} turbodec (@var{llr}, @var{t}, @var{perm}, @var{prop}, @var{val}, @dots{})\n\
+@deftypefnx {Loadable Function} {[@var{msg}, @var{lu}, @var{niter}] =} turbodec (@dots{})\n\
+Decode the frames in the rows of @var{llr} of a turbo code, the\n\
+parallel concatenation of two encoders of the systematic rate 1/n code\n\
+of the trellis structure @var{t}, the first one encoding the message and\n\
+the second one the message interleaved with the permutation @var{perm},\n\
+as by @code{intrlv}, such as @code{poly2trellis (4, [13 15], 13)} for\n\
+LTE. Both encoders start in the all-zeros state, and are not\n\
+terminated.\n\
+\n\
+The elements of @var{llr} are the log-likelihood ratios log (P(0) /\n\
+P(1)) of the encoded bits, 2@math{n}-1 for each message bit: the\n\
+@math{n} output bits of the first encoder followed by the @math{n}-1\n\
+parity bits of the second. For example,\n\
+\n\
+@example\n\
+@group\n\
+c1 = reshape (convenc (msg, t), 2, []);\n\
+c2 = reshape (convenc (intrlv (msg, perm), t), 2, []);\n\
+code = [c1; c2(2,:)](:)';\n\
+@end group\n\
+@end example\n\
+\n\
+The decoded messages are returned in the rows of @var{msg}, their a\n\
+posteriori log-likelihood ratios in @var{lu}, and the number of\n\
+iterations used for each frame in the column vector @var{niter}. The\n\
+constituent decoders are those of @code{bcjrdec}, and the properties are\n\
+\n\
+@table @asis\n\
+@item \"algorithm\"\n\
+\"max-log\", the default, or \"log-map\", as for @code{bcjrdec}.\n\
+@item \"scaling\"\n\
+The factor of the extrinsic ratios passed between the decoders, by\n\
+default 0.75 for max-log and 1 for log-MAP.\n\
+@item \"maxiter\"\n\
+The maximum number of iterations, by default 8.\n\
+@item \"termination\"\n\
+\"early\", the default, stops decoding a frame as soon as the decisions\n\
+of both decoders agree, and \"max\" always does \"maxiter\" iterations.\n\
+@item \"window\"\n\
+The window of the decoders, as for @code{bcjrdec}.\n\
+@end table\n\
+@seealso{bcjrdec, intrlv, randintrlv}\n\
+@end deftypefn")
+{
+  octave_value_list retval;
+  int nargin = args.length ();
+
+  if (nargin < 3 || (nargin % 2) == 0)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  conv_trellis t;
+  if (! get_trellis (args(1), "turbodec", t))
+    return retval;
+
+  if (! turbo_systematic (t))
+    {
+      error ("turbodec: T must be a systematic code of rate 1/n");
+      return retval;
+    }
+
+  bcjr_options opt;
+  if (! bcjr_get_options (args, 3, true, "turbodec", opt))
+    return retval;
+
+  Matrix llr = args(0).matrix_value ();
+  int n = t.n;
+  int m = 2*n - 1;
+  octave_idx_type nframes = llr.rows ();
+  octave_idx_type nsteps = llr.columns () / m;
+  if (llr.columns () % m != 0)
+    {
+      error ("turbodec: the number of columns of LLR must be a multiple of %d",
+             m);
+      return retval;
+    }
+
+  Matrix p = args(2).matrix_value ();
+  std::vector<int> perm (nsteps);
+  std::vector<bool> seen (nsteps, false);
+  bool ok = (p.numel () == nsteps);
+  for (octave_idx_type i = 0; ok && (i < nsteps); i++)
+    {
+      double x = p(i);
+      ok = (x >= 1 && x <= nsteps && x == std::floor (x)
+            && ! seen[(size_t)x-1]);
+      if (ok)
+        {
+          perm[i] = (int)x - 1;
+          seen[(size_t)x-1] = true;
+        }
+    }
+  if (! ok)
+    {
+      error ("turbodec: PERM must be a permutation of 1 to %d", nsteps);
+      return retval;
+    }
+
+  Matrix msg (nframes, nsteps);
+  Matrix lu (nframes, nsteps);
+  ColumnVector niter (nframes);
+
+  double *pmsg = msg.fortran_vec ();
+  double *plu = lu.fortran_vec ();
+  double *pniter = niter.fortran_vec ();
+  const double *pllr = llr.data ();
+
+  bcjr dec (t, opt.alg, false, opt.window);
+  parallel_for (nframes, parallel_threads (), [&] (int f)
+    {
+      std::vector<float> c (nsteps * m);
+      std::vector<float> app (nsteps);
+
+      bcjr_get_row (pllr, nframes, f, nsteps * m, c.data ());
+      pniter[f] = turbo_decode (dec, n, perm, opt, c.data (), nsteps,
+                                app.data ());
+      bcjr_put_row (app.data (), nframes, f, nsteps, plu);
+      for (octave_idx_type u = 0; u < nsteps; u++)
+        pmsg[f + u*nframes] = (app[u] < 0);
+    });
+
+  if (nargout > 2)
+    retval(2) = octave_value (niter);
+  if (nargout > 1)
+    retval(1) = octave_value (lu);
+  retval(0) = octave_value (msg);
+  return retval;
+}
+
+/*
+%!shared t
+%! ## The recursive systematic code of LTE
+%! t = poly2trellis (4, [13 15], 13);
+
+%!test
+%! msg = randi ([0 1], 3, 400);
+%! perm = randperm (400);
+%! llr = zeros (3, 1200);
+%! for f = 1:3
+%!   c1 = reshape (convenc (msg(f,:), t), 2, []);
+%!   c2 = reshape (convenc (intrlv (msg(f,:), perm), t), 2, []);
+%!   llr(f,:) = 2 * (1 - 2 * [c1; c2(2,:)](:)');
+%! endfor
+%! e = randperm (1200, 40);
+%! llr(:,e) = -llr(:,e);
+%! [dec, lu, niter] = turbodec (llr, t, perm);
+%! assert (dec, msg)
+%! assert (double (lu < 0), msg)
+%! assert (all (niter >= 1 & niter <= 8))
+%! assert (turbodec (llr, t, perm, "algorithm", "log-map"), msg)
+%! [~, ~, niter] = turbodec (llr, t, perm, "termination", "max", "maxiter", 3);
+%! assert (niter, [3; 3; 3])
+
+%% Test input validation
+%!error turbodec ()
+%!error turbodec (1, t)
+%!error <systematic> turbodec (zeros (1, 9), poly2trellis (3, [7 5]), 1:3)
+%!error <multiple of 3> turbodec (zeros (1, 8), t, 1:3)
+%!error <PERM> turbodec (zeros (1, 9), t, [1 1 2])
+%!error <scaling> turbodec (zeros (1, 9), t, 1:3, "scaling", 2)
+%!error <termination> turbodec (zeros (1, 9), t, 1:3, "termination", "term")
+*/
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
@@ -0,0 +1,121 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+#if !defined (octave_bitpack_h)
+#define octave_bitpack_h 1
+
+#include <stdint.h>
+
+// Binary vectors packed 64 bits per word, bit i of the vector being bit
+// i%64 of word i/64. The unused bits of the last word are kept zero.
+typedef uint64_t bitpack_word;
+
+#define BITPACK_WORDS(N)  (((N) + 63) >> 6)
+
+static inline int
+bitpack_popcount (bitpack_word x)
+{
+#if defined (__GNUC__)
+  return __builtin_popcountll (x);
+#else
+  x = x - ((x >> 1) & 0x5555555555555555ULL);
+  x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+  x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+  return (int)((x * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+static inline int
+bitpack_weight (const bitpack_word *a, int nw)
+{
+  int w = 0;
+  for (int i = 0; i < nw; i++)
+    w += bitpack_popcount (a[i]);
+  return w;
+}
+
+// Parity of the inner product of a and b over GF(2)
+static inline int
+bitpack_dot (const bitpack_word *a, const bitpack_word *b, int nw)
+{
+  bitpack_word r = 0;
+  for (int i = 0; i < nw; i++)
+    r ^= a[i] & b[i];
+  return (bitpack_popcount (r) & 1);
+}
+
+static inline void
+bitpack_clear (bitpack_word *a, int nw)
+{
+  for (int i = 0; i < nw; i++)
+    a[i] = 0;
+}
+
+static inline void
+bitpack_xor (bitpack_word *a, const bitpack_word *b, int nw)
+{
+  for (int i = 0; i < nw; i++)
+    a[i] ^= b[i];
+}
+
+static inline void
+bitpack_set (bitpack_word *a, int i)
+{
+  a[i >> 6] |= (bitpack_word)1 << (i & 63);
+}
+
+static inline void
+bitpack_flip (bitpack_word *a, int i)
+{
+  a[i >> 6] ^= (bitpack_word)1 << (i & 63);
+}
+
+static inline int
+bitpack_get (const bitpack_word *a, int i)
+{
+  return ((a[i >> 6] >> (i & 63)) & 1);
+}
+
+// Pack row r of the n column matrix m, any non-zero element being a one
+template <typename MT>
+static inline void
+bitpack_row (bitpack_word *a, const MT& m, int r, int n)
+{
+  bitpack_clear (a, BITPACK_WORDS (n));
+  for (int j = 0; j < n; j++)
+    if (m(r, j) != 0)
+      bitpack_set (a, j);
+}
+
+template <typename MT>
+static inline void
+bitpack_unpack_row (MT& m, int r, const bitpack_word *a, int n)
+{
+  for (int j = 0; j < n; j++)
+    m(r, j) = bitpack_get (a, j);
+}
+
+#endif
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
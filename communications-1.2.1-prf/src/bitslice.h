@@ -0,0 +1,124 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+#if !defined (octave_bitslice_h)
+#define octave_bitslice_h 1
+
+#include <stdint.h>
+
+// A bit plane holds the same bit of __OCTAVE_BITSLICE_LANES independent
+// codewords, one codeword per bit, so that a single boolean operation on
+// two planes acts on all of them. The planes are __OCTAVE_BITSLICE_WORDS
+// 64-bit words long, which the compiler can map to SIMD registers.
+#define __OCTAVE_BITSLICE_WORDS  4
+#define __OCTAVE_BITSLICE_LANES  (64 * __OCTAVE_BITSLICE_WORDS)
+
+typedef uint64_t bitslice_word;
+
+static inline void
+bitslice_clear (bitslice_word *a)
+{
+  for (int w = 0; w < __OCTAVE_BITSLICE_WORDS; w++)
+    a[w] = 0;
+}
+
+static inline void
+bitslice_copy (bitslice_word *a, const bitslice_word *b)
+{
+  for (int w = 0; w < __OCTAVE_BITSLICE_WORDS; w++)
+    a[w] = b[w];
+}
+
+static inline void
+bitslice_xor (bitslice_word *a, const bitslice_word *b)
+{
+  for (int w = 0; w < __OCTAVE_BITSLICE_WORDS; w++)
+    a[w] ^= b[w];
+}
+
+static inline void
+bitslice_or (bitslice_word *a, const bitslice_word *b)
+{
+  for (int w = 0; w < __OCTAVE_BITSLICE_WORDS; w++)
+    a[w] |= b[w];
+}
+
+static inline void
+bitslice_and (bitslice_word *a, const bitslice_word *b)
+{
+  for (int w = 0; w < __OCTAVE_BITSLICE_WORDS; w++)
+    a[w] &= b[w];
+}
+
+static inline void
+bitslice_andnot (bitslice_word *a, const bitslice_word *b)
+{
+  for (int w = 0; w < __OCTAVE_BITSLICE_WORDS; w++)
+    a[w] &= ~b[w];
+}
+
+static inline bool
+bitslice_any (const bitslice_word *a)
+{
+  bitslice_word r = 0;
+  for (int w = 0; w < __OCTAVE_BITSLICE_WORDS; w++)
+    r |= a[w];
+  return (r != 0);
+}
+
+static inline void
+bitslice_set_lane (bitslice_word *a, int lane)
+{
+  a[lane >> 6] |= (bitslice_word)1 << (lane & 63);
+}
+
+static inline bool
+bitslice_lane (const bitslice_word *a, int lane)
+{
+  return ((a[lane >> 6] >> (lane & 63)) & 1);
+}
+
+// Multiply the m planes x of a GF(2^m) element by a constant, y = c * x.
+// As this is linear over GF(2), it is given by the images cols[b] of the
+// basis elements 2^b, and costs at most m*m plane operations. y and x must
+// not overlap
+static inline void
+bitslice_gf_mul_const (bitslice_word *y, const bitslice_word *x,
+                       const int *cols, int m)
+{
+  for (int o = 0; o < m; o++)
+    bitslice_clear (y + o * __OCTAVE_BITSLICE_WORDS);
+
+  for (int b = 0; b < m; b++)
+    {
+      const bitslice_word *xb = x + b * __OCTAVE_BITSLICE_WORDS;
+      for (int o = 0; o < m; o++)
+        if (cols[b] & (1<<o))
+          bitslice_xor (y + o * __OCTAVE_BITSLICE_WORDS, xb);
+    }
+}
+
+#endif
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
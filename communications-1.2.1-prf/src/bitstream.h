@@ -0,0 +1,393 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+
+#if !defined (octave_bitstream_h)
+#define octave_bitstream_h 1
+
+#include <stdint.h>
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <octave/oct.h>
+#include <octave/Cell.h>
+#include <octave/uint8NDArray.h>
+
+// Streams of bits packed in 64-bit words, most significant bit first:
+// bit i of the stream is bit 63-i%64 of word i/64. A stream packed in a
+// uint8 vector has the same order, its first bit being the most
+// significant bit of its first element
+
+// The formats of the streams written by the encoders: a cell array of
+// the codewords of each symbol as double row vectors, a double or a
+// logical row vector of one bit per element, or a uint8 row vector of
+// packed bits, the last one padded with zeros
+enum bitstream_format
+{
+  BITSTREAM_CELL=0,
+  BITSTREAM_DENSE,
+  BITSTREAM_LOGICAL,
+  BITSTREAM_PACKED
+};
+
+// The number of leading zeros of x, which must not be 0
+static inline int
+bitstream_clz (uint64_t x)
+{
+#if defined (__GNUC__)
+  return __builtin_clzll (x);
+#else
+  int n = 0;
+  for (; ! (x >> 63); x <<= 1)
+    n++;
+  return n;
+#endif
+}
+
+// Return the w bits of the words a from the bit pos, most significant
+// first, with 1 <= w <= 64. The word after the one holding bit pos must
+// exist
+static inline uint64_t
+bitstream_peek (const uint64_t *a, uint64_t pos, int w)
+{
+  int sh = pos & 63;
+  uint64_t x = a[pos >> 6] << sh;
+  if (sh)
+    x |= a[(pos >> 6) + 1] >> (64 - sh);
+  return x >> (64 - w);
+}
+
+// Read the name arg of a format for fcn, that may be "cell" if cell is
+// true
+static bool
+bitstream_get_format (const octave_value& arg, const char *fcn, bool cell,
+                      bitstream_format& fmt)
+{
+  std::string s = (arg.is_string () ? arg.string_value () : "");
+  if (s == "cell" && cell)
+    fmt = BITSTREAM_CELL;
+  else if (s == "dense")
+    fmt = BITSTREAM_DENSE;
+  else if (s == "logical")
+    fmt = BITSTREAM_LOGICAL;
+  else if (s == "packed")
+    fmt = BITSTREAM_PACKED;
+  else
+    {
+      if (cell)
+        error ("%s: FORMAT must be 'cell', 'dense', 'logical' or 'packed'",
+               fcn);
+      else
+        error ("%s: FORMAT must be 'dense', 'logical' or 'packed'", fcn);
+      return false;
+    }
+  return true;
+}
+
+// A stream written a codeword at a time, the bits being gathered in a
+// word before being stored
+class bitstream_writer
+{
+public:
+
+  // The writer keeps the starts of the codewords for the cell format if
+  // cells is true
+  bitstream_writer (bool _cells = false)
+    : acc (0), nacc (0), nbits (0), cells (_cells) { }
+
+  // Write the nb low bits of v, most significant first, with
+  // 0 <= nb <= 64
+  void put (uint64_t v, int nb)
+  {
+    if (nb == 0)
+      return;
+    if (nb < 64)
+      v &= ((uint64_t)1 << nb) - 1;
+    nbits += nb;
+
+    if (nacc + nb < 64)
+      {
+        acc |= v << (64 - nacc - nb);
+        nacc += nb;
+      }
+    else
+      {
+        int rest = nacc + nb - 64;
+        words.push_back (acc | (v >> rest));
+        acc = (rest ? v << (64 - rest) : 0);
+        nacc = rest;
+      }
+  }
+
+  // Write count ones
+  void put_ones (uint64_t count)
+  {
+    for (; count >= 64; count -= 64)
+      put (~(uint64_t)0, 64);
+    put (((uint64_t)1 << count) - 1, count);
+  }
+
+  // Start a codeword, for the cell format
+  void mark (void)
+  {
+    if (cells)
+      starts.push_back (nbits);
+  }
+
+  uint64_t size (void) const { return nbits; }
+
+  // The words of the stream, followed by two zero words
+  void words_value (std::vector<uint64_t>& a) const
+  {
+    a = words;
+    a.push_back (acc);
+    a.push_back (0);
+    if (nacc > 0)
+      a.push_back (0);
+  }
+
+  // The stream in the format fmt, with the codewords started by mark for
+  // the cell format
+  octave_value value (bitstream_format fmt) const
+  {
+    octave_value retval;
+
+    switch (fmt)
+      {
+      case BITSTREAM_CELL:
+        {
+          octave_idx_type n = starts.size ();
+          Cell c (1, n);
+          for (octave_idx_type k = 0; k < n; k++)
+            {
+              uint64_t end = (k + 1 < n ? starts[k+1] : nbits);
+              Matrix w (1, end - starts[k]);
+              for (uint64_t i = starts[k]; i < end; i++)
+                w(i - starts[k]) = bit (i);
+              c(k) = w;
+            }
+          retval = octave_value (c);
+        }
+        break;
+      case BITSTREAM_LOGICAL:
+        {
+          boolMatrix y (dim_vector (1, nbits));
+          for (uint64_t i = 0; i < nbits; i++)
+            y(i) = bit (i);
+          retval = octave_value (y);
+        }
+        break;
+      case BITSTREAM_PACKED:
+        {
+          uint64_t nbytes = (nbits + 7) / 8;
+          uint8NDArray y (dim_vector (1, nbytes));
+          for (uint64_t j = 0; j < nbytes; j++)
+            {
+              uint64_t w = ((j >> 3) < words.size () ? words[j >> 3] : acc);
+              y(j) = (uint8_t)(w >> (56 - 8 * (j & 7)));
+            }
+          retval = octave_value (y);
+        }
+        break;
+      default:
+        {
+          Matrix y (1, nbits);
+          for (uint64_t i = 0; i < nbits; i++)
+            y(i) = bit (i);
+          retval = octave_value (y);
+        }
+        break;
+      }
+
+    return retval;
+  }
+
+private:
+
+  int bit (uint64_t i) const
+  {
+    uint64_t w = ((i >> 6) < words.size () ? words[i >> 6] : acc);
+    return (w >> (63 - (i & 63))) & 1;
+  }
+
+  std::vector<uint64_t> words;
+  uint64_t acc;
+  int nacc;
+  uint64_t nbits;
+  bool cells;
+  std::vector<uint64_t> starts;
+};
+
+// A stream read from words that are zero after its nbits bits, with two
+// words after the last bit
+class bitstream_reader
+{
+public:
+
+  bitstream_reader (const std::vector<uint64_t>& _a, uint64_t _nbits)
+    : a (&_a[0]), nbits (_nbits), pos (0) { }
+
+  uint64_t position (void) const { return pos; }
+
+  uint64_t left (void) const { return nbits - pos; }
+
+  // Read nb bits into v, with 0 <= nb <= 64. Returns false, reading
+  // nothing, if fewer bits are left
+  bool get (int nb, uint64_t& v)
+  {
+    if ((uint64_t)nb > nbits - pos)
+      return false;
+    v = (nb > 0 ? bitstream_peek (a, pos, nb) : 0);
+    pos += nb;
+    return true;
+  }
+
+  // Read the ones before the next zero into count, and the zero. Returns
+  // false if the stream ends before the zero
+  bool get_unary (uint64_t& count)
+  {
+    uint64_t c = 0;
+    while (pos < nbits)
+      {
+        uint64_t x = ~bitstream_peek (a, pos, 64);
+        if (x)
+          {
+            int z = bitstream_clz (x);
+            pos += z + 1;
+            count = c + z;
+            return (pos <= nbits);
+          }
+        c += 64;
+        pos += 64;
+      }
+    return false;
+  }
+
+private:
+
+  const uint64_t *a;
+  uint64_t nbits;
+  uint64_t pos;
+};
+
+// Read the stream arg of fcn, called name in the errors, into the words
+// a followed by two zero words: a binary vector, or a uint8 vector of
+// packed bits of which the first nb ones are read, or all of them if nb
+// is negative
+static bool
+bitstream_load (const octave_value& arg, double nb, const char *fcn,
+                const char *name, std::vector<uint64_t>& a, uint64_t& nbits)
+{
+  if (arg.is_uint8_type ())
+    {
+      uint8NDArray h = arg.uint8_array_value ();
+      if (! (h.rows () == 1 || h.columns () == 1 || h.numel () == 0))
+        {
+          error ("%s: %s must be a binary vector", fcn, name);
+          return false;
+        }
+
+      nbits = 8 * (uint64_t)h.numel ();
+      if (nb >= 0)
+        {
+          if (! (nb <= nbits && nb == std::floor (nb)))
+            {
+              error ("%s: NBITS must be an integer from 0 to %g", fcn,
+                     (double)nbits);
+              return false;
+            }
+          nbits = (uint64_t)nb;
+        }
+
+      a.assign (nbits / 64 + 2, 0);
+      for (uint64_t i = 0; i < (nbits + 7) / 8; i++)
+        a[i >> 3] |= (uint64_t)h(i).value () << (56 - 8 * (i & 7));
+      if (nbits & 63)
+        a[nbits >> 6] &= ~(uint64_t)0 << (64 - (nbits & 63));
+    }
+  else
+    {
+      if (nb >= 0)
+        {
+          error ("%s: NBITS is only valid with a uint8 %s", fcn, name);
+          return false;
+        }
+
+      Matrix h;
+      if (! arg.is_string () && ! arg.is_cell ())
+        h = arg.matrix_value ();
+      bool ok = (! arg.is_string () && ! arg.is_cell ()
+                 && (h.rows () == 1 || h.columns () == 1 || h.numel () == 0));
+      nbits = h.numel ();
+      a.assign (nbits / 64 + 2, 0);
+      for (octave_idx_type i = 0; ok && (i < h.numel ()); i++)
+        {
+          ok = (h(i) == 0 || h(i) == 1);
+          a[i >> 6] |= (uint64_t)(h(i) != 0) << (63 - (i & 63));
+        }
+      if (! ok)
+        {
+          error ("%s: %s must be a binary vector", fcn, name);
+          return false;
+        }
+    }
+
+  return true;
+}
+
+// Read the cell array arg of binary vectors of fcn, called name in the
+// errors, as the stream of their bits, the codeword k starting at the
+// bit starts[k]
+static bool
+bitstream_load_cell (const octave_value& arg, const char *fcn,
+                     const char *name, std::vector<uint64_t>& a,
+                     uint64_t& nbits, std::vector<uint64_t>& starts)
+{
+  Cell c = arg.cell_value ();
+  bitstream_writer w;
+  starts.resize (c.numel ());
+  for (octave_idx_type k = 0; k < c.numel (); k++)
+    {
+      starts[k] = w.size ();
+      Matrix x = c(k).matrix_value ();
+      for (octave_idx_type i = 0; i < x.numel (); i++)
+        {
+          if (! (x(i) == 0 || x(i) == 1))
+            {
+              error ("%s: %s must hold binary vectors", fcn, name);
+              return false;
+            }
+          w.put (x(i) != 0, 1);
+        }
+    }
+  nbits = w.size ();
+  w.words_value (a);
+  return true;
+}
+
+#endif
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
@@ -0,0 +1,440 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+#include <octave/oct.h>
+#include <octave/oct-locbuf.h>
+#include <octave/oct-map.h>
+#include <octave/uint64NDArray.h>
+
+#include "bitpack.h"
+#include "syndrome.h"
+
+// PKG_ADD: autoload ("blkencode", "blkcode.oct");
+// PKG_DEL: autoload ("blkencode", "blkcode.oct", "remove");
+// PKG_ADD: autoload ("blkdecode", "blkcode.oct");
+// PKG_DEL: autoload ("blkdecode", "blkcode.oct", "remove");
+
+static bool
+is_binary_matrix (const Matrix& a)
+{
+  for (octave_idx_type i = 0; i < a.numel (); i++)
+    if ((a(i) != 0) && (a(i) != 1))
+      return false;
+  return true;
+}
+
+// The offset of the identity in a generator matrix in the standard form
+// [eye(k) P], 0, or [P eye(k)], n-k. Returns -1 otherwise
+static int
+standard_form_offset (const Matrix& gen, int k, int n)
+{
+  for (int off = 0; off <= n - k; off += (n - k > 0 ? n - k : 1))
+    {
+      bool ident = true;
+      for (int i = 0; ident && (i < k); i++)
+        for (int j = 0; j < k; j++)
+          if (gen(i, off+j) != (i == j ? 1 : 0))
+            {
+              ident = false;
+              break;
+            }
+      if (ident)
+        return off;
+    }
+  return -1;
+}
+
+// The rows of the k by n generator matrix gen, one packed row per column
+static uint64NDArray
+pack_rows (const Matrix& gen, int k, int n)
+{
+  int nw = BITPACK_WORDS (n);
+  uint64NDArray pgen (dim_vector (nw, k), octave_uint64 (0));
+  bitpack_word *g = reinterpret_cast<bitpack_word *> (pgen.fortran_vec ());
+  for (int i = 0; i < k; i++)
+    bitpack_row (g + i * nw, gen, i, n);
+  return pgen;
+}
+
+// The fields of a handle returned by blkcode, with their sizes checked
+// so that the kernels can index the packed data freely
+static bool
+get_blkcode (const octave_value& arg, const char *fcn, int& n, int& k,
+             int& sys, uint64NDArray& gen, uint64NDArray& par,
+             uint64NDArray& table)
+{
+  if (! arg.is_map ())
+    {
+      error ("%s: BLK must be a block code returned by blkcode", fcn);
+      return false;
+    }
+
+  octave_scalar_map blk = arg.scalar_map_value ();
+  if (! (blk.isfield ("n") && blk.isfield ("k") && blk.isfield ("sys")
+         && blk.isfield ("gen") && blk.isfield ("par")
+         && blk.isfield ("table")))
+    {
+      error ("%s: BLK must be a block code returned by blkcode", fcn);
+      return false;
+    }
+
+  n = blk.getfield ("n").int_value ();
+  k = blk.getfield ("k").int_value ();
+  sys = blk.getfield ("sys").int_value ();
+  gen = blk.getfield ("gen").uint64_array_value ();
+  par = blk.getfield ("par").uint64_array_value ();
+  table = blk.getfield ("table").uint64_array_value ();
+
+  int m = n - k;
+  int nw = BITPACK_WORDS (n);
+  if ((k < 0) || (m < 0) || ((sys != -1) && (sys != 0) && (sys != m))
+      || (gen.rows () != nw) || (gen.columns () != k)
+      || ((par.numel () != 0)
+          && ((m > (int)(sizeof (int) << 3) - 1) || (par.rows () != nw)
+              || (par.columns () != m) || (table.rows () != nw)
+              || (table.columns () != ((octave_idx_type)1 << m)))))
+    {
+      error ("%s: BLK is not a valid block code", fcn);
+      return false;
+    }
+
+  return true;
+}
+
+DEFUN_DLD (blkcode, args, ,
+  "-*- texinfo -*-\n\
+@deftypefn  {Loadable Function} {@var{blk} =} blkcode (@var{gen})\n\
+@deftypefnx {Loadable Function} {@var{blk} =} blkcode (@var{gen}, @var{par})\n\
+Prepare the binary linear block code with the generator matrix @var{gen}\n\
+for @code{blkencode} and @code{blkdecode}. The rows of @var{gen}, the\n\
+rows of the parity check matrix and the coset leaders of the syndrome\n\
+table are bit-packed once in the returned structure @var{blk}, that can\n\
+then be used for any number of codewords.\n\
+\n\
+If the parity check matrix @var{par} is not given, @var{gen} must be in\n\
+the standard form [eye(k) P] or [P eye(k)] and the parity check matrix\n\
+is the one returned by @code{gen2par}. A generator matrix that is not in\n\
+standard form can only be used to encode.\n\
+@seealso{blkencode, blkdecode, encode, decode, syndtable}\n\
+@end deftypefn")
+{
+  octave_value retval;
+  int nargin = args.length ();
+
+  if (nargin < 1 || nargin > 2)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  Matrix gen = args(0).matrix_value ();
+  int k = gen.rows ();
+  int n = gen.columns ();
+  int m = n - k;
+  int nw = BITPACK_WORDS (n);
+
+  if ((k == 0) || (m < 0) || ! is_binary_matrix (gen))
+    {
+      error ("blkcode: GEN must be a binary generator matrix");
+      return retval;
+    }
+
+  int sys = standard_form_offset (gen, k, n);
+
+  Matrix par;
+  if (nargin > 1)
+    {
+      par = args(1).matrix_value ();
+      if ((par.rows () != m) || (par.columns () != n)
+          || ! is_binary_matrix (par))
+        {
+          error ("blkcode: PAR must be a binary matrix of size %d by %d", m, n);
+          return retval;
+        }
+    }
+  else if (sys >= 0)
+    {
+      // As gen2par, [eye(k) P] gives [P' eye(n-k)] and [P eye(k)] gives
+      // [eye(n-k) P']
+      int poff = (sys == 0 ? k : 0);
+      int qoff = (sys == 0 ? 0 : m);
+      par = Matrix (m, n, 0.);
+      for (int i = 0; i < m; i++)
+        {
+          par(i, poff + i) = 1;
+          for (int j = 0; j < k; j++)
+            par(i, qoff + j) = gen(j, poff + i);
+        }
+    }
+  bool have_par = (nargin > 1) || (sys >= 0);
+
+  if (have_par && (m > (int)(sizeof (int) << 3) - 1))
+    {
+      error ("blkcode: codeword minus message length must be less than %d",
+             (int)(sizeof (int) << 3));
+      return retval;
+    }
+
+  uint64NDArray pgen = pack_rows (gen, k, n);
+  uint64NDArray ppar;
+  uint64NDArray table;
+  if (have_par)
+    {
+      ppar = pack_rows (par, m, n);
+
+      // The coset leaders, found as in syndtable
+      OCTAVE_LOCAL_BUFFER (unsigned int, col, n);
+      syndrome_columns (col, par, m, n);
+
+      table = uint64NDArray (dim_vector (nw, (octave_idx_type)1 << m),
+                             octave_uint64 (0));
+      bitpack_word *t = reinterpret_cast<bitpack_word *> (table.fortran_vec ());
+      syndrome_coset_leaders (col, n, m,
+        [t, nw] (unsigned int syndrome, const int *pos, int nerrs)
+        {
+          for (int j = 0; j < nerrs; j++)
+            bitpack_set (t + (size_t)syndrome * nw, pos[j]);
+        });
+    }
+
+  octave_scalar_map blk;
+  blk.assign ("n", octave_value (n));
+  blk.assign ("k", octave_value (k));
+  blk.assign ("sys", octave_value (sys));
+  blk.assign ("gen", octave_value (pgen));
+  blk.assign ("par", octave_value (ppar));
+  blk.assign ("table", octave_value (table));
+
+  retval = octave_value (blk);
+  return retval;
+}
+
+DEFUN_DLD (blkencode, args, ,
+  "-*- texinfo -*-\n\
+@deftypefn  {Loadable Function} {@var{code} =} blkencode (@var{blk}, @var{msg})\n\
+@deftypefnx {Loadable Function} {@var{code} =} blkencode (@var{gen}, @var{msg})\n\
+Encode the binary messages in the rows of @var{msg} with the block code\n\
+@var{blk} returned by @code{blkcode}, or directly with the generator\n\
+matrix @var{gen}. This is the same as @code{mod (@var{msg} * @var{gen}, 2)},\n\
+but each codeword is formed by exclusive or of the bit-packed rows of the\n\
+generator matrix. As encoding needs no syndrome table, passing @var{gen}\n\
+avoids building one for a code with many parity bits.\n\
+@seealso{blkcode, blkdecode, encode}\n\
+@end deftypefn")
+{
+  octave_value retval;
+
+  if (args.length () != 2)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  int n, k, sys;
+  uint64NDArray pgen, ppar, table;
+  if (args(0).is_map ())
+    {
+      if (! get_blkcode (args(0), "blkencode", n, k, sys, pgen, ppar, table))
+        return retval;
+    }
+  else
+    {
+      Matrix gen = args(0).matrix_value ();
+      k = gen.rows ();
+      n = gen.columns ();
+      if ((k == 0) || (n < k) || ! is_binary_matrix (gen))
+        {
+          error ("blkencode: GEN must be a binary generator matrix");
+          return retval;
+        }
+
+      pgen = pack_rows (gen, k, n);
+    }
+
+  Matrix msg = args(1).matrix_value ();
+  int nsym = msg.rows ();
+  int nw = BITPACK_WORDS (n);
+
+  if (msg.columns () != k)
+    {
+      error ("blkencode: MSG must be a matrix with %d columns", k);
+      return retval;
+    }
+
+  const bitpack_word *g = reinterpret_cast<const bitpack_word *> (pgen.data ());
+  OCTAVE_LOCAL_BUFFER (bitpack_word, c, nw);
+  Matrix code (nsym, n);
+
+  for (int l = 0; l < nsym; l++)
+    {
+      OCTAVE_QUIT;
+
+      bitpack_clear (c, nw);
+      for (int j = 0; j < k; j++)
+        if (msg(l, j) != 0)
+          bitpack_xor (c, g + j * nw, nw);
+      bitpack_unpack_row (code, l, c, n);
+    }
+
+  retval = octave_value (code);
+  return retval;
+}
+
+DEFUN_DLD (blkdecode, args, nargout,
+  "-*- texinfo -*-\n\
+@deftypefn {Loadable Function} {[@var{msg}, @var{err}, @var{ccode}, @var{cerr}] =} blkdecode (@var{blk}, @var{code})\n\
+Decode the binary codewords in the rows of @var{code} with the block code\n\
+@var{blk} returned by @code{blkcode}. The syndrome of each codeword is\n\
+the parity of its bit-packed product with the rows of the parity check\n\
+matrix, and the coset leader for the syndrome is added to the codeword.\n\
+\n\
+The outputs are the same as for @code{decode} with a binary matrix. The\n\
+decoded messages are returned in @var{msg}, the number of corrected bits\n\
+of each codeword in the column vector @var{err}, and the corrected\n\
+codewords in @var{ccode}. @var{cerr} is the same as @var{err}.\n\
+@seealso{blkcode, blkencode, decode}\n\
+@end deftypefn")
+{
+  octave_value_list retval;
+
+  if (args.length () != 2)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  int n, k, sys;
+  uint64NDArray pgen, ppar, table;
+  if (! get_blkcode (args(0), "blkdecode", n, k, sys, pgen, ppar, table))
+    return retval;
+
+  if (sys < 0)
+    {
+      error ("blkdecode: generator matrix must be in standard form");
+      return retval;
+    }
+
+  if (ppar.numel () == 0 && n > k)
+    {
+      error ("blkdecode: BLK has no parity check matrix");
+      return retval;
+    }
+
+  Matrix code = args(1).matrix_value ();
+  int nsym = code.rows ();
+  int m = n - k;
+  int nw = BITPACK_WORDS (n);
+
+  if (code.columns () != n)
+    {
+      error ("blkdecode: CODE must be a matrix with %d columns", n);
+      return retval;
+    }
+
+  const bitpack_word *h = reinterpret_cast<const bitpack_word *> (ppar.data ());
+  const bitpack_word *t = reinterpret_cast<const bitpack_word *> (table.data ());
+  OCTAVE_LOCAL_BUFFER (bitpack_word, c, nw);
+  Matrix msg (nsym, k);
+  Matrix ccode (nsym, n);
+  ColumnVector err (nsym, 0.);
+
+  for (int l = 0; l < nsym; l++)
+    {
+      OCTAVE_QUIT;
+
+      bitpack_row (c, code, l, n);
+
+      unsigned int syndrome = 0;
+      for (int i = 0; i < m; i++)
+        syndrome |= (unsigned int)bitpack_dot (c, h + i * nw, nw) << (m-i-1);
+
+      if (syndrome != 0)
+        {
+          const bitpack_word *leader = t + (size_t)syndrome * nw;
+          bitpack_xor (c, leader, nw);
+          err(l) = bitpack_weight (leader, nw);
+        }
+
+      bitpack_unpack_row (ccode, l, c, n);
+      for (int j = 0; j < k; j++)
+        msg(l, j) = bitpack_get (c, sys + j);
+    }
+
+  if (nargout > 3)
+    retval(3) = octave_value (err);
+  retval(2) = octave_value (ccode);
+  retval(1) = octave_value (err);
+  retval(0) = octave_value (msg);
+  return retval;
+}
+
+/*
+%% Test input validation
+%!error blkcode ()
+%!error blkcode (1, 2, 3)
+%!error <binary generator matrix> blkcode ([1 2 0])
+%!error <PAR must be> blkcode ([1 0 1], [1 1])
+%!error blkencode ()
+%!error <block code returned by blkcode> blkencode (struct ("n", 3), 2)
+%!error <MSG must be> blkencode ([1 0 1], [1 1])
+%!error <standard form> blkdecode (blkcode ([1 1 0; 0 1 1]), [1 1 0])
+%!test
+%! blk = blkcode ([1 0 1 1; 0 1 0 1]);
+%! blk.sys = 1;
+%! fail ("blkdecode (blk, [1 0 1 1])", "not a valid block code")
+
+%!test
+%! [par, gen] = cyclgen (15, cyclpoly (15, 7));
+%! blk = blkcode (gen);
+%! msg = randi ([0 1], 50, 7);
+%! code = blkencode (blk, msg);
+%! assert (code, mod (msg * gen, 2))
+%! assert (blkencode (gen, msg), code)
+%! noisy = code;
+%! noisy(:, [2, 9]) = ! noisy(:, [2, 9]);
+%! noisy(1:10, 4) = ! noisy(1:10, 4);
+%! [dec, err, ccode, cerr] = blkdecode (blk, noisy);
+%! [c, e] = syndecode (noisy, par, syndtable (par));
+%! assert (ccode, c)
+%! assert (err, e)
+%! assert (cerr, e)
+%! assert (dec, ccode(:, 9:15))
+%! assert (dec(11:50, :), msg(11:50, :))
+
+%!test
+%! ## An extended Hamming code, with codewords of more than 64 bits
+%! [par, gen] = hammgen (7);
+%! gen = gen(57:120, [1:7, 64:127]);
+%! gen = [mod(sum (gen, 2), 2), gen];
+%! blk = blkcode (gen);
+%! msg = randi ([0 1], 100, 64);
+%! code = blkencode (blk, msg);
+%! noisy = code;
+%! noisy(:, 70) = ! noisy(:, 70);
+%! [dec, err] = blkdecode (blk, noisy);
+%! assert (dec, msg)
+%! assert (err, ones (100, 1))
+*/
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
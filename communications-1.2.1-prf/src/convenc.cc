@@ -0,0 +1,296 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+#include <stdint.h>
+
+#include <vector>
+
+#include <octave/oct.h>
+
+#include "trellis.h"
+
+// The output bits of the encoder are written through the puncturing
+// pattern punct of plen bits, used cyclically from the position pi.
+// An empty pattern keeps every bit
+class convenc_output
+{
+public:
+
+  convenc_output (double *_y, const std::vector<bool>& _punct)
+    : y (_y), punct (_punct), plen (_punct.size ()), pi (0) { }
+
+  // Write the nb bits of v, most significant first
+  void put (uint64_t v, int nb)
+  {
+    if (plen == 0)
+      for (int b = nb - 1; b >= 0; b--)
+        *y++ = (v >> b) & 1;
+    else
+      for (int b = nb - 1; b >= 0; b--)
+        {
+          if (punct[pi])
+            *y++ = (v >> b) & 1;
+          if (++pi == plen)
+            pi = 0;
+        }
+  }
+
+private:
+
+  double *y;
+  const std::vector<bool>& punct;
+  size_t plen;
+  size_t pi;
+};
+
+DEFUN_DLD (convenc, args, nargout,
+  "-*- texinfo -*-\n\
+@deftypefn  {Loadable Function} {@var{y} =} convenc (@var{msg}, @var{t})\n\
+@deftypefnx {Loadable Function} {@var{y} =} convenc (@var{msg}, @var{t}, @var{punct})\n\
+@deftypefnx {Loadable Function} {@var{y} =} convenc (@var{msg}, @var{t}, @var{punct}, @var{s0})\n\
+@deftypefnx {Loadable Function} {[@var{y}, @var{state_end}] =} convenc (@dots{})\n\
+Encode the binary vector @var{msg} with the convolutional encoder\n\
+described by the trellis structure @var{t}.\n\
+\n\
+The rate @math{k/n} convolutional encoder encodes @math{k} bits at a\n\
+time from the input vector and produces @math{n} bits at a time into the\n\
+output vector.  The input @var{msg} must have a length that is a multiple\n\
+of @math{k}.\n\
+\n\
+If the binary vector @var{punct} is given and not empty, the output is\n\
+punctured with it: the pattern is repeated over the encoded bits, and\n\
+the bits at its zeros are removed.\n\
+\n\
+If the initial state @var{s0} is specified, it indicates the internal\n\
+state of the encoder when the first @math{k} input bits are fed in.  The\n\
+default value of @var{s0} is 0.\n\
+\n\
+The optional output argument @var{state_end} indicates the internal state\n\
+of the encoder after the last bits are encoded.  This allows the state of\n\
+the encoder to be saved and applied to the next call to @code{convenc} to\n\
+process data in blocks.\n\
+\n\
+The encoder steps through a table of the outputs and next states for\n\
+each state and several input symbols at once, up to 8 input bits.\n\
+@seealso{poly2trellis, vitdec}\n\
+@end deftypefn")
+{
+  octave_value_list retval;
+  int nargin = args.length ();
+
+  if (nargin < 2 || nargin > 4)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  Matrix msg = args(0).matrix_value ();
+  bool isvec = ((msg.rows () == 1 || msg.columns () == 1)
+                && msg.numel () > 0);
+  for (octave_idx_type i = 0; isvec && (i < msg.numel ()); i++)
+    isvec = (msg(i) == 0 || msg(i) == 1);
+  if (! isvec)
+    {
+      error ("convenc: MSG must be a binary vector");
+      return retval;
+    }
+
+  conv_trellis t;
+  if (! get_trellis (args(1), "convenc", t))
+    return retval;
+
+  std::vector<bool> punct;
+  size_t nkeep = 0;
+  if (nargin > 2 && ! args(2).is_empty ())
+    {
+      Matrix p = args(2).matrix_value ();
+      bool ok = (p.rows () == 1 || p.columns () == 1);
+      for (octave_idx_type i = 0; ok && (i < p.numel ()); i++)
+        {
+          ok = (p(i) == 0 || p(i) == 1);
+          punct.push_back (p(i) != 0);
+          nkeep += (p(i) != 0);
+        }
+      if (! ok || nkeep == 0)
+        {
+          error ("convenc: PUNCT must be a binary vector with at least one 1");
+          return retval;
+        }
+    }
+
+  int state = 0;
+  if (nargin > 3)
+    {
+      double s0 = args(3).double_value ();
+      if (! (s0 >= 0 && s0 < t.nstates && s0 == std::floor (s0)))
+        {
+          error ("convenc: S must be an integer in the range [0,T.numStates-1]");
+          return retval;
+        }
+      state = (int)s0;
+    }
+
+  int k = t.k;
+  int n = t.n;
+  octave_idx_type len = msg.numel ();
+  if (len % k != 0)
+    {
+      error ("convenc: length of MSG must be a multiple of k");
+      return retval;
+    }
+
+  octave_idx_type nsym = len / k;
+  octave_idx_type nout = nsym * n;
+  if (! punct.empty ())
+    {
+      size_t plen = punct.size ();
+      octave_idx_type rem = nout % plen;
+      nout = (nout / plen) * nkeep;
+      for (octave_idx_type i = 0; i < rem; i++)
+        nout += punct[i];
+    }
+
+  Matrix y (nout, 1);
+  convenc_output out (y.fortran_vec (), punct);
+  const double *m = msg.data ();
+
+  // Steps of c symbols, of at most 8 input bits together, are looked up
+  // in a table of the next states and of the c*n output bits, when it
+  // has fewer entries than the message has symbols
+  int c = std::max (1, 8 / k);
+  if (c * n > 64)
+    c = 64 / n;
+  bool table = (c > 1 && (double)t.nstates * (1 << (c*k)) <= nsym);
+
+  octave_idx_type u = 0;
+  if (table)
+    {
+      int nin = 1 << (c*k);
+      std::vector<int> tnext ((size_t)t.nstates * nin);
+      std::vector<uint64_t> tout ((size_t)t.nstates * nin);
+      for (int s = 0; s < t.nstates; s++)
+        for (int x = 0; x < nin; x++)
+          {
+            int st = s;
+            uint64_t o = 0;
+            for (int i = 0; i < c; i++)
+              {
+                int sym = (x >> ((c - i - 1) * k)) & (t.ninputs - 1);
+                o = (o << n) | t.out[st*t.ninputs+sym];
+                st = t.next[st*t.ninputs+sym];
+              }
+            tnext[(size_t)s*nin+x] = st;
+            tout[(size_t)s*nin+x] = o;
+          }
+
+      for (; u + c <= nsym; u += c)
+        {
+          if ((u & 0xffff) == 0)
+            OCTAVE_QUIT;
+
+          int x = 0;
+          for (int i = 0; i < c*k; i++)
+            x = (x << 1) | (m[u*k+i] != 0);
+          size_t e = (size_t)state*nin + x;
+          out.put (tout[e], c*n);
+          state = tnext[e];
+        }
+    }
+
+  for (; u < nsym; u++)
+    {
+      int sym = 0;
+      for (int i = 0; i < k; i++)
+        sym = (sym << 1) | (m[u*k+i] != 0);
+      out.put (t.out[state*t.ninputs+sym], n);
+      state = t.next[state*t.ninputs+sym];
+    }
+
+  if (nargout > 1)
+    retval(1) = octave_value (state);
+
+  if (msg.columns () == 1)
+    retval(0) = octave_value (y);
+  else
+    retval(0) = octave_value (y.transpose ());
+
+  return retval;
+}
+
+/*
+%!test
+%! t = poly2trellis (1, 1);
+%! m = randi ([0 1], 128, 1);
+%! [y, s] = convenc (m, t);
+%! assert (y, m)
+%! assert (s, 0)
+%!test
+%! t = poly2trellis (3, [7 5]);
+%! m = [1 1 0 1 1 1 0 0 1 0 0 0];
+%! y = [1 1 0 1 0 1 0 0 0 1 1 0 0 1 1 1 1 1 1 0 1 1 0 0];
+%! assert (convenc (m, t), y)
+
+%!test
+%! ## Long messages are encoded with the table of 8 input bits, and
+%! ## blocks with the carried state give the same output
+%! t = poly2trellis (7, [171 133]);
+%! m = randi ([0 1], 1, 20001);
+%! [y, s] = convenc (m, t);
+%! [y1, s1] = convenc (m(1:999), t);
+%! [y2, s2] = convenc (m(1000:end), t, [], s1);
+%! assert ([y1 y2], y)
+%! assert (s2, s)
+%! assert (vitdec (y, t, 35, "trunc", "hard"), m)
+
+%!test
+%! ## Puncturing removes the bits at the zeros of the repeated pattern
+%! t = poly2trellis (7, [171 133]);
+%! m = randi ([0 1], 3001, 1);
+%! p = [1 1 0 1 1 0];
+%! y = convenc (m, t);
+%! keep = logical (repmat (p', ceil (numel (y) / 6), 1))(1:numel (y));
+%! assert (convenc (m, t, p), y(keep))
+%! assert (convenc (m, t, []), y)
+
+%!test
+%! t = poly2trellis ([5 4], [23 35 0; 0 5 13]);
+%! m = randi ([0 1], 1, 4000);
+%! [y, s] = convenc (m, t, [1 1 1 0]);
+%! [y1, s1] = convenc (m(1:2), t);
+%! [y2, s2] = convenc (m(3:end), t, [], s1);
+%! assert (y, [y1 y2](logical (repmat ([1 1 1 0], 1, 1500))))
+%! assert (s2, s)
+
+%% Test input validation
+%!error convenc ()
+%!error convenc (1)
+%!error convenc (1, 2)
+%!error convenc (1, 2, 3, 4, 5)
+%!error <binary vector> convenc ([0 2], poly2trellis (3, [7 5]))
+%!error <PUNCT> convenc ([0 1], poly2trellis (3, [7 5]), [0 0])
+%!error <multiple of k> convenc ([0 1 1], poly2trellis ([5 4], [23 35 0; 0 5 13]))
+%!error <range> convenc ([0 1], poly2trellis (3, [7 5]), [], 4)
+*/
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
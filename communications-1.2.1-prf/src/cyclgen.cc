@@ -18,74 +18,69 @@
 // program with any Open Source program, as defined by the Open Source
 // Initiative (www.opensource.org)
 
+#include <cmath>
 #include <string>
+#include <vector>
 
 #include <octave/oct.h>
+#include <octave/uint8NDArray.h>
 
-// A simplified version of the filter function for specific lengths of a and b
-// in the Galois field GF(2)
-Array<int>
-filter_gf2 (const Array<int>& b, const Array<int>& a,
-            const Array<int>& x, const int& n)
+#include "gf2poly.h"
+
+enum cyclgen_format
 {
+  CYCLGEN_DENSE=0,
+  CYCLGEN_LOGICAL,
+  CYCLGEN_PACKED
+};
 
-  int x_len = x.length ();
-  Array<int> si (dim_vector (n, 1), 0);
-  Array<int> y (dim_vector (x_len, 1), 0);
+// The nr by nc binary matrix with the packed rows a, in format fmt
+static octave_value
+cyclgen_matrix (const std::vector<bitpack_word>& a, int nr, int nc,
+                cyclgen_format fmt)
+{
+  int nw = BITPACK_WORDS (nc);
+  octave_value retval;
 
-  for (int i = 0; i < x_len; i++)
+  switch (fmt)
     {
-      y(i) = si(0);
-      if (b(0) && x(i))
-        y(i) ^= 1;
-
-      for (int j = 0; j < n - 1; j++)
-        {
-          si(j) = si(j+1);
-          if (a(j+1) && y(i))
-            si(j) ^= 1;
-          if (b(j+1) && x(i))
-            si(j) ^= 1;
-        }
-      si(n-1) = 0;
-      if (a(n) && y(i))
-        si(n-1) ^= 1;
-      if (b(n) && x(i))
-        si(n-1) ^= 1;
+    case CYCLGEN_LOGICAL:
+      {
+        boolMatrix b (dim_vector (nr, nc), false);
+        for (int i = 0; i < nr; i++)
+          bitpack_unpack_row (b, i, &a[i*nw], nc);
+        retval = octave_value (b);
+      }
+      break;
+    case CYCLGEN_PACKED:
+      {
+        // Row i is column i, eight bits per byte as for syndtable
+        int nbytes = (nc + 7) >> 3;
+        uint8NDArray b (dim_vector (nbytes, nr), octave_uint8 (0));
+        for (int i = 0; i < nr; i++)
+          for (int j = 0; j < nbytes; j++)
+            b(j, i) = octave_uint8 ((a[i*nw+(j>>3)] >> ((j & 7) << 3)) & 0xFF);
+        retval = octave_value (b);
+      }
+      break;
+    default:
+      {
+        Matrix b (nr, nc, 0);
+        for (int i = 0; i < nr; i++)
+          bitpack_unpack_row (b, i, &a[i*nw], nc);
+        retval = octave_value (b);
+      }
+      break;
     }
 
-  return y;
-}
-
-// Cyclic polynomial is irreducible. I.E. it divides into x^n-1
-// without remainder There must surely be an easier way of doing this
-// as the polynomials are over GF(2).
-static bool
-do_is_cyclic_polynomial (const Array<int>& a, const int& n, const int& m)
-{
-  Array<int> y (dim_vector (n+1, 1), 0);
-  Array<int> x (dim_vector (n-m+2, 1), 0);
-  y(0) = 1;
-  y(n) = 1;
-  x(0) = 1;
-
-  Array<int> b = filter_gf2 (y, a, x, n);
-  b.resize (dim_vector (n+1, 1), 0);
-  Array<int> p (dim_vector (m+1, 1), 0);
-  p(0) = 1;
-  Array<int> q = filter_gf2 (a, p, b, m);
-
-  for (int i = 0; i < n+1; i++)
-    if (y(i) ^ q(i))
-      return false;
-
-  return true;
+  return retval;
 }
 
 DEFUN_DLD (cyclgen, args, nargout,
   "-*- texinfo -*-\n\
 @deftypefn  {Loadable Function} {@var{h} =} cyclgen (@var{n}, @var{p})\n\
 @deftypefnx {Loadable Function} {@var{h} =} cyclgen (@var{n}, @var{p}, @var{typ})\n\
+@deftypefnx {Loadable Function} {@var{h} =} cyclgen (@var{n}, @var{p}, @var{typ}, @var{format})\n\
 @deftypefnx {Loadable Function} {[@var{h}, @var{g}] =} cyclgen (@dots{})\n\
 @deftypefnx {Loadable Function} {[@var{h}, @var{g}, @var{k}] =} cyclgen (@dots{})\n\
 Produce the parity check and generator matrix of a cyclic code. The parity\n\
@@ -112,41 +107,53 @@ polynomial.\n\
 \n\
 The form of the parity check matrix is determined by @var{typ}. If\n\
 @var{typ} is 'system', a systematic parity check matrix is produced. If\n\
-@var{typ} is 'nosys' and non-systematic parity check matrix is produced.\n\
+@var{typ} is 'nosys' a non-systematic parity check matrix is produced,\n\
+whose rows are the shifts of the reversed check polynomial\n\
+@code{(x^@var{n} - 1) / @var{p}}. The rows of the matching generator\n\
+matrix are then the shifts of @var{p}.\n\
 \n\
 If requested @code{cyclgen} also returns the @var{k} by @var{n} generator\n\
-matrix @var{g}.\
+matrix @var{g}.\n\
+\n\
+The matrices are returned as double matrices, unless @var{format} is\n\
+'logical', or is 'packed' for uint8 matrices with ceil(@var{n}/8) rows in\n\
+which column @var{i} holds row @var{i} of the matrix, eight bits per\n\
+element as for @code{syndtable}. @var{format} may also be 'dense' for the\n\
+default.\n\
 \n\
 @seealso{hammgen, gen2par, cyclpoly}\n\
 @end deftypefn")
 {
   octave_value_list retval;
   int nargin = args.length ();
-  unsigned long long p = 0;
-  int n, m, k, mm;
+  int n, mm, k;
   bool system = true;
-  Array<int> pp;
+  cyclgen_format fmt = CYCLGEN_DENSE;
+  gf2poly p;
 
-  if (nargin < 2 || nargin > 3)
+  if (nargin < 2 || nargin > 4)
     {
       print_usage ();
       return retval;
     }
 
   n = args(0).int_value ();
-  m = 1;
-  while (n > (1<<(m+1)))
-    m++;
-  pp.resize (dim_vector (n+1, 1), 0);
+  if (n < 1)
+    {
+      error ("cyclgen: n must be 1 or greater");
+      return retval;
+    }
 
   if (args(1).is_scalar_type ())
     {
-      p = (unsigned long long)(args(1).int_value ());
-      mm = 1;
-      while (p > ((unsigned long long)1<<(mm+1)))
-        mm++;
-      for (int i = 0; i < mm+1; i++)
-        pp(i) = (p & (1<<i) ? 1 : 0);
+      // The integer representation is exact up to 2^53
+      double d = args(1).double_value ();
+      if (d < 1 || d >= 9007199254740992. || d != std::floor (d))
+        {
+          error ("cyclgen: illegal generator polynomial");
+          return retval;
+        }
+      p = gf2poly::from_word ((bitpack_word)d);
     }
   else
     {
@@ -157,51 +164,37 @@ matrix @var{g}.\
           return retval;
         }
 
-      if (tmp.rows () == 1)
+      int len = tmp.numel ();
+      for (int i = 0; i < len; i++)
         {
-          mm = tmp.columns ();
-          for (int j = 0; j < mm; j++) {
-            if (tmp(0, j) == 1) {
-              p |= ((unsigned long long)1 << j);
-              pp(j) = 1;
-            }
-            else if (tmp(0, j) != 0) {
+          if (tmp(i) == 1)
+            p.set (i);
+          else if (tmp(i) != 0)
+            {
               error ("cyclgen: illegal generator polynomial");
               return retval;
             }
-          }
         }
-      else
-        {
-          mm = tmp.rows ();
-          for (int i = 0; i < mm; i++)
-            {
-              if (tmp(i, 0) == 1)
-                {
-                  p |= ((unsigned long long)1 << i);
-                  pp(i) = 1;
-                }
-              else if (tmp(i, 0) != 0)
-                {
-                  error ("cyclgen: illegal generator polynomial");
-                  return retval;
-                }
-            }
-        }
-      mm = mm - 1;
     }
+  mm = p.degree ();
   k = n - mm;
 
-  if (nargin > 2)
+  for (int i = 2; i < nargin; i++)
     {
-      if (args(2).is_string ())
+      if (args(i).is_string ())
         {
-          std::string s_arg = args(2).string_value ();
+          std::string s_arg = args(i).string_value ();
 
           if (s_arg == "system")
             system = true;
           else if (s_arg == "nosys")
             system = false;
+          else if (s_arg == "dense")
+            fmt = CYCLGEN_DENSE;
+          else if (s_arg == "logical")
+            fmt = CYCLGEN_LOGICAL;
+          else if (s_arg == "packed")
+            fmt = CYCLGEN_PACKED;
           else
             {
               error ("cyclgen: illegal argument");
@@ -215,50 +208,67 @@ matrix @var{g}.\
         }
     }
 
-  // Haven't implemented this since I'm not sure what matlab wants here
-  if (!system)
-    {
-      error ("cyclgen: non-systematic generator matrices not implemented");
-      return retval;
-    }
+  // The check polynomial h = (x^n-1)/p
+  gf2poly h, rem;
+  gf2poly xn = gf2poly::monomial (n);
+  xn.flip (0);
+  gf2poly::divmod (xn, p, h, rem);
 
-  if (!do_is_cyclic_polynomial (pp, n, mm))
+  if ((mm < 1) || (mm >= n) || ! rem.is_zero ())
     {
       error ("cyclgen: generator polynomial does not produce cyclic code");
       return retval;
     }
 
-  unsigned long long mask = 1;
-  unsigned long long *alpha_to =
-    (unsigned long long *)malloc (sizeof (unsigned long long) * n);
-  for (int i = 0; i < n; i++)
+  int nw = BITPACK_WORDS (n);
+  std::vector<bitpack_word> parity (mm * nw, 0);
+  std::vector<bitpack_word> generator;
+  if (nargout > 1)
+    generator.resize (k * nw, 0);
+
+  if (system)
+    {
+      // Column i of the parity check matrix is x^i modulo p, and row i
+      // of the generator matrix x^(i+m) modulo p followed by the unit
+      // vector in column i+m
+      gf2poly r = gf2poly::monomial (0);
+      for (int i = 0; i < n; i++)
+        {
+          for (int j = 0; j < mm; j++)
+            if (r.coeff (j))
+              bitpack_set (&parity[j*nw], i);
+          if ((i >= mm) && (nargout > 1))
+            {
+              bitpack_word *g = &generator[(i-mm)*nw];
+              for (size_t w = 0; w < r.words ().size (); w++)
+                g[w] = r.words ()[w];
+              bitpack_set (g, i);
+            }
+          r <<= 1;
+          if (r.coeff (mm))
+            r ^= p;
+        }
+    }
+  else
     {
-      alpha_to[i] = mask;
-      mask <<= 1;
-      if (mask & ((unsigned long long)1<<mm))
-        mask ^= p;
+      // Row i of the parity check matrix is x^i times the reversed h,
+      // and row i of the generator matrix x^i times p
+      for (int i = 0; i < mm; i++)
+        for (int j = 0; j <= k; j++)
+          if (h.coeff (k - j))
+            bitpack_set (&parity[i*nw], i + j);
+      if (nargout > 1)
+        for (int i = 0; i < k; i++)
+          for (int j = 0; j <= mm; j++)
+            if (p.coeff (j))
+              bitpack_set (&generator[i*nw], i + j);
     }
 
-  Matrix parity (mm, n, 0);
-  for (int i = 0; i < n; i++)
-    for (int j = 0; j < mm; j++)
-      if (alpha_to[i] & ((unsigned long long)1<<j))
-        parity(j, i) = 1;
-
-  free (alpha_to);
-  retval(0) = octave_value (parity);
+  retval(0) = cyclgen_matrix (parity, mm, n, fmt);
 
   if (nargout > 1)
     {
-      Matrix generator (k, n, 0);
-
-      for (int i = 0; i < (int)k; i++)
-        for (int j = 0; j < (int)mm; j++)
-          generator(i, j) = parity(j, i+mm);
-      for (int i = 0; i < (int)k; i++)
-        generator(i, i+mm) = 1;
-
-      retval(1) = octave_value (generator);
+      retval(1) = cyclgen_matrix (generator, k, n, fmt);
       retval(2) = octave_value ((double)k);
     }
   return retval;
@@ -268,7 +278,44 @@ matrix @var{g}.\
 %% Test input validation
 %!error cyclgen ()
 %!error cyclgen (1)
-%!error cyclgen (1, 2, 3, 4)
+%!error cyclgen (1, 2, 3, 4, 5)
+%!error cyclgen (7, [1 1 0 1], "invalid")
+%!error cyclgen (7, [1 1 1 1])
+%!error cyclgen (7, 2.5)
+
+%!test
+%! h = [1 0 0 1 0 1 1; 0 1 0 1 1 1 0; 0 0 1 0 1 1 1];
+%! [hh, g, k] = cyclgen (7, [1 1 0 1]);
+%! assert (hh, h)
+%! assert (g, [h(:,4:7)', eye(4)])
+%! assert (k, 4)
+%! assert (cyclgen (7, 11), h)
+
+%!test
+%! [h, g] = cyclgen (7, [1 1 0 1], "nosys");
+%! assert (h, [1 0 1 1 1 0 0; 0 1 0 1 1 1 0; 0 0 1 0 1 1 1])
+%! assert (g, toeplitz ([1 0 0 0], [1 1 0 1 0 0 0]))
+
+%!test
+%! [h, g] = cyclgen (15, cyclpoly (15, 7), "logical");
+%! assert (islogical (h) && islogical (g))
+%! [hp, gp] = cyclgen (15, cyclpoly (15, 7), "packed");
+%! assert (class (hp), "uint8")
+%! assert (size (hp), [2, 8])
+%! hz = [h, false(rows (h), 1)];
+%! assert (double (hp), reshape (2.^(0:7) * reshape (hz', 8, []), 2, []))
+%! gz = [g, false(rows (g), 1)];
+%! assert (double (gp), reshape (2.^(0:7) * reshape (gz', 8, []), 2, []))
+
+%!test
+%! ## Generator polynomials of degree above 64
+%! [h, g, k] = cyclgen (255, cyclpoly (255, 171));
+%! assert (size (h), [84, 255])
+%! assert (k, 171)
+%! assert (all (all (mod (g * h', 2) == 0)))
+%! [h, g] = cyclgen (255, cyclpoly (255, 171), "nosys");
+%! assert (all (all (mod (g * h', 2) == 0)))
+%! assert (rank (g), 171)
 */
 
 /*
@@ -18,11 +18,15 @@
 // program with any Open Source program, as defined by the Open Source
 // Initiative (www.opensource.org)
 
+#include <algorithm>
 #include <iostream>
 #include <string>
+#include <vector>
 
 #include <octave/oct.h>
 
+#include "gf2poly.h"
+
 enum cyclic_poly_type
 {
   CYCLIC_POLY_MIN=0,
@@ -31,68 +35,93 @@ enum cyclic_poly_type
   CYCLIC_POLY_L
 };
 
-// A simplified version of the filter function for specific lengths of
-// a and b in the Galois field GF(2)
-Array<int>
-filter_gf2 (const Array<int>& b, const Array<int>& a,
-            const Array<int>& x, const int& n)
+// The irreducible factors of x^n-1 over GF(2), each to be taken up to
+// mult times. With n = 2^e*n1 for an odd n1, x^n-1 is (x^n1-1)^(2^e).
+// The polynomials e(x), sum of x^j for j in a cyclotomic coset of n1,
+// satisfy e(x)^2 = e(x) modulo x^n1-1, and so are 0 or 1 modulo each
+// irreducible factor. As they span all such polynomials, any two
+// factors are separated by one of them, and the gcds of the factors
+// found so far with each e(x) split x^n1-1 into one factor per coset
+static void
+cyclic_factors (std::vector<gf2poly>& fac, int& mult, int n)
 {
+  mult = 1;
+  while (! (n & 1))
+    {
+      n >>= 1;
+      mult <<= 1;
+    }
+
+  std::vector<bool> seen (n, false);
+  std::vector<gf2poly> cosets;
+  for (int s = 0; s < n; s++)
+    if (! seen[s])
+      {
+        gf2poly e;
+        for (int j = s; ! seen[j]; j = (2 * j) % n)
+          {
+            seen[j] = true;
+            e.set (j);
+          }
+        cosets.push_back (e);
+      }
 
-  int x_len = x.length ();
-  Array<int> si (dim_vector (n, 1), 0);
-  Array<int> y (dim_vector (x_len, 1), 0);
+  gf2poly f = gf2poly::monomial (n);
+  f.flip (0);
+  fac.clear ();
+  fac.push_back (f);
 
-  for (int i = 0; i < x_len; i++)
+  for (size_t c = 0; (c < cosets.size ()) && (fac.size () < cosets.size ());
+       c++)
     {
-      y(i) = si(0);
-      if (b(0) && x(i))
-        y(i) ^= 1;
+      OCTAVE_QUIT;
 
-      for (int j = 0; j < n - 1; j++)
+      size_t nf = fac.size ();
+      for (size_t i = 0; i < nf; i++)
         {
-          si(j) = si(j+1);
-          if (a(j+1) && y(i))
-            si(j) ^= 1;
-          if (b(j+1) && x(i))
-            si(j) ^= 1;
+          gf2poly g = gf2poly::gcd (fac[i], cosets[c]);
+          int dg = g.degree ();
+          if ((dg > 0) && (dg < fac[i].degree ()))
+            {
+              fac.push_back (fac[i] / g);
+              fac[i] = g;
+            }
         }
-      si(n-1) = 0;
-      if (a(n) && y(i))
-        si(n-1) ^= 1;
-      if (b(n) && x(i))
-        si(n-1) ^= 1;
+    }
+}
+
+// Walk the products of degree m of the factors t and above, prod being
+// the product of the factors before t. reach[t][d] tells whether the
+// factors t and above have a product of degree d
+template <typename F>
+static void
+cyclic_products (const std::vector<gf2poly>& fac, int mult,
+                 const std::vector<std::vector<bool> >& reach, size_t t,
+                 int m, const gf2poly& prod, F store)
+{
+  OCTAVE_QUIT;
+
+  if (m == 0)
+    {
+      store (prod);
+      return;
     }
 
-  return y;
+  int d = fac[t].degree ();
+  gf2poly p = prod;
+  for (int a = 0; (a <= mult) && (a * d <= m); a++)
+    {
+      if (a > 0)
+        p = p * fac[t];
+      if (reach[t+1][m - a * d])
+        cyclic_products (fac, mult, reach, t + 1, m - a * d, p, store);
+    }
 }
 
-// Cyclic polynomial is irreducible. I.E. it divides into x^n-1
-// without remainder There must surely be an easier way of doing this
-// as the polynomials are over GF(2).
 static bool
-do_is_cyclic_polynomial (const unsigned long long& a1, const int& n,
-                         const int& m)
+cyclic_poly_less (const gf2poly& a, const gf2poly& b)
 {
-  Array<int> a (dim_vector (n+1, 1), 0);
-  Array<int> y (dim_vector (n+1, 1), 0);
-  Array<int> x (dim_vector (n-m+2, 1), 0);
-  y(0) = 1;
-  y(n) = 1;
-  x(0) = 1;
-  for (int i=0; i < m+1; i++)
-    a(i) = (a1 & (1UL <<  i) ? 1 : 0);
-
-  Array<int> b = filter_gf2 (y, a, x, n);
-  b.resize(dim_vector (n+1, 1), 0);
-  Array<int> p (dim_vector (m+1, 1), 0);
-  p(0) = 1;
-  Array<int> q = filter_gf2 (a, p, b, m);
-
-  for (int i=0; i < n+1; i++)
-    if (y(i) ^ q(i))
-      return false;
-
-  return true;
+  return (a.compare (b) < 0);
 }
 
 DEFUN_DLD (cyclpoly, args, nargout,
@@ -128,7 +157,6 @@ is @code{\"polynomial\"}.\n\
   int nargin = args.length ();
   bool polyrep = true;
   enum cyclic_poly_type type = CYCLIC_POLY_MIN;
-  RowVector cyclic_polys;
   int l=0;
 
   if (nargin < 2 || nargin > 4)
@@ -188,63 +216,65 @@ is @code{\"polynomial\"}.\n\
 
   int m = n - k;
 
-  // Matlab code seems to think that 1+x+x^3 is of larger weight than
-  // 1+x^2+x^3. So for matlab compatiability the list of polynomials
-  // should be reversed by replacing "i+=2" with "i-=2" and visa-versa.
-  // Thats not going to happen!!!
+  if (! polyrep && (m > 52))
+    {
+      error ("cyclpoly: integer representation is limited to n-k of 52");
+      return retval;
+    }
+
+  // The generator polynomials are the divisors of x^n-1 of degree m,
+  // formed from its factors instead of testing every polynomial of
+  // degree m. They are returned in increasing order of their integer
+  // representation, with the least-significant term first. Matlab code
+  // seems to think that 1+x+x^3 is of larger weight than 1+x^2+x^3, but
+  // that's not going to happen!!!
+  std::vector<gf2poly> fac;
+  int mult;
+  cyclic_factors (fac, mult, n);
 
-  switch (type)
+  size_t nf = fac.size ();
+  std::vector<std::vector<bool> > reach (nf + 1,
+                                         std::vector<bool> (m + 1, false));
+  reach[nf][0] = true;
+  for (size_t t = nf; t-- > 0; )
     {
-    case CYCLIC_POLY_MIN:
-      cyclic_polys.resize (1);
-      for (unsigned long long i = (1UL<<m)+1; i < (1UL<<(1+m)); i+=2)
-        if (do_is_cyclic_polynomial (i, n, m))
+      int d = fac[t].degree ();
+      for (int s = 0; s <= m; s++)
+        for (int a = 0; (a <= mult) && (a * d <= s); a++)
+          if (reach[t+1][s - a * d])
+            {
+              reach[t][s] = true;
+              break;
+            }
+    }
+
+  std::vector<gf2poly> polys;
+  if (reach[0][m])
+    cyclic_products (fac, mult, reach, 0, m, gf2poly::monomial (0),
+      [&] (const gf2poly& g)
+      {
+        switch (type)
           {
-            cyclic_polys(0) = (double)i;
+          case CYCLIC_POLY_MIN:
+          case CYCLIC_POLY_MAX:
+            if (polys.empty ())
+              polys.push_back (g);
+            else if ((g.compare (polys[0]) < 0) == (type == CYCLIC_POLY_MIN))
+              polys[0] = g;
             break;
-          }
-      break;
-    case CYCLIC_POLY_MAX:
-      cyclic_polys.resize (1);
-      for (unsigned long long i = (1UL<<(m+1))-1; i > (1UL<<m); i-=2)
-        if (do_is_cyclic_polynomial (i, n, m))
-          {
-            cyclic_polys(0) = (double)i;
+          case CYCLIC_POLY_L:
+            if (g.weight () == l)
+              polys.push_back (g);
+            break;
+          default:
+            polys.push_back (g);
             break;
           }
-      break;
-    case CYCLIC_POLY_ALL:
-      for (unsigned long long i = (1UL<<m)+1; i < (1UL<<(1+m)); i+=2)
-        if (do_is_cyclic_polynomial (i, n, m))
-          {
-            cyclic_polys.resize (cyclic_polys.length ()+1);
-            cyclic_polys(cyclic_polys.length ()-1) = (double)i;
-          }
-      break;
-    case CYCLIC_POLY_L:
-      for (unsigned long long i = ((unsigned long long)1<<m)+1;
-           i < ((unsigned long long)1<<(1+m)); i+=2)
-        {
-          int li = 0;
-          for (int j=0; j < m+1; j++)
-            if (i & ((unsigned long long)1 << j))
-              li++;
-          if (li == l)
-            {
-              if (do_is_cyclic_polynomial (i, n, m))
-                {
-                  cyclic_polys.resize (cyclic_polys.length ()+1);
-                  cyclic_polys(cyclic_polys.length ()-1) = (double)i;
-                }
-            }
-        }
-      break;
-    default:
-      error ("cyclpoly: impossible");
-      break;
-    }
+      });
+
+  std::sort (polys.begin (), polys.end (), cyclic_poly_less);
 
-  if (cyclic_polys.length () == 0)
+  if (polys.empty ())
     {
       octave_stdout <<
         "cyclpoly: no generator polynomial statifies constraints" << std::endl;
@@ -252,17 +282,22 @@ is @code{\"polynomial\"}.\n\
     }
   else
     {
+      int npolys = polys.size ();
       if (polyrep)
         {
-          Matrix polys (cyclic_polys.length (), m+1, 0);
-          for (int i = 0 ; i < cyclic_polys.length (); i++)
+          Matrix y (npolys, m+1, 0);
+          for (int i = 0 ; i < npolys; i++)
             for (int j = 0; j < m+1; j++)
-              if ((unsigned long long)cyclic_polys(i) & (1<<j))
-                polys(i, j) = 1;
-          retval = octave_value (polys);
+              y(i, j) = polys[i].coeff (j);
+          retval = octave_value (y);
         }
       else
-        retval = octave_value (cyclic_polys);
+        {
+          RowVector y (npolys);
+          for (int i = 0 ; i < npolys; i++)
+            y(i) = (double)polys[i].words ()[0];
+          retval = octave_value (y);
+        }
     }
 
   return retval;
@@ -273,6 +308,25 @@ is @code{\"polynomial\"}.\n\
 %!error cyclpoly ()
 %!error cyclpoly (1)
 %!error cyclpoly (1, 2, 3, 4, 5)
+
+%!assert (cyclpoly (7, 4), [1 1 0 1])
+%!assert (cyclpoly (7, 4, "max"), [1 0 1 1])
+%!assert (cyclpoly (7, 4, "all", "integer"), [11 13])
+%!assert (cyclpoly (15, 11, 3, "integer"), [19 25])
+
+%!test
+%! ## Even lengths have repeated factors
+%! y = cyclpoly (14, 8, "all");
+%! for i = 1:rows (y)
+%!   [q, r] = deconv ([1, zeros(1, 13), 1], fliplr (y(i,:)));
+%!   assert (all (mod (r, 2) == 0))
+%! endfor
+
+%!test
+%! y = cyclpoly (255, 239);
+%! assert (size (y), [1, 17])
+%! [q, r] = deconv ([1, zeros(1, 254), 1], fliplr (y));
+%! assert (all (mod (r, 2) == 0))
 */
 
 /*
@@ -0,0 +1,160 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+
+#if !defined (octave_dpcm_h)
+#define octave_dpcm_h 1
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <octave/oct.h>
+
+// A quantiser of the strictly increasing partition t, as for quantiz:
+// the index of x is the number of elements of t below x, 0 for
+// x <= t[0] and i for t[i-1] < x <= t[i]. The partitions of evenly
+// spaced elements, as most are, are indexed directly from x, and the
+// others by binary search
+class dpcm_quantizer
+{
+public:
+
+  dpcm_quantizer (const std::vector<double>& _t)
+    : t (_t), uniform (false), step (0)
+  {
+    size_t n = t.size ();
+    if (n >= 2)
+      {
+        step = (t[n-1] - t[0]) / (n - 1);
+        uniform = (step > 0 && step < octave_Inf);
+        for (size_t i = 1; uniform && (i < n); i++)
+          uniform = (std::abs (t[i] - (t[0] + i*step)) <= step / 4);
+      }
+  }
+
+  octave_idx_type index (double x) const
+  {
+    octave_idx_type n = t.size ();
+    if (uniform && x > t[0] && x <= t[n-1])
+      {
+        // The guess is off by at most one for an even partition
+        octave_idx_type i = (octave_idx_type)std::ceil ((x - t[0]) / step);
+        i = std::max (std::min (i, n - 1), (octave_idx_type)1);
+        while (t[i-1] >= x)
+          i--;
+        while (i < n && t[i] < x)
+          i++;
+        return i;
+      }
+    return std::lower_bound (t.begin (), t.end (), x) - t.begin ();
+  }
+
+private:
+
+  std::vector<double> t;
+  bool uniform;
+  double step;
+};
+
+// Read the strictly increasing partition arg of fcn into t
+static bool
+dpcm_get_partition (const octave_value& arg, const char *fcn,
+                    std::vector<double>& t)
+{
+  const Matrix a = arg.matrix_value ();
+  t.resize (a.numel ());
+  for (octave_idx_type i = 0; i < a.numel (); i++)
+    {
+      t[i] = a(i);
+      if (std::isnan (t[i]) || (i > 0 && ! (t[i] > t[i-1])))
+        {
+          error ("%s: PARTITION must be strictly increasing", fcn);
+          return false;
+        }
+    }
+  return true;
+}
+
+// Read the predictor pred of fcn into p, p[j] being the weight of the
+// value j samples before, and the state, the last m values before the
+// signal for a predictor of m+1 elements, into the first m elements of
+// h, the oldest first. The state is zero if it is not defined. The
+// first element of the predictor, the weight of the current value, is
+// not used
+static bool
+dpcm_get_predictor (const octave_value& pred, const octave_value& state,
+                    const char *fcn, std::vector<double>& p,
+                    std::vector<double>& h)
+{
+  const Matrix a = pred.matrix_value ();
+  if (a.numel () == 0)
+    {
+      error ("%s: PREDICTOR must not be empty", fcn);
+      return false;
+    }
+  octave_idx_type m = a.numel () - 1;
+  p.resize (m + 1);
+  for (octave_idx_type j = 0; j <= m; j++)
+    p[j] = a(j);
+
+  h.assign (m, 0.);
+  if (state.is_defined ())
+    {
+      const Matrix s = state.matrix_value ();
+      if (s.numel () != m)
+        {
+          error ("%s: STATE must have one element less than PREDICTOR", fcn);
+          return false;
+        }
+      for (octave_idx_type j = 0; j < m; j++)
+        h[j] = s(j);
+    }
+  return true;
+}
+
+// The prediction of the value after the last one y[-1], with p of m+1
+// elements
+static inline double
+dpcm_predict (const std::vector<double>& p, const double *y)
+{
+  double v = 0;
+  for (size_t j = 1; j < p.size (); j++)
+    v += p[j] * y[-(octave_idx_type)j];
+  return v;
+}
+
+// The last m values of h, as a row vector
+static inline RowVector
+dpcm_state (const std::vector<double>& h, octave_idx_type m)
+{
+  RowVector s (m);
+  for (octave_idx_type j = 0; j < m; j++)
+    s(j) = h[h.size () - m + j];
+  return s;
+}
+
+#endif
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
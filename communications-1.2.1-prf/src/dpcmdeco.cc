@@ -0,0 +1,127 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+
+
+#include <vector>
+
+#include <octave/oct.h>
+
+#include "dpcm.h"
+
+DEFUN_DLD (dpcmdeco, args, nargout,
+  "-*- texinfo -*-\n\
+@deftypefn  {Loadable Function} {@var{sig} =} dpcmdeco (@var{indx}, @var{codebook}, @var{predictor})\n\
+@deftypefnx {Loadable Function} {[@var{sig}, @var{state}] =} dpcmdeco (@var{indx}, @var{codebook}, @var{predictor}, @var{state})\n\
+Decode using differential pulse code modulation (DPCM).\n\
+\n\
+@table @code\n\
+@item sig = dpcmdeco (indx, codebook, predictor)\n\
+Decode the signal coded by DPCM.\n\
+Use the prediction model and the coded prediction error given by a codebook and\n\
+the index of each sample in this codebook.\n\
+\n\
+@item [sig, state] = dpcmdeco (indx, codebook, predictor, state)\n\
+Decode a signal in pieces: @var{state} holds the last m decoded values,\n\
+the oldest first, zeros by default before the first piece, and is\n\
+returned for the next piece, as for @code{dpcmenco}.\n\
+@end table\n\
+@seealso{dpcmenco, dpcmopt}\n\
+@end deftypefn")
+{
+  octave_value_list retval;
+  int nargin = args.length ();
+
+  if (nargin < 3 || nargin > 4)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  const Matrix indx = args(0).matrix_value ();
+  const Matrix codebook = args(1).matrix_value ();
+
+  std::vector<double> p, h;
+  octave_value state = (nargin > 3 ? args(3) : octave_value ());
+  if (! dpcm_get_predictor (args(2), state, "dpcmdeco", p, h))
+    return retval;
+
+  octave_idx_type n = indx.numel ();
+  octave_idx_type m = p.size () - 1;
+  octave_idx_type ncode = codebook.numel ();
+  h.resize (m + n);
+  for (octave_idx_type i = 0; i < n; i++)
+    {
+      if ((i & 0xffff) == 0)
+        OCTAVE_QUIT;
+
+      double k = indx(i);
+      if (! (k >= 0 && k < ncode && k == std::floor (k)))
+        {
+          error ("dpcmdeco: all elements of INDX must be integers in the "
+                 "range [0,N-1]");
+          return retval;
+        }
+      h[m+i] = dpcm_predict (p, &h[m+i]) + codebook((octave_idx_type)k);
+    }
+
+  // The signal has the orientation of the codebook, as codebook(indx+1)
+  // has
+  bool column = (ncode > 1 ? codebook.columns () == 1
+                 : indx.columns () == 1 && n > 1);
+  Matrix sig (column ? n : 1, column ? 1 : n);
+  for (octave_idx_type i = 0; i < n; i++)
+    sig(i) = h[m+i];
+
+  retval(0) = octave_value (sig);
+  if (nargout > 1)
+    retval(1) = octave_value (dpcm_state (h, m));
+
+  return retval;
+}
+
+/*
+%!assert (dpcmdeco ([2 2 2 1], [-1.5 -0.5 0.5 1.5], [0 1]), [0.5 1 1.5 1])
+%!assert (dpcmdeco ([2 2 2 1], [-1.5; -0.5; 0.5; 1.5], [0 1]), [0.5; 1; 1.5; 1])
+%!assert (dpcmdeco ([0 3 1], [-1 0 1 2], 0), [-1 2 0])
+
+%!test
+%! indx = randi ([0 7], 1, 1000);
+%! codebook = linspace (-1, 1, 8);
+%! predictor = [0 0.9 -0.2 0.1];
+%! sig = dpcmdeco (indx, codebook, predictor);
+%! [sig1, state] = dpcmdeco (indx(1:333), codebook, predictor);
+%! sig2 = dpcmdeco (indx(334:end), codebook, predictor, state);
+%! assert ([sig1 sig2], sig)
+
+%% Test input validation
+%!error dpcmdeco ()
+%!error dpcmdeco (1)
+%!error dpcmdeco (1, 2)
+%!error dpcmdeco (1, 2, 3, 4, 5)
+%!error <INDX> dpcmdeco (2, [1 2], [0 1])
+%!error <INDX> dpcmdeco (0.5, [1 2], [0 1])
+*/
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
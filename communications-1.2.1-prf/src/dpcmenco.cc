@@ -0,0 +1,170 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+
+
+#include <vector>
+
+#include <octave/oct.h>
+
+#include "dpcm.h"
+
+DEFUN_DLD (dpcmenco, args, nargout,
+  "-*- texinfo -*-\n\
+@deftypefn  {Loadable Function} {@var{qidx} =} dpcmenco (@var{sig}, @var{codebook}, @var{partition}, @var{predictor})\n\
+@deftypefnx {Loadable Function} {@var{qidx} =} dpcmenco (@var{sig}, @var{codebook}, @var{partition}, @var{predictor}, @var{state})\n\
+@deftypefnx {Loadable Function} {[@var{qidx}, @var{q}] =} dpcmenco (@dots{})\n\
+@deftypefnx {Loadable Function} {[@var{qidx}, @var{q}, @var{d}] =} dpcmenco (@dots{})\n\
+@deftypefnx {Loadable Function} {[@var{qidx}, @var{q}, @var{d}, @var{state}] =} dpcmenco (@dots{})\n\
+Encode using differential pulse code modulation (DPCM).\n\
+\n\
+@table @code\n\
+@item qidx = dpcmenco (sig, codebook, partition, predictor)\n\
+Determine position of the prediction error in a strictly monotonic table (partition).\n\
+The predictor vector describes a m-th order prediction for the\n\
+output according to the following equation\n\
+y(k) = p(1)sig(k-1) + p(2)sig(k-2) + ... + p(m-1)sig(k-m+1) + p(m)sig(k-m) ,\n\
+where the predictor vector is given by\n\
+predictor = [0, p(1), p(2), p(3),..., p(m-1), p(m)].\n\
+\n\
+@item [qidx, q] = dpcmenco (sig, codebook, partition, predictor)\n\
+Also return the quantized values.\n\
+\n\
+@item [qidx, q, d] = dpcmenco (...)\n\
+Also compute distortion: mean squared distance of original sig from the\n\
+corresponding quantized values.\n\
+\n\
+@item [qidx, q, d, state] = dpcmenco (sig, codebook, partition, predictor, state)\n\
+Encode a signal in pieces: @var{state} holds the last m decoded values,\n\
+the oldest first, zeros by default before the first piece, and is\n\
+returned for the next piece. The pieces are encoded as the whole\n\
+signal would be, and decoded by @code{dpcmdeco} with the same states.\n\
+@end table\n\
+\n\
+The whole signal is encoded in a single pass. The errors are quantized\n\
+directly from their value when the partition is evenly spaced, and by\n\
+binary search otherwise.\n\
+@seealso{dpcmdeco, dpcmopt, quantiz}\n\
+@end deftypefn")
+{
+  octave_value_list retval;
+  int nargin = args.length ();
+
+  if (nargin < 4 || nargin > 5)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  const Matrix sig = args(0).matrix_value ();
+  const Matrix codebook = args(1).matrix_value ();
+
+  std::vector<double> t;
+  if (! dpcm_get_partition (args(2), "dpcmenco", t))
+    return retval;
+  if (codebook.numel () <= (octave_idx_type)t.size ())
+    {
+      error ("dpcmenco: CODEBOOK must have more elements than PARTITION");
+      return retval;
+    }
+
+  std::vector<double> p, h;
+  octave_value state = (nargin > 4 ? args(4) : octave_value ());
+  if (! dpcm_get_predictor (args(3), state, "dpcmenco", p, h))
+    return retval;
+
+  // The decoded values follow the state in h, and the prediction error
+  // of each sample is quantized against the decoded values before it
+  octave_idx_type n = sig.numel ();
+  octave_idx_type m = p.size () - 1;
+  dpcm_quantizer quant (t);
+  RowVector qidx (n);
+  RowVector q (n);
+  double dist = 0;
+  h.resize (m + n);
+  for (octave_idx_type i = 0; i < n; i++)
+    {
+      if ((i & 0xffff) == 0)
+        OCTAVE_QUIT;
+
+      double pred = dpcm_predict (p, &h[m+i]);
+      octave_idx_type k = quant.index (sig(i) - pred);
+      qidx(i) = k;
+      q(i) = codebook(k);
+      h[m+i] = pred + q(i);
+      dist += (sig(i) - h[m+i]) * (sig(i) - h[m+i]);
+    }
+
+  retval(0) = octave_value (qidx);
+  if (nargout > 1)
+    retval(1) = octave_value (q);
+  if (nargout > 2)
+    retval(2) = octave_value (dist / n);
+  if (nargout > 3)
+    retval(3) = octave_value (dpcm_state (h, m));
+
+  return retval;
+}
+
+/*
+%!test
+%! [qidx, q, d] = dpcmenco ([0.3 1.2 2.0 1.1], [-1.5 -0.5 0.5 1.5], [-1 0 1], [0 1]);
+%! assert (qidx, [2 2 2 1])
+%! assert (q, [0.5 0.5 0.5 -0.5])
+%! assert (d, 0.085, 1e-12)
+%! assert (dpcmdeco (qidx, [-1.5 -0.5 0.5 1.5], [0 1]), [0.5 1 1.5 1])
+
+%!test
+%! ## Uneven partitions, and a signal encoded in pieces
+%! sig = cumsum (randn (1, 1000));
+%! codebook = [-3 -1.5 -0.7 -0.2 0.2 0.7 1.5 3];
+%! partition = [-2 -1 -0.4 0 0.4 1 2];
+%! predictor = [0 1.2 -0.3];
+%! [qidx, q, d] = dpcmenco (sig, codebook, partition, predictor);
+%! assert (qidx, quantiz (sig - dpcmdeco (qidx, codebook, predictor) + q, partition))
+%! [qidx1, q1, d1, state] = dpcmenco (sig(1:400), codebook, partition, predictor);
+%! [qidx2, q2, d2] = dpcmenco (sig(401:end), codebook, partition, predictor, state);
+%! assert ([qidx1 qidx2], qidx)
+%! assert ([q1 q2], q)
+%! assert ((400*d1 + 600*d2) / 1000, d, 1e-12)
+
+%!test
+%! ## Even partitions, indexed directly
+%! sig = 10 * randn (1, 1000);
+%! partition = -7.5:7.5;
+%! assert (dpcmenco (sig, -8:8, partition, 0), quantiz (sig, partition))
+
+%% Test input validation
+%!error dpcmenco ()
+%!error dpcmenco (1)
+%!error dpcmenco (1, 2)
+%!error dpcmenco (1, 2, 3)
+%!error dpcmenco (1, 2, 3, 4, 5)
+%!error dpcmenco (1, 2, 3, 4, 5, 6)
+%!error <PARTITION> dpcmenco (1, [1 2 3], [1 0], [0 1])
+%!error <CODEBOOK> dpcmenco (1, [1 2], [0 1], [0 1])
+%!error <STATE> dpcmenco (1, [1 2], 0, [0 1], [0 0])
+*/
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
@@ -0,0 +1,216 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+
+
+#include <vector>
+
+#include <octave/oct.h>
+#include <octave/Cell.h>
+
+#include "bitstream.h"
+#include "fibonacci.h"
+
+DEFUN_DLD (fibodeco, args, ,
+  "-*- texinfo -*-\n\
+@deftypefn  {Loadable Function} {@var{num} =} fibodeco (@var{code})\n\
+@deftypefnx {Loadable Function} {@var{num} =} fibodeco (@var{code}, @var{nbits})\n\
+\n\
+Returns the decoded Fibonacci value from the binary vectors @var{code}.\n\
+Universal codes like Fibonacci codes have a useful synchronization property.\n\
+We assume\n\
+user has partitioned the code into several unique segments based on\n\
+the suffix property of unique strings \"11\" and we just decode the\n\
+parts. Partitioning the stream is as simple as identifying the\n\
+\"11\" pairs that occur, at the terminating ends. This system implements\n\
+the standard binary Fibonacci codes, which means that row vectors\n\
+can only contain 0 or 1. Ref: @url{http://en.wikipedia.org/wiki/Fibonacci_coding}\n\
+\n\
+@var{code} may also be the stream of the codewords, as a binary vector\n\
+or as a uint8 vector of packed bits, the first bit being the most\n\
+significant bit of its first element, of which the first @var{nbits}\n\
+are read, by default all of them. The stream is split at the \"11\"\n\
+pairs 64 bits at a time, and the zeros after its last codeword, such\n\
+as those padding a packed code, are ignored.\n\
+\n\
+@example\n\
+@group\n\
+fibodeco (@{[0 1 0 0 1 1]@})\n\
+    @result{} 10\n\
+fibodeco (@{[1 1], [0 1 1], [0 0 1 1], [1 0 1 1]@})\n\
+    @result{} [1, 2, 3, 4]\n\
+fibodeco ([1 1 0 1 1 0 0 1 1 1 0 1 1])\n\
+    @result{} [1, 2, 3, 4]\n\
+@end group\n\
+@end example\n\
+@seealso{fiboenco}\n\
+@end deftypefn")
+{
+  octave_value_list retval;
+  int nargin = args.length ();
+
+  if (nargin < 1 || nargin > 2)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  std::vector<uint64_t> f;
+  fibonacci_table (f);
+  int nf = f.size ();
+
+  std::vector<double> num;
+
+  if (args(0).is_cell ())
+    {
+      if (nargin > 1)
+        {
+          error ("fibodeco: NBITS is only valid with a uint8 CODE");
+          return retval;
+        }
+
+      // Each codeword without its terminating 1
+      Cell c = args(0).cell_value ();
+      num.resize (c.numel ());
+      for (octave_idx_type k = 0; k < c.numel (); k++)
+        {
+          const Matrix word = c(k).matrix_value ();
+          if (word.numel () > nf + 1)
+            {
+              error ("fibodeco: CODE{%d} is not a codeword", (int)k + 1);
+              return retval;
+            }
+          double v = 0;
+          for (octave_idx_type i = 0; i < word.numel (); i++)
+            {
+              if (! (word(i) == 0 || word(i) == 1))
+                {
+                  error ("fibodeco: CODE must hold binary vectors");
+                  return retval;
+                }
+              if (i + 1 < word.numel () && word(i) == 1)
+                v += f[i];
+            }
+          num[k] = v;
+        }
+    }
+  else
+    {
+      std::vector<uint64_t> a;
+      uint64_t nbits;
+      double nb = (nargin > 1 ? args(1).double_value () : -1);
+      if (! bitstream_load (args(0), nb, "fibodeco", "CODE", a, nbits))
+        return retval;
+
+      uint64_t pos = 0;
+      while (pos < nbits)
+        {
+          if ((num.size () & 0xffff) == 0)
+            OCTAVE_QUIT;
+
+          // The first "11" of the next 64 bits, at the bits j and j+1
+          uint64_t x = bitstream_peek (&a[0], pos, 64);
+          uint64_t y = x & (x << 1);
+          double v = 0;
+          if (y)
+            {
+              int j = bitstream_clz (y);
+              for (uint64_t z = x & (~(uint64_t)0 << (63 - j)); z;
+                   z &= ~((uint64_t)1 << 63 >> bitstream_clz (z)))
+                v += f[bitstream_clz (z)];
+              pos += j + 2;
+            }
+          else if (x == 0 && pos + 64 >= nbits)
+            break;
+          else
+            {
+              // A codeword of more than 63 bits, or the last bits, read
+              // one at a time
+              int prev = 0;
+              bool ones = false;
+              uint64_t i = 0;
+              for (;; i++)
+                {
+                  if (pos + i >= nbits)
+                    {
+                      if (! ones)
+                        break;
+                      error ("fibodeco: CODE ends within a codeword");
+                      return retval;
+                    }
+                  int b = (a[(pos + i) >> 6] >> (63 - ((pos + i) & 63))) & 1;
+                  if (b && prev)
+                    break;
+                  if (b)
+                    {
+                      if (i >= (uint64_t)nf)
+                        {
+                          error ("fibodeco: CODE holds a codeword of more "
+                                 "than %d bits", nf + 1);
+                          return retval;
+                        }
+                      v += f[i];
+                      ones = true;
+                    }
+                  prev = b;
+                }
+              if (pos + i >= nbits)
+                break;
+              pos += i + 1;
+            }
+          num.push_back (v);
+        }
+    }
+
+  RowVector y (num.size ());
+  for (size_t i = 0; i < num.size (); i++)
+    y(i) = num[i];
+  retval(0) = octave_value (y);
+  return retval;
+}
+
+/*
+%!assert (fibodeco ({[1 1], [0 1 1], [0 0 1 1], [1 0 1 1]}), [1:4])
+%!assert (fibodeco ({[0 1 0 0 1 1]}), 10)
+%!assert (fibodeco ([1 1 0 1 1 0 0 1 1 1 0 1 1]), [1:4])
+%!assert (fibodeco ([1 1 0 1 1 0 0]), [1 2])
+%!assert (fibodeco (uint8 ([217 216])), [1:4])
+%!assert (fibodeco (uint8 ([217 216]), 5), [1 2])
+
+%!test
+%! num = [1:1000 2^52+1 2^53];
+%! assert (fibodeco (fiboenco (num, "dense")), num)
+%! assert (fibodeco (fiboenco (num, "logical")), num)
+%! assert (fibodeco (fiboenco (num, "packed")), num)
+%! assert (fibodeco (fibosplitstream ([fiboenco(1:100){:}])), 1:100)
+
+%!error <ends within> fibodeco ([1 1 0 1])
+%!error <binary> fibodeco ([1 2])
+
+%% Test input validation
+%!error fibodeco ()
+%!error fibodeco (1, 2)
+*/
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
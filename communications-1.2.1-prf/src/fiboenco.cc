@@ -0,0 +1,165 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+
+
+#include <algorithm>
+#include <vector>
+
+#include <octave/oct.h>
+
+#include "bitstream.h"
+#include "fibonacci.h"
+
+DEFUN_DLD (fiboenco, args, nargout,
+  "-*- texinfo -*-\n\
+@deftypefn  {Loadable Function} {@var{fcode} =} fiboenco (@var{num})\n\
+@deftypefnx {Loadable Function} {@var{fcode} =} fiboenco (@var{num}, @var{format})\n\
+@deftypefnx {Loadable Function} {[@var{fcode}, @var{Ltot}] =} fiboenco (@dots{})\n\
+\n\
+Returns the cell-array of encoded Fibonacci value from the column vectors @var{num}.\n\
+Universal codes like Fibonacci codes have a useful synchronization\n\
+property. We assume\n\
+user has partitioned the code into several unique segments based on\n\
+the suffix property of unique elements [1 1] and we just decode the\n\
+parts. Partitioning the stream is as simple as identifying the [1 1]\n\
+pairs that occur, at the terminating ends. This system implements\n\
+the standard binary Fibonacci codes, which means that row vectors\n\
+can only contain 0 or 1. Any positive integer up to @code{flintmax}\n\
+may be encoded.\n\
+\n\
+The codewords are returned in a cell array, unless @var{format} is\n\
+'dense' for a double row vector of their bits, 'logical' for a logical\n\
+one, or 'packed' for a uint8 row vector of eight bits per element, the\n\
+first bit being the most significant bit of the first element, and the\n\
+last element being padded with zeros. @var{format} may also be 'cell'\n\
+for the default. The optional output @var{Ltot} is the total length of\n\
+the code in bits.\n\
+\n\
+Ref: Wikipedia article accessed March, 2006.\n\
+@url{http://en.wikipedia.org/wiki/Fibonacci_coding},  UCI Data Compression\n\
+Book, @url{http://www.ics.uci.edu/~dan/pubs/DC-Sec3.html}, (accessed\n\
+October 2006)\n\
+\n\
+@example\n\
+@group\n\
+fiboenco (10)\n\
+    @result{} @{[ 0 1 0 0 1 1]@}\n\
+fiboenco (1:4)\n\
+    @result{} @{[1 1], [0 1 1], [0 0 1 1], [1 0 1 1]@}\n\
+fiboenco (1:4, \"packed\")\n\
+    @result{} [217 216]\n\
+@end group\n\
+@end example\n\
+@seealso{fibodeco}\n\
+@end deftypefn")
+{
+  octave_value_list retval;
+  int nargin = args.length ();
+
+  if (nargin < 1 || nargin > 2)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  bitstream_format fmt = BITSTREAM_CELL;
+  if (nargin > 1 && ! bitstream_get_format (args(1), "fiboenco", true, fmt))
+    return retval;
+
+  std::vector<uint64_t> f;
+  fibonacci_table (f);
+
+  const Matrix num = args(0).matrix_value ();
+  bitstream_writer w (fmt == BITSTREAM_CELL);
+  std::vector<bool> b (f.size ());
+  for (octave_idx_type i = 0; i < num.numel (); i++)
+    {
+      double v = num(i);
+      if (! (v >= 1 && v <= FIBONACCI_MAX && v == std::floor (v)))
+        {
+          error ("fiboenco: NUM must hold positive integers");
+          return retval;
+        }
+
+      // The Zeckendorf representation, from the largest weight down,
+      // written at once if the codeword fits in a word
+      uint64_t n = (uint64_t)v;
+      int h = std::upper_bound (f.begin (), f.end (), n) - f.begin () - 1;
+      w.mark ();
+      if (h < 63)
+        {
+          uint64_t x = 1;
+          for (int j = h; j >= 0 && n > 0; j--)
+            if (f[j] <= n)
+              {
+                x |= (uint64_t)1 << (h + 1 - j);
+                n -= f[j];
+              }
+          w.put (x, h + 2);
+          continue;
+        }
+
+      for (int j = h; j >= 0; j--)
+        {
+          b[j] = (f[j] <= n);
+          if (b[j])
+            n -= f[j];
+        }
+      for (int j = 0; j <= h; j++)
+        w.put (b[j], 1);
+      w.put (1, 1);
+    }
+
+  retval(0) = w.value (fmt);
+  if (nargout > 1)
+    retval(1) = octave_value ((double)w.size ());
+
+  return retval;
+}
+
+/*
+%!assert (fibodeco (fiboenco (1:600)), [1:600])
+%!assert (fiboenco (10), {[0 1 0 0 1 1]})
+%!assert (fiboenco (1:4), {[1 1], [0 1 1], [0 0 1 1], [1 0 1 1]})
+%!assert (fiboenco (1:4, "dense"), [1 1 0 1 1 0 0 1 1 1 0 1 1])
+%!assert (fiboenco (1:4, "packed"), uint8 ([217 216]))
+
+%!test
+%! ## Values of long codewords, beyond the table of the old encoder
+%! num = [377 608 609 1000 2^40 2^53];
+%! assert (fibodeco (fiboenco (num)), num)
+%! [fcode, Ltot] = fiboenco (num, "packed");
+%! assert (fibodeco (fcode), num)
+%! assert (Ltot, numel ([fiboenco(num){:}]))
+
+%% Test input validation
+%!error fiboenco ()
+%!error fiboenco (1, 2)
+%!error fiboenco (0)
+%!error fiboenco (1.5)
+%!error <FORMAT> fiboenco (1, "foo")
+*/
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
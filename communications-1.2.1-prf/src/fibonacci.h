@@ -0,0 +1,53 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+
+#if !defined (octave_fibonacci_h)
+#define octave_fibonacci_h 1
+
+#include <stdint.h>
+
+#include <vector>
+
+// The largest value of the codes, below which doubles are exact
+#define FIBONACCI_MAX 9007199254740992.0
+
+// The weights 1, 2, 3, 5, 8, ... of the bits of the Fibonacci codes, up
+// to 2^53. A value is written as the sum of non-consecutive weights of
+// its Zeckendorf representation, the bit of the weight f[0] first, and
+// the codeword ends with a 1 after the last 1 of the value, so that
+// "11" appears only at the end of the codewords
+static void
+fibonacci_table (std::vector<uint64_t>& f)
+{
+  f.clear ();
+  f.push_back (1);
+  f.push_back (2);
+  while (f[f.size () - 1] + f[f.size () - 2] <= (uint64_t)FIBONACCI_MAX)
+    f.push_back (f[f.size () - 1] + f[f.size () - 2]);
+}
+
+#endif
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
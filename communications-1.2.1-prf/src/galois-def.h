@@ -150,7 +150,7 @@ void gripe_init_galois (void);
     return r; \
   }
 
-#define MM_BIN_OP2(R, F, OP, M1, M2, NN, GR1, GR2, CHECKTYPE, ZEROCHECK) \
+#define MM_BIN_OP2(R, F, OP, FN, M1, M2, NN, GR1, GR2, CHECKTYPE, ZEROCHECK) \
   R \
   F (const M1& m1, const M2& m2) \
   { \
@@ -185,6 +185,8 @@ void gripe_init_galois (void);
                     { \
                       if (m2(i, j) == 0) \
                         r(i, j) = 0; \
+                      else if (r.have_tower ()) \
+                        r(i, j) = r.FN ((int)m1(0, 0), (int)m2(i, j)); \
                       else \
                         { \
                           r(i, j) = indxm1 OP r.index_of ((int)m2(i, j)) + NN; \
@@ -211,6 +213,8 @@ void gripe_init_galois (void);
                     { \
                       if (m1(i, j) == 0) \
                         r(i, j) = 0; \
+                      else if (r.have_tower ()) \
+                        r(i, j) = r.FN ((int)m1(i, j), (int)m2(0, 0)); \
                       else \
                         { \
                           r(i, j) = r.index_of ((int)m1(i, j)) OP  indxm2 + NN; \
@@ -230,6 +234,8 @@ void gripe_init_galois (void);
             { \
               if ((m1(i, j) == 0) || (m2(i, j) == 0)) \
                 r(i, j) = 0; \
+              else if (r.have_tower ()) \
+                r(i, j) = r.FN ((int)m1(i, j), (int)m2(i, j)); \
               else \
                 { \
                   r(i, j) = r.index_of ((int)m1(i, j)) OP r.index_of ((int)m2(i, j)) + NN; \
@@ -244,8 +250,8 @@ void gripe_init_galois (void);
 #define MM_BIN_OPS1(R, M1, M2, GR1, GR2, CHECK) \
   MM_BIN_OP1 (R, operator  +, M1, M2, GR1, GR2, CHECK) \
   MM_BIN_OP1 (R, operator  -, M1, M2, GR1, GR2, CHECK) \
-  MM_BIN_OP2 (R, product,  +, M1, M2, 0, GR1, GR2, CHECK, NO) \
-  MM_BIN_OP2 (R, quotient, -, M1, M2, r.n (), GR1, GR2, CHECK, )
+  MM_BIN_OP2 (R, product,  +, multiply, M1, M2, 0, GR1, GR2, CHECK, NO) \
+  MM_BIN_OP2 (R, quotient, -, divide, M1, M2, r.n (), GR1, GR2, CHECK, )
 
 #define MM_BIN_OPS2(R, M1, M2, GR1, GR2, CHECK) \
   MM_BIN_OP1 (R, operator  +, M1, M2, GR1, GR2, CHECK)
@@ -64,6 +64,22 @@
     return new octave_galois (f (v1.t1 ## _value (), v2.t2 ## _value ())); \
   }
 
+#define DEFBINOP_OP_SG(name, t1, t2, op) \
+  BINOPDECL (name, a1, a2) \
+  { \
+    CAST_BINOP_ARGS (const octave_ ## t1&, const octave_ ## t2&); \
+    return new octave_sparse_galois \
+      (v1.t1 ## _value () op v2.t2 ## _value ()); \
+  }
+
+#define DEFBINOP_FN_SG(name, t1, t2, f) \
+  BINOPDECL (name, a1, a2) \
+  { \
+    CAST_BINOP_ARGS (const octave_ ## t1&, const octave_ ## t2&); \
+    return new octave_sparse_galois \
+      (f (v1.t1 ## _value (), v2.t2 ## _value ())); \
+  }
+
 #define DEFBINOP_OP_B_S1(name, t1, t2, op) \
   BINOPDECL (name, a1, a2) \
   { \
@@ -140,6 +156,14 @@
                                                      ra_idx)); \
   }
 
+#define DEFCATOP_SG_METHOD(name, t1, t2, f) \
+  CATOPDECL (name, a1, a2) \
+  { \
+    CAST_BINOP_ARGS (octave_ ## t1&, const octave_ ## t2&); \
+    return new octave_sparse_galois \
+      (v1.t1 ## _value (). f (v2.t2 ## _value (), ra_idx)); \
+  }
+
 #define INSTALL_G_CATOP(t1, t2, f) INSTALL_CATOP (t1, t2, f)
 
 #endif
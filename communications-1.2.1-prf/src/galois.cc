@@ -768,7 +768,30 @@ operator * (const galois& a, const galois& b)
   else
     {
       galois retval (a_nr, b_nc, 0, a.m (), a.primpoly ());
-      if (a_nr != 0 && a_nc != 0 && b_nc != 0)
+      if (a_nr != 0 && a_nc != 0 && b_nc != 0 && a.have_tower ())
+        {
+          // Accumulate in the composite field basis and map back once,
+          // as the basis change is linear
+          galois c (a_nr, 1, 0, a.m (), a.primpoly ());
+          for (int j = 0; j < b_nr; j++)
+            {
+              for (int k = 0; k < a_nr; k++)
+                c(k, 0) = a.to_tower_basis (a(k, j));
+
+              for (int i = 0; i < b_nc; i++)
+                if (b(j, i) != 0)
+                  {
+                    int tmp = a.to_tower_basis (b(j, i));
+                    for (int k = 0; k < a_nr; k++)
+                      if (c(k, 0) != 0)
+                        retval(k, i) ^= a.tower_multiply (tmp, c(k, 0));
+                  }
+            }
+          for (int i = 0; i < b_nc; i++)
+            for (int k = 0; k < a_nr; k++)
+              retval(k, i) = a.from_tower_basis (retval(k, i));
+        }
+      else if (a_nr != 0 && a_nc != 0 && b_nc != 0)
         {
           // This is not optimum for referencing b, but can use vector
           // to represent index(a(k,j)). Seems to be the fastest.
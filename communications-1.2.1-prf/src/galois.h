@@ -109,6 +109,23 @@ public:
   int n (void) const { return (field->n); }
   int alpha_to (const int& idx) const { return (field->alpha_to (idx)); }
   int index_of (const int& idx) const { return (field->index_of (idx)); }
+
+  // Multiplication and division that use the composite field for m = 16
+  int multiply (const int& a, const int& b) const
+  { return (field->multiply (a, b)); }
+  int divide (const int& a, const int& b) const
+  { return (field->divide (a, b)); }
+
+  // Direct access to the composite field, for loops that stay in its basis
+  bool have_tower (void) const { return (field->have_tower ()); }
+  int to_tower_basis (const int& a) const
+  { return (field->to_tower_basis (a)); }
+  int from_tower_basis (const int& a) const
+  { return (field->from_tower_basis (a)); }
+  int tower_multiply (const int& a, const int& b) const
+  { return (field->tower_multiply (a, b)); }
+  int tower_inverse (const int& a) const
+  { return (field->tower_inverse (a)); }
 };
 
 class
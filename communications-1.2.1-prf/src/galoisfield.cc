@@ -18,6 +18,10 @@
 // program with any Open Source program, as defined by the Open Source
 // Initiative (www.opensource.org)
 
+#include <algorithm>
+
+#include <octave/oct-locbuf.h>
+
 #include "galois.h"
 #include "galoisfield.h"
 #include "galois-def.h"
@@ -32,6 +36,8 @@ galois_field_node::galois_field_node (void) :
   m (0),
   primpoly (0),
   n (0),
+  tower (false),
+  lambda (0),
   next (NULL),
   prev (NULL),
   count (0) { }
@@ -43,6 +49,8 @@ galois_field_node::galois_field_node (const int& _m, const int& _primpoly)
   next = NULL;
   prev = NULL;
   count = 0;  // Flag that field is currently bad...
+  tower = false;
+  lambda = 0;
 
   // Initialize order of GF(2^m)
   m = _m;
@@ -101,10 +109,122 @@ galois_field_node::galois_field_node (const int& _m, const int& _primpoly)
         return;
       }
 
+  if (m == __OCTAVE_GALOIS_TOWER_M)
+    init_tower ();
+
   count = 1;   // Field is good now !!
   return;
 }
 
+void
+galois_field_node::init_tower (void)
+{
+  // GF(2^8) subfield tables. The antilog table is doubled in length so
+  // that the sum of two logarithms needs no modulo
+  sub_alpha_to.resize (dim_vector (510, 1));
+  sub_index_of.resize (dim_vector (256, 1));
+  sub_index_of(0) = 255;
+  int mask = 1;
+  for (int i = 0; i < 255; i++)
+    {
+      sub_index_of(mask) = i;
+      sub_alpha_to(i) = mask;
+      sub_alpha_to(i+255) = mask;
+      mask <<= 1;
+      if (mask & 0x100)
+        mask ^= __OCTAVE_GALOIS_TOWER_SUBPOLY;
+    }
+
+  // y^2 + y + lambda is irreducible over GF(2^8) if the trace of lambda
+  // is one. Take the smallest such lambda
+  for (lambda = 1; lambda < 256; lambda++)
+    {
+      int tr = lambda;
+      int sq = lambda;
+      for (int i = 1; i < 8; i++)
+        {
+          sq = sub_multiply (sq, sq);
+          tr ^= sq;
+        }
+      if (tr == 1)
+        break;
+    }
+
+  // Find a root beta of primpoly in the composite field. The map x -> beta
+  // is then an isomorphism from the polynomial basis
+  int beta;
+  for (beta = 2; beta <= n; beta++)
+    {
+      int val = 0;
+      for (int i = m; i >= 0; i--)
+        {
+          val = tower_multiply (val, beta);
+          if (primpoly & (1<<i))
+            val ^= 1;
+        }
+      if (val == 0)
+        break;
+    }
+
+  OCTAVE_LOCAL_BUFFER (int, img, m);
+  OCTAVE_LOCAL_BUFFER (int, src, m);
+  img[0] = 1;
+  src[0] = 1;
+  for (int i = 1; i < m; i++)
+    {
+      img[i] = tower_multiply (img[i-1], beta);
+      src[i] = 1 << i;
+    }
+
+  to_tower.resize (dim_vector (512, 1));
+  for (int v = 0; v < 256; v++)
+    {
+      int lo = 0;
+      int hi = 0;
+      for (int i = 0; i < 8; i++)
+        if (v & (1<<i))
+          {
+            lo ^= img[i];
+            hi ^= img[i+8];
+          }
+      to_tower(v) = lo;
+      to_tower(256+v) = hi;
+    }
+
+  // Invert the basis map with Gauss-Jordan elimination over GF(2)
+  for (int c = 0; c < m; c++)
+    {
+      int p = c;
+      while (!(img[p] & (1<<c)))
+        p++;
+      std::swap (img[p], img[c]);
+      std::swap (src[p], src[c]);
+      for (int r = 0; r < m; r++)
+        if ((r != c) && (img[r] & (1<<c)))
+          {
+            img[r] ^= img[c];
+            src[r] ^= src[c];
+          }
+    }
+
+  from_tower.resize (dim_vector (512, 1));
+  for (int v = 0; v < 256; v++)
+    {
+      int lo = 0;
+      int hi = 0;
+      for (int i = 0; i < 8; i++)
+        if (v & (1<<i))
+          {
+            lo ^= src[i];
+            hi ^= src[i+8];
+          }
+      from_tower(v) = lo;
+      from_tower(256+v) = hi;
+    }
+
+  tower = true;
+}
+
 galois_field_node & galois_field_node::operator = (const galois_field_node &t)
 {
   m = t.m;
@@ -112,6 +232,12 @@ galois_field_node & galois_field_node::operator = (const galois_field_node &t)
   n = t.n;
   alpha_to = t.alpha_to;
   index_of = t.index_of;
+  tower = t.tower;
+  lambda = t.lambda;
+  sub_alpha_to = t.sub_alpha_to;
+  sub_index_of = t.sub_index_of;
+  to_tower = t.to_tower;
+  from_tower = t.from_tower;
   next  = NULL;
   prev = NULL;
   count = 1;
@@ -32,6 +32,13 @@
 // A0 flag -inf value
 #define __OCTAVE_GALOIS_A0  (n)
 
+// Value of m for which the composite field GF((2^8)^2) is used for
+// multiplication, so that the working tables fit in the L1 cache
+#define __OCTAVE_GALOIS_TOWER_M  16
+
+// Primitive polynomial of the GF(2^8) subfield of the composite field
+#define __OCTAVE_GALOIS_TOWER_SUBPOLY  0x11d
+
 // The default primitive polynomials for GF(2^(indx+1))
 extern int default_galois_primpoly[];
 
@@ -40,6 +47,7 @@ galois_field_node
 {
   friend class galois_field_list;
   friend class galois;
+  friend class sparse_galois;
 
 private:
   int m;
@@ -48,6 +56,17 @@ private:
   MArray<int> alpha_to;
   MArray<int> index_of;
 
+  // Composite field representation. An element a1*y + a0 of GF((2^8)^2),
+  // with y^2 = y + lambda, is stored as (a1 << 8) | a0. The isomorphism
+  // with the polynomial basis of primpoly is stored as two 256 entry
+  // tables, one for each byte of the element.
+  bool tower;
+  int lambda;
+  MArray<int> sub_alpha_to;
+  MArray<int> sub_index_of;
+  MArray<int> to_tower;
+  MArray<int> from_tower;
+
   galois_field_node *next;
   galois_field_node *prev;
 
@@ -57,6 +76,83 @@ public:
   galois_field_node (void);
   galois_field_node (const int& _m = 1, const int& _primpoly = 0);
   galois_field_node & operator = (const galois_field_node &t);
+
+  bool have_tower (void) const { return tower; }
+
+  // Arithmetic in the GF(2^8) subfield
+  int sub_multiply (const int& a, const int& b) const
+  {
+    if ((a == 0) || (b == 0))
+      return 0;
+    return sub_alpha_to (sub_index_of (a) + sub_index_of (b));
+  }
+
+  // Conversion between the polynomial and composite field bases
+  int to_tower_basis (const int& a) const
+  {
+    return to_tower (a & 0xff) ^ to_tower (256 + (a >> 8));
+  }
+
+  int from_tower_basis (const int& a) const
+  {
+    return from_tower (a & 0xff) ^ from_tower (256 + (a >> 8));
+  }
+
+  // Arithmetic on elements in the composite field basis
+  int tower_multiply (const int& a, const int& b) const
+  {
+    int a1 = a >> 8;
+    int a0 = a & 0xff;
+    int b1 = b >> 8;
+    int b0 = b & 0xff;
+    int hh = sub_multiply (a1, b1);
+    int ll = sub_multiply (a0, b0);
+    int mm = sub_multiply (a1 ^ a0, b1 ^ b0);
+    return ((mm ^ ll) << 8) | (ll ^ sub_multiply (lambda, hh));
+  }
+
+  int tower_inverse (const int& a) const
+  {
+    int a1 = a >> 8;
+    int a0 = a & 0xff;
+    if (a == 0)
+      return 0;
+    // Divide the conjugate a1*y + a0 + a1 by the norm
+    int norm = sub_multiply (a0, a0 ^ a1)
+               ^ sub_multiply (lambda, sub_multiply (a1, a1));
+    int inorm = sub_alpha_to (255 - sub_index_of (norm));
+    return (sub_multiply (a1, inorm) << 8) | sub_multiply (a0 ^ a1, inorm);
+  }
+
+  // Arithmetic on elements in the polynomial basis
+  int multiply (const int& a, const int& b) const
+  {
+    if ((a == 0) || (b == 0))
+      return 0;
+    if (tower)
+      return from_tower_basis (tower_multiply (to_tower_basis (a),
+                                               to_tower_basis (b)));
+    int idx = index_of (a) + index_of (b);
+    if (idx >= n)
+      idx -= n;
+    return alpha_to (idx);
+  }
+
+  int divide (const int& a, const int& b) const
+  {
+    if ((a == 0) || (b == 0))
+      return 0;
+    if (tower)
+      return from_tower_basis (tower_multiply (to_tower_basis (a),
+                                               tower_inverse (to_tower_basis (b))));
+    int idx = index_of (a) - index_of (b);
+    if (idx < 0)
+      idx += n;
+    return alpha_to (idx);
+  }
+
+private:
+  void init_tower (void);
 };
 
 class
@@ -77,6 +173,9 @@ public:
 
 };
 
+// The fields in use, shared by all of the Galois arrays
+extern galois_field_list stored_galois_fields;
+
 #endif
 
 /*
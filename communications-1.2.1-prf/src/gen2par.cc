@@ -0,0 +1,346 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+#include <algorithm>
+#include <vector>
+
+#include <octave/oct.h>
+
+#include "bitpack.h"
+#include "gf2rref.h"
+
+// PKG_ADD: autoload ("systematize", "gen2par.oct");
+// PKG_DEL: autoload ("systematize", "gen2par.oct", "remove");
+
+// The rows of the binary matrix a, bit-packed. Returns false if a has
+// elements other than zero and one
+template <typename MT>
+static bool
+pack_binary (std::vector<bitpack_word>& g, const MT& a)
+{
+  int k = a.rows ();
+  int n = a.columns ();
+  int nw = BITPACK_WORDS (n);
+
+  g.assign ((size_t)k * nw, 0);
+  for (int j = 0; j < n; j++)
+    for (int i = 0; i < k; i++)
+      if (a(i, j) == 1)
+        bitpack_set (&g[(size_t)i*nw], j);
+      else if (a(i, j) != 0)
+        return false;
+  return true;
+}
+
+static bool
+pack_arg (std::vector<bitpack_word>& g, const octave_value& arg)
+{
+  if (arg.is_bool_type ())
+    return pack_binary (g, arg.bool_matrix_value ());
+  else
+    return pack_binary (g, arg.matrix_value ());
+}
+
+// The nr by nc matrix with the packed rows g, logical or double like
+// the argument it was computed from
+static octave_value
+unpack_rows (const std::vector<bitpack_word>& g, int nr, int nc, bool lgcl)
+{
+  int nw = BITPACK_WORDS (nc);
+
+  if (lgcl)
+    {
+      boolMatrix a (dim_vector (nr, nc), false);
+      for (int i = 0; i < nr; i++)
+        bitpack_unpack_row (a, i, &g[(size_t)i*nw], nc);
+      return octave_value (a);
+    }
+  else
+    {
+      Matrix a (nr, nc, 0);
+      for (int i = 0; i < nr; i++)
+        bitpack_unpack_row (a, i, &g[(size_t)i*nw], nc);
+      return octave_value (a);
+    }
+}
+
+DEFUN_DLD (gen2par, args, ,
+  "-*- texinfo -*-\n\
+@deftypefn  {Loadable Function} {@var{par} =} gen2par (@var{gen})\n\
+@deftypefnx {Loadable Function} {@var{gen} =} gen2par (@var{par})\n\
+\n\
+Converts binary generator matrix @var{gen} to the parity check matrix\n\
+@var{par} and visa-versa. If the input matrix is in standard form, that\n\
+is a generator matrix that is k-by-n and in the form [eye(k) P] or\n\
+[P eye(k)], or a parity matrix that is (n-k)-by-n and of the form\n\
+[eye(n-k) P'] or [P' eye(n-k)], the output is in the matching standard\n\
+form [P' eye(n-k)] or [eye(n-k) P'].\n\
+\n\
+Any other input with linearly independent rows is reduced over GF(2)\n\
+on bit-packed rows, and the rows of the output are a basis of its null\n\
+space. The output is logical if the input is.\n\
+\n\
+@seealso{cyclgen, hammgen, systematize}\n\
+@end deftypefn")
+{
+  octave_value retval;
+
+  if (args.length () != 1)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  int k = args(0).rows ();
+  int n = args(0).columns ();
+  int m = n - k;
+  int nw = BITPACK_WORDS (n);
+  bool lgcl = args(0).is_bool_type ();
+
+  if (k > n)
+    {
+      error ("gen2par: GEN must not have more rows than columns");
+      return retval;
+    }
+
+  std::vector<bitpack_word> g;
+  if (! pack_arg (g, args(0)))
+    {
+      error ("gen2par: GEN must be a binary matrix");
+      return retval;
+    }
+
+  // [P eye(k)] gives [eye(n-k) P'], which is not the null space basis
+  // that the reduction finds. [eye(k) P] is left to the reduction
+  bool left = true;
+  for (int i = 0; left && (i < k); i++)
+    for (int j = 0; j < k; j++)
+      if (bitpack_get (&g[(size_t)i*nw], j) != (i == j))
+        {
+          left = false;
+          break;
+        }
+
+  bool right = (m > 0) && ! left;
+  for (int i = 0; right && (i < k); i++)
+    for (int j = 0; j < k; j++)
+      if (bitpack_get (&g[(size_t)i*nw], m + j) != (i == j))
+        {
+          right = false;
+          break;
+        }
+
+  std::vector<bitpack_word> par ((size_t)m * nw, 0);
+
+  if (right)
+    {
+      for (int i = 0; i < m; i++)
+        bitpack_set (&par[(size_t)i*nw], i);
+      for (int i = 0; i < k; i++)
+        for (int j = 0; j < m; j++)
+          if (bitpack_get (&g[(size_t)i*nw], j))
+            bitpack_set (&par[(size_t)j*nw], m + i);
+    }
+  else
+    {
+      std::vector<int> piv;
+      if (gf2_rref (g, k, n, piv) < k)
+        {
+          error ("gen2par: the rows of GEN must be linearly independent");
+          return retval;
+        }
+
+      // Row j of the null space is one in the j-th column without a
+      // pivot, c, and in the pivot columns of the rows with a one in c.
+      // This is [P' eye(n-k)] for [eye(k) P]
+      std::vector<int> perm = gf2_pivot_order (piv, k, n);
+      for (int j = 0; j < m; j++)
+        {
+          int c = perm[k+j];
+          bitpack_word *pr = &par[(size_t)j*nw];
+          bitpack_set (pr, c);
+          for (int i = 0; i < k; i++)
+            if (bitpack_get (&g[(size_t)i*nw], c))
+              bitpack_set (pr, piv[i]);
+        }
+    }
+
+  retval = unpack_rows (par, m, n, lgcl);
+  return retval;
+}
+
+/*
+%% Test input validation
+%!error gen2par ()
+%!error gen2par (1, 2)
+%!error gen2par ([1; 2])
+%!error gen2par ([1 2])
+%!error gen2par ([1 1 0; 1 1 0])
+
+%!test
+%! [h, g] = hammgen (3);
+%! assert (gen2par (g), h)
+%! assert (gen2par (h), g)
+%! assert (gen2par ([eye(4), g(:,1:3)]), [g(:,1:3)', eye(3)])
+
+%!test
+%! g = [1 1 1 1 0 0 0; 0 1 0 1 1 0 1; 1 0 1 0 0 1 1; 0 0 1 1 1 0 1];
+%! h = gen2par (g);
+%! assert (size (h), [3, 7])
+%! assert (mod (g * h', 2), zeros (4, 3))
+%! assert (rank (h), 3)
+%! assert (islogical (gen2par (logical (g))))
+*/
+
+DEFUN_DLD (systematize, args, nargout,
+  "-*- texinfo -*-\n\
+@deftypefn  {Loadable Function} {[@var{Gx}, @var{P}] =} systematize (@var{G})\n\
+@deftypefnx {Loadable Function} {[@var{Gx}, @var{P}, @var{perm}] =} systematize (@var{G})\n\
+\n\
+Given @var{G}, extract P parity check matrix. Assume row-operations in GF(2).\n\
+@var{G} is of size KxN, when decomposed through row-operations into a @var{I} of size KxK\n\
+identity matrix, and a parity check matrix @var{P} of size Kx(N-K).\n\
+\n\
+Most arbitrary code with a given generator matrix @var{G}, can be converted into its\n\
+systematic form using this function.\n\
+\n\
+This function returns 2 values, first is default being @var{Gx} the systematic version of\n\
+the @var{G} matrix, and then the parity check matrix @var{P}.\n\
+\n\
+If the first K columns of @var{G} are linearly dependent, @var{G} can only\n\
+be brought to systematic form with a permutation of its columns. This is\n\
+done if the third output @var{perm} is requested, and @var{Gx} is then\n\
+the systematic form of @code{@var{G}(:,@var{perm})}. The elimination is\n\
+done on bit-packed rows, and the outputs are logical if @var{G} is.\n\
+\n\
+@example\n\
+@group\n\
+g = [1 1 1 1; 1 1 0 1; 1 0 0 1];\n\
+[gx, p] = systematize (g);\n\
+    @result{} gx = [1 0 0 1; 0 1 0 0; 0 0 1 0];\n\
+    @result{} p = [1; 0; 0];\n\
+@end group\n\
+@end example\n\
+@seealso{bchpoly, biterr, gen2par}\n\
+@end deftypefn")
+{
+  octave_value_list retval;
+
+  if (args.length () != 1)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  int k = args(0).rows ();
+  int n = args(0).columns ();
+  int nw = BITPACK_WORDS (n);
+  bool lgcl = args(0).is_bool_type ();
+
+  if (k >= n)
+    {
+      error ("systematize: G must be a KxN matrix, with K < N");
+      return retval;
+    }
+
+  std::vector<bitpack_word> g;
+  if (! pack_arg (g, args(0)))
+    {
+      error ("systematize: G must be a binary matrix");
+      return retval;
+    }
+
+  std::vector<int> piv;
+  int r = gf2_rref (g, k, n, piv);
+  if ((r < k) || ((nargout < 3) && (piv[k-1] != k - 1)))
+    {
+      error ("systematize: could not systematize matrix G");
+      return retval;
+    }
+
+  std::vector<int> perm = gf2_pivot_order (piv, k, n);
+
+  // Gx = [I P], with the columns of P in the order of perm
+  std::vector<bitpack_word> gx ((size_t)k * nw, 0);
+  int pw = BITPACK_WORDS (n - k);
+  std::vector<bitpack_word> p ((size_t)k * pw, 0);
+  for (int i = 0; i < k; i++)
+    {
+      const bitpack_word *gr = &g[(size_t)i*nw];
+      bitpack_set (&gx[(size_t)i*nw], i);
+      for (int j = k; j < n; j++)
+        if (bitpack_get (gr, perm[j]))
+          {
+            bitpack_set (&gx[(size_t)i*nw], j);
+            bitpack_set (&p[(size_t)i*pw], j - k);
+          }
+    }
+
+  retval(0) = unpack_rows (gx, k, n, lgcl);
+  retval(1) = unpack_rows (p, k, n - k, lgcl);
+  if (nargout > 2)
+    {
+      RowVector pv (n);
+      for (int j = 0; j < n; j++)
+        pv(j) = perm[j] + 1;
+      retval(2) = octave_value (pv);
+    }
+
+  return retval;
+}
+
+/*
+%% Test input validation
+%!error systematize ()
+%!error systematize (1, 2)
+%!error systematize (eye (3))
+%!error systematize ([1 1 0; 1 1 0])
+%!error systematize ([1 1 0; 0 0 1])
+
+%!test
+%! g = [1 1 1 1; 1 1 0 1; 1 0 0 1];
+%! [gx, p] = systematize (g);
+%! assert (gx, [1 0 0 1; 0 1 0 0; 0 0 1 0])
+%! assert (p, [1; 0; 0])
+
+%!test
+%! g = [1 1 0 1 0; 0 0 1 1 1];
+%! [gx, p, perm] = systematize (g);
+%! assert (perm, [1 3 2 4 5])
+%! assert (gx, [1 0 1 1 0; 0 1 0 1 1])
+%! assert (gx(:,3:5), p)
+
+%!test
+%! ## Parity check matrix of an LDPC-sized code
+%! h = [rand(500, 1500) < 0.01, logical(eye (500))];
+%! h = h(:,randperm (2000));
+%! [hx, p, perm] = systematize (h);
+%! assert (islogical (hx))
+%! r = size (hx, 1);
+%! assert (hx(:,1:r), logical (eye (r)))
+%! g = gen2par (hx);
+%! assert (any (mod (double (g) * double (h(:,perm))', 2)(:)), false)
+*/
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
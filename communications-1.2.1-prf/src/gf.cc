@@ -39,6 +39,8 @@ for a GPL release of his code
 
 #include "galois.h"
 #include "ov-galois.h"
+#include "ov-sparse-galois.h"
+#include "bitslice.h"
 
 static bool galois_type_loaded = false;
 
@@ -57,7 +59,9 @@ Return 1 if the value of the expression @var{expr} is a Galois Field.\n\
     return octave_value (0.);
   else
     return octave_value (args(0).type_id () ==
-                        octave_galois::static_type_id ());
+                         octave_galois::static_type_id ()
+                         || args(0).type_id () ==
+                         octave_sparse_galois::static_type_id ());
   return octave_value ();
 }
 
@@ -92,10 +96,18 @@ The output of this function is recognized as a Galois field by Octave and\n\
 other matrices will be converted to the same Galois field when used in an\n\
 arithmetic operation with a Galois field.\n\
 \n\
+If @var{x} is a sparse matrix, a sparse Galois array is created, that only\n\
+stores its non-zero elements. Sparse Galois arrays can be added to,\n\
+multiplied with, multiplied element by element with, compared with and\n\
+concatenated with full and sparse Galois arrays and matrices, and can be\n\
+transposed, indexed, assigned to and passed to @code{grank} and\n\
+@code{grref}. These are computed from their non-zero elements, so that the\n\
+parity check matrices of long LDPC codes can be used directly. Use\n\
+@code{full} to convert them to full Galois arrays for the other operations.\n\
+\n\
 @seealso{isprimitive, primpoly}\n\
 @end deftypefn")
 {
-  Matrix data;
   octave_value retval;
   int nargin = args.length ();
   int m = 1;
@@ -107,7 +119,6 @@ arithmetic operation with a Galois field.\n\
       return retval;
     }
 
-  data = args(0).matrix_value ();
   if (nargin > 1)
     m = args(1).int_value ();
   if (nargin > 2)
@@ -121,11 +132,19 @@ arithmetic operation with a Galois field.\n\
       install_gm_m_ops ();
       install_s_gm_ops ();
       install_gm_s_ops ();
+      octave_sparse_galois::register_type ();
+      install_sgm_sgm_ops ();
+      install_sgm_gm_ops ();
+      install_sgm_m_ops ();
       galois_type_loaded = true;
       mlock ();
     }
 
-  retval = new octave_galois (data, m, primpoly);
+  if (args(0).is_sparse_type ())
+    retval = new octave_sparse_galois (args(0).sparse_matrix_value (), m,
+                                       primpoly);
+  else
+    retval = new octave_galois (args(0).matrix_value (), m, primpoly);
   return retval;
 }
 
@@ -133,6 +152,94 @@ arithmetic operation with a Galois field.\n\
 %% Test input validation
 %!error gf ()
 %!error gf (1, 2, 3, 4)
+
+%!test
+%! ## GF(2^16) multiplication is done in the composite field GF((2^8)^2)
+%! alpha = gf (2, 16);
+%! assert (isequal (alpha.^1234 .* alpha.^40000, alpha.^41234))
+%! a = gf ([1, 2, 300, 65535; 4711, 0, 9, 32768], 16, 69643);
+%! b = gf ([7, 40000, 5, 65535; 1, 3, 12345, 2], 16, 69643);
+%! assert (isequal ((a .* b) ./ b, a))
+%! assert (isequal ((a * b.') * inv (b * b.'), a * b.' / (b * b.')))
+
+%!test
+%! ## Sparse Galois arrays
+%! h = [1 1 0 1 1 0 0; 1 0 1 1 0 1 0; 0 1 1 1 0 0 1];
+%! H = gf (sparse (h));
+%! assert (issparse (H) && isgalois (H))
+%! assert (nnz (H), 12)
+%! assert (isequal (full (H), gf (h)))
+%! assert (isequal (full (H'), gf (h')))
+%! [~, g] = cyclgen (7, [1 1 0 1]);
+%! assert (isequal (H * gf (g'), gf (mod (h * g', 2))))
+%! assert (isequal (gf (g) * H', gf (mod (g * h', 2))))
+%! assert (isequal (g * H', gf (mod (g * h', 2))))
+%! assert (isequal (full (H * H'), gf (mod (h * h', 2))))
+%! assert (nnz (H + H), 0)
+%! assert (grank (H), 3)
+
+%!test
+%! a = [0 3 0 1; 5 0 7 0; 0 0 2 6];
+%! s = gf (sparse (a), 3);
+%! b = gf ([1 2; 3 4; 5 6; 7 0], 3);
+%! assert (isequal (s * b, gf (a, 3) * b))
+%! assert (isequal (b' * s', b' * gf (a', 3)))
+%! assert (isequal (full (s(2:3, [1 3])), gf (a(2:3, [1 3]), 3)))
+%! assert (s.m, 3)
+%! assert (s.x, sparse (a))
+%! assert (rank (s), 3)
+%! assert (grank (s(:, [1 1 3])), 2)
+
+%!test
+%! ## Element by element products, comparisons, concatenation and indexed
+%! ## assignment keep the arrays sparse
+%! a = [0 3 0 1; 5 0 7 0; 0 0 2 6];
+%! b = [1 0 0 4; 2 6 0 0; 0 0 3 0];
+%! s = gf (sparse (a), 3);
+%! t = gf (sparse (b), 3);
+%! assert (issparse (s .* t))
+%! assert (isequal (full (s .* t), gf (a, 3) .* gf (b, 3)))
+%! assert (isequal (full (s .* gf (b, 3)), gf (a, 3) .* gf (b, 3)))
+%! assert (isequal (full (3 .* s), gf (a, 3) .* 3))
+%! assert (issparse (s == t))
+%! assert (full (s == t), a == b)
+%! assert (full (s != t), a != b)
+%! assert (full (s == 0), a == 0)
+%! assert (full (s != gf (b, 3)), a != b)
+%! c = [s t];
+%! assert (issparse (c) && isgalois (c))
+%! assert (isequal (full (c), gf ([a b], 3)))
+%! c = [s; t];
+%! assert (isequal (full (c), gf ([a; b], 3)))
+%! c = [s, gf(b, 3); t, sparse(b)];
+%! assert (issparse (c))
+%! assert (isequal (full (c), gf ([a b; b b], 3)))
+%! s(2, 3) = 4;
+%! s(1, :) = gf (sparse ([0 0 7 0]), 3);
+%! s(3, 4) = 0;
+%! a(2, 3) = 4;
+%! a(1, :) = [0 0 7 0];
+%! a(3, 4) = 0;
+%! assert (issparse (s))
+%! assert (isequal (full (s), gf (a, 3)))
+%! assert (nnz (s), nnz (a))
+
+%!test
+%! ## Sparse matrices are converted to the field of sparse Galois arrays
+%! a = [0 3 0 1; 5 0 7 0; 0 0 2 6];
+%! b = sparse ([1 0 0 4; 2 6 0 0; 0 0 3 0]);
+%! s = gf (sparse (a), 3);
+%! assert (issparse (s + b) && isgalois (s + b))
+%! assert (isequal (full (s + b), gf (a, 3) + gf (full (b), 3)))
+%! assert (isequal (full (b' * s), gf (full (b'), 3) * gf (a, 3)))
+%! assert (isequal (full (s .* b), gf (a, 3) .* gf (full (b), 3)))
+%! s(:, 2) = b(:, 1);
+%! a(:, 2) = b(:, 1);
+%! assert (isequal (full (s), gf (a, 3)))
+
+%!error <different Galois Fields> s = gf (sparse (1), 3); s(1) = gf (sparse (1), 4);
+%!error gf (sparse ([1 2]), 3) .* gf (sparse ([1 2 3]), 3)
+%!error <range> s = gf (sparse ([1 2]), 2); s(2) = 5;
 */
 
 static octave_value
@@ -575,6 +682,54 @@ modn (int x, int m, int n)
   return x;
 }
 
+// The recursion of filter below, carried out in the composite field basis
+static galois
+filter_tower (galois& b, galois& a, galois& x, galois& si)
+{
+  int ab_len = b.length ();
+  int si_len = si.length ();
+  bool have_a = (a.length () > 1);
+  galois retval (x.length (), 1, 0, b.m (), b.primpoly ());
+
+  int inorm = b.tower_inverse (b.to_tower_basis (a(0, 0)));
+  for (int i = 0; i < ab_len; i++)
+    b(i, 0) = b.tower_multiply (b.to_tower_basis (b(i, 0)), inorm);
+  if (have_a)
+    {
+      a.resize (dim_vector (ab_len, 1), 0);
+      for (int i = 0; i < ab_len; i++)
+        a(i, 0) = a.tower_multiply (a.to_tower_basis (a(i, 0)), inorm);
+    }
+  for (int i = 0; i < si_len; i++)
+    si(i, 0) = si.to_tower_basis (si(i, 0));
+
+  for (int i = 0; i < x.length (); i++)
+    {
+      int xi = x.to_tower_basis (x(i, 0));
+      int yi = b.tower_multiply (b(0, 0), xi);
+      if (si_len > 0)
+        yi ^= si(0, 0);
+      for (int j = 0; j < si_len - 1; j++)
+        {
+          si(j, 0) = si(j+1, 0) ^ b.tower_multiply (b(j+1, 0), xi);
+          if (have_a)
+            si(j, 0) ^= a.tower_multiply (a(j+1, 0), yi);
+        }
+      if (si_len > 0)
+        {
+          si(si_len-1, 0) = b.tower_multiply (b(si_len, 0), xi);
+          if (have_a)
+            si(si_len-1, 0) ^= a.tower_multiply (a(si_len, 0), yi);
+        }
+      retval(i, 0) = b.from_tower_basis (yi);
+    }
+
+  for (int i = 0; i < si_len; i++)
+    si(i, 0) = si.from_tower_basis (si(i, 0));
+
+  return retval;
+}
+
 galois
 filter (galois& b, galois& a, galois& x, galois& si)
 {
@@ -593,6 +748,8 @@ filter (galois& b, galois& a, galois& x, galois& si)
       error ("gfilter: si must be a vector of length max(length(a), length(b)) - 1");
       return galois ();
     }
+  if (b.have_tower ())
+    return filter_tower (b, a, x, si);
   if (norm != 1)
     {
       int idx_norm = b.index_of (norm);
@@ -893,6 +1050,12 @@ the initial state vector is set to all zeros.\n\
 %!error gfilter (1)
 %!error gfilter (1, 2)
 %!error gfilter (1, 2, 3, 4, 5)
+
+%!test
+%! b = gf ([3, 0, 40000], 16);
+%! x = gf ([1, 7, 65535, 0, 2], 16);
+%! y = gfilter (b, 1, x);
+%! assert (isequal (y, conv (b, x)(1:5)))
 */
 
 // PKG_ADD: autoload ("glu", "gf.oct");
@@ -1184,7 +1347,7 @@ DEFUN_DLD (grank, args, nargout,
   "-*- texinfo -*-\n\
 @deftypefn {Loadable Function} {@var{d} =} grank (@var{a})\n\
 Compute the rank of the Galois array @var{a} by counting the independent\n\
-rows and columns.\n\
+rows and columns. Sparse Galois arrays are reduced in sparse form.\n\
 @seealso{rank}\n\
 @end deftypefn")
 {
@@ -1200,6 +1363,15 @@ rows and columns.\n\
 
   octave_value arg = args(0);
 
+  if (galois_type_loaded
+      && (arg.type_id () == octave_sparse_galois::static_type_id ()))
+    {
+      // The sparse arrays are reduced without being made full
+      const octave_sparse_galois& s =
+        (const octave_sparse_galois&) arg.get_rep ();
+      return octave_value ((double)s.sparse_galois_value ().rank ());
+    }
+
   if (!galois_type_loaded || (arg.type_id () !=
                               octave_galois::static_type_id ()))
     {
@@ -1269,6 +1441,96 @@ rows and columns.\n\
 %!error grank (1, 2)
 */
 
+// PKG_ADD: autoload ("grref", "gf.oct");
+// PKG_DEL: autoload ("grref", "gf.oct", "remove");
+DEFUN_DLD (grref, args, nargout,
+  "-*- texinfo -*-\n\
+@deftypefn  {Loadable Function} {@var{r} =} grref (@var{a})\n\
+@deftypefnx {Loadable Function} {[@var{r}, @var{k}] =} grref (@var{a})\n\
+Reduce the Galois array @var{a} to its reduced row echelon form @var{r}.\n\
+The columns of the pivots are returned in @var{k}, so that the rank of\n\
+@var{a} is @code{numel (@var{k})}. Sparse Galois arrays are reduced in\n\
+sparse form, and @var{r} is then sparse.\n\
+@seealso{rref, grank}\n\
+@end deftypefn")
+{
+  octave_value_list retval;
+
+  int nargin = args.length ();
+
+  if (nargin != 1)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  octave_value arg = args(0);
+  std::vector<octave_idx_type> piv;
+
+  if (galois_type_loaded
+      && (arg.type_id () == octave_sparse_galois::static_type_id ()))
+    {
+      const octave_sparse_galois& s =
+        (const octave_sparse_galois&) arg.get_rep ();
+      retval(0) = new octave_sparse_galois
+        (s.sparse_galois_value ().rref (piv));
+    }
+  else if (galois_type_loaded
+           && (arg.type_id () == octave_galois::static_type_id ()))
+    {
+      // The full arrays are reduced in sparse form as well, as their rows
+      // then only hold the elements that are left
+      galois a = ((const octave_galois&) arg.get_rep ()).galois_value ();
+      retval(0) = new octave_galois (sparse_galois (a).rref (piv).full ());
+    }
+  else
+    {
+      gripe_wrong_type_arg ("grref", arg);
+      return retval;
+    }
+
+  if (nargout > 1)
+    {
+      RowVector k (piv.size ());
+      for (size_t i = 0; i < piv.size (); i++)
+        k(i) = piv[i] + 1;
+      retval(1) = k;
+    }
+
+  return retval;
+}
+
+/*
+%% Test input validation
+%!error grref ()
+%!error grref (1, 2)
+%!error grref ([1 0; 0 1])
+
+%!test
+%! a = gf ([0 2 4 1; 0 1 2 3; 0 3 6 2], 3);
+%! [r, k] = grref (a);
+%! assert (k, [2 4])
+%! assert (isequal (r, gf ([0 1 2 0; 0 0 0 1; 0 0 0 0], 3)))
+%! [rs, ks] = grref (gf (sparse (a.x), 3));
+%! assert (issparse (rs))
+%! assert (ks, k)
+%! assert (isequal (full (rs), r))
+
+%!test
+%! ## A generator from a sparse parity check matrix, with the message in
+%! ## the columns without a pivot
+%! h = cyclgen (15, cyclpoly (15, 7));
+%! H = gf (sparse ([h; mod(h(1, :) + h(2, :), 2)]));
+%! [r, k] = grref (H);
+%! assert (numel (k), grank (H))
+%! assert (isequal (r(1:8, k), gf (speye (8))))
+%! info = setdiff (1:15, k);
+%! g = gf (sparse (15, 7));
+%! g(info, :) = gf (speye (7));
+%! g(k, :) = r(1:8, info);
+%! assert (nnz (H * g), 0)
+*/
+
 // PKG_ADD: autoload ("rsenc", "gf.oct");
 // PKG_DEL: autoload ("rsenc", "gf.oct", "remove");
 DEFUN_DLD (rsenc, args, nargout,
@@ -1490,6 +1752,51 @@ The variable @var{parpos} controls this positioning and can take the values\n\
 
   int norm = genpoly(0, 0);
 
+  if (msg.have_tower ())
+    {
+      // Same division as below, but carried out in the composite field
+      // basis with the generator polynomial normalized by its first term
+      int inorm = genpoly.tower_inverse (genpoly.to_tower_basis (norm));
+      for (int i = 0; i < nroots+1; i++)
+        genpoly(i, 0) = genpoly.tower_multiply (genpoly.to_tower_basis (genpoly(i, 0)),
+                                                inorm);
+
+      msg.resize (dim_vector (nsym, n), 0);
+      if (! parity_at_end)
+        for (int l = 0; l < nsym; l++)
+          {
+            for (int i = k; i > 0; i--)
+              msg(l, i+nroots-1) = msg(l, i-1);
+            for (int i = 0; i < nroots; i++)
+              msg(l, i) = 0;
+          }
+
+      OCTAVE_LOCAL_BUFFER (int, par, nroots);
+      for (int l = 0; l < nsym; l++)
+        {
+          for (int j = 0; j < nroots; j++)
+            par[j] = 0;
+          for (int i = 0; i < k; i++)
+            {
+              int sym = (parity_at_end ? msg(l, i) : msg(l, n-i-1));
+              int feedback = par[0] ^ msg.to_tower_basis (sym);
+              for (int j = 1; j < nroots; j++)
+                par[j-1] = par[j] ^ msg.tower_multiply (feedback, genpoly(j, 0));
+              par[nroots-1] = msg.tower_multiply (feedback, genpoly(nroots, 0));
+            }
+          for (int j = 0; j < nroots; j++)
+            {
+              if (parity_at_end)
+                msg(l, k+j) = msg.from_tower_basis (par[j]);
+              else
+                msg(l, j) = msg.from_tower_basis (par[nroots-j-1]);
+            }
+        }
+
+      retval = new octave_galois (msg);
+      return retval;
+    }
+
   // Take logarithm of generator polynomial, for faster coding
   for (int i = 0; i < nroots+1; i++)
     genpoly(i, 0) = genpoly.index_of (genpoly(i, 0));
@@ -1609,7 +1916,27 @@ decode_rs(galois& data, const int prim, const int iprim, const int nroots,
   OCTAVE_LOCAL_BUFFER (int, loc, nroots);
 
   /* form the syndromes; i.e., evaluate data(x) at roots of g(x) */
-  if (msb_first)
+  if (data.have_tower ())
+    {
+      /* Horner evaluation in the composite field basis */
+      OCTAVE_LOCAL_BUFFER (int, rt, nroots);
+      for (i = 0; i < nroots; i++)
+        {
+          rt[i] = data.to_tower_basis (data.alpha_to (modn ((fcr+i)*prim, m, n)));
+          s[i] = 0;
+        }
+
+      for (j = 0; j < n; j++)
+        {
+          tmp = data.to_tower_basis (data(drow, (msb_first ? j : n-j-1)));
+          for (i = 0; i < nroots; i++)
+            s[i] = data.tower_multiply (s[i], rt[i]) ^ tmp;
+        }
+
+      for (i = 0; i < nroots; i++)
+        s[i] = data.from_tower_basis (s[i]);
+    }
+  else if (msb_first)
     {
       for (i = 0; i < nroots; i++)
         s[i] = data(drow, 0);
@@ -1722,29 +2049,58 @@ decode_rs(galois& data, const int prim, const int iprim, const int nroots,
     }
 
   /* Find roots of the error locator polynomial by Chien search */
-  memcpy(&reg[1], &lambda[1], nroots*sizeof (reg[0]));
   count = 0; /* Number of roots of lambda(x) */
-  for (i = 1, k = iprim-1; i <= n; i++, k = modn (k+iprim, m, n))
+  if (data.have_tower ())
     {
-      q = 1; /* lambda[0] is always 0 */
-      for (j = deg_lambda; j > 0; j--)
+      /* reg[j] is multiplied by alpha**j at each step */
+      OCTAVE_LOCAL_BUFFER (int, step, nroots+1);
+      for (j = 1; j <= deg_lambda; j++)
+        {
+          reg[j] = (lambda[j] == A0 ? 0 :
+                    data.to_tower_basis (data.alpha_to (lambda[j])));
+          step[j] = data.to_tower_basis (data.alpha_to (modn (j, m, n)));
+        }
+      for (i = 1, k = iprim-1; i <= n; i++, k = modn (k+iprim, m, n))
         {
-          if (reg[j] != A0)
+          q = 1; /* lambda[0] is always 0, and one is the same in both bases */
+          for (j = deg_lambda; j > 0; j--)
             {
-              reg[j] = modn (reg[j] + j, m, n);
-              q ^= data.alpha_to (reg[j]);
+              reg[j] = data.tower_multiply (reg[j], step[j]);
+              q ^= reg[j];
             }
+          if (q != 0)
+            continue; /* Not a root */
+          root[count] = i;
+          loc[count] = k;
+          if(++count == deg_lambda)
+            break;
+        }
+    }
+  else
+    {
+      memcpy(&reg[1], &lambda[1], nroots*sizeof (reg[0]));
+      for (i = 1, k = iprim-1; i <= n; i++, k = modn (k+iprim, m, n))
+        {
+          q = 1; /* lambda[0] is always 0 */
+          for (j = deg_lambda; j > 0; j--)
+            {
+              if (reg[j] != A0)
+                {
+                  reg[j] = modn (reg[j] + j, m, n);
+                  q ^= data.alpha_to (reg[j]);
+                }
+            }
+          if (q != 0)
+            continue; /* Not a root */
+          /* store root (index-form) and error location number */
+          root[count] = i;
+          loc[count] = k;
+          /* If we've already found max possible roots,
+           * abort the search to save time
+           */
+          if(++count == deg_lambda)
+            break;
         }
-      if (q != 0)
-        continue; /* Not a root */
-      /* store root (index-form) and error location number */
-      root[count] = i;
-      loc[count] = k;
-      /* If we've already found max possible roots,
-       * abort the search to save time
-       */
-      if(++count == deg_lambda)
-        break;
     }
   if (deg_lambda != count)
     {
@@ -2145,6 +2501,19 @@ treated with the least-significant symbol first.\n\
 %!error rsdec (1)
 %!error rsdec (1, 2)
 %!error rsdec (1, 2, 3, 4, 5, 6)
+
+%!test
+%! m = 16;
+%! n = 2^m - 1;
+%! k = n - 8;
+%! msg = gf (floor (2^m * rand (2, k)), m);
+%! code = rsenc (msg, n, k);
+%! err = zeros (2, n);
+%! err(1, 10) = 1;
+%! err(2, [20, 30000]) = [40000, 3];
+%! [dec, nerr] = rsdec (code + gf (err, m), n, k);
+%! assert (isequal (dec, msg))
+%! assert (nerr, [1; 2])
 */
 
 // PKG_ADD: autoload ("bchenco", "gf.oct");
@@ -2451,6 +2820,309 @@ the values @code{\"beginning\"} or @code{\"end\"}.\n\
 %!error bchenco (1, 2, 3, 4, 5, 6)
 */
 
+// Compute the error location polynomial of a binary BCH code from the
+// syndromes s(1..2t) in index form, with the Berlekamp iterative
+// algorithm. On return elp holds the polynomial in index form. Returns the
+// degree of the polynomial, or -1 if it is larger than t.
+static int
+bch_error_locator (const galois& tables, const Array<int>& s, int t,
+                   Array<int>& elp_out)
+{
+  int m = tables.m ();
+  int n = tables.n ();
+  int t2 = t << 1;
+
+  int q, u;
+  Array<int> d (dim_vector (t2+2, 1)), l(dim_vector (t2+2, 1)),
+    u_lu(dim_vector (t2+2, 1)), elp(dim_vector (t2+2, t2+2));
+
+  /*
+   * Compute the error location polynomial via the Berlekamp
+   * iterative algorithm. Following the terminology of Lin and
+   * Costello's book :   d(u) is the 'mu'th discrepancy, where
+   * u='mu'+1 and 'mu' (the Greek letter!) is the step number
+   * ranging from -1 to 2*t (see L&C),  l(u) is the degree of
+   * the elp at that step, and u_l(u) is the difference between
+   * the step number and the degree of the elp.
+   */
+  /* initialise table entries */
+  d(0) = 0;          /* index form */
+  d(1) = s(1);       /* index form */
+  elp(0, 0) = 0;     /* index form */
+  elp(1, 0) = 1;     /* polynomial form */
+  for (int i = 1; i < t2; i++)
+    {
+      elp(0, i) = n; /* index form */
+      elp(1, i) = 0; /* polynomial form */
+    }
+  l(0) = 0;
+  l(1) = 0;
+  u_lu(0) = -1;
+  u_lu(1) = 0;
+  u = 0;
+
+  do
+    {
+      u++;
+      if (d(u) == n)
+        {
+          l(u + 1) = l(u);
+          for (int i = 0; i <= l(u); i++)
+            {
+              elp(u + 1, i) = elp(u, i);
+              elp(u, i) = tables.index_of (elp(u, i));
+            }
+        }
+      else
+        /*
+         * search for words with greatest u_lu(q) for
+         * which d(q)!=0
+         */
+        {
+          q = u - 1;
+          while ((d(q) == n) && (q > 0))
+            q--;
+          /* have found first non-zero d(q)  */
+          if (q > 0)
+            {
+              int j = q;
+              do
+                {
+                  j--;
+                  if ((d(j) != n) && (u_lu(q) < u_lu(j)))
+                    q = j;
+                }
+              while (j > 0);
+            }
+
+          /*
+           * have now found q such that d(u)!=0 and
+           * u_lu(q) is maximum
+           */
+          /* store degree of new elp polynomial */
+          if (l(u) > l(q) + u - q)
+            l(u + 1) = l(u);
+          else
+            l(u + 1) = l(q) + u - q;
+
+          /* form new elp(x) */
+          for (int i = 0; i < t2; i++)
+            elp(u + 1, i) = 0;
+          for (int i = 0; i <= l(q); i++)
+            if (elp(q, i) != n)
+              elp(u + 1, i + u - q) =
+                tables.alpha_to (modn ((d(u) + n - d(q) + elp(q, i)), m, n));
+          for (int i = 0; i <= l(u); i++)
+            {
+              elp(u + 1, i) ^= elp(u, i);
+              elp(u, i) = tables.index_of (elp(u, i));
+            }
+        }
+      u_lu(u + 1) = u - l(u + 1);
+
+      /* form (u+1)th discrepancy */
+      if (u < t2)
+        {
+          /* no discrepancy computed on last iteration */
+          d(u + 1) = tables.alpha_to (s(u + 1));
+
+          for (int i = 1; i <= l(u + 1); i++)
+            if ((s(u + 1 - i) != n) && (elp(u + 1, i) != 0))
+              d(u + 1) ^= tables.alpha_to (modn (s(u + 1 - i)
+                                                 + tables.index_of (elp(u + 1, i)),
+                                                 m, n));
+          /* put d(u+1) into index form */
+          d(u + 1) = tables.index_of (d(u + 1));
+        }
+    }
+  while ((u < t2) && (l(u + 1) <= t));
+
+  u++;
+  if (l(u) > t)
+    return -1;
+
+  elp_out.resize (dim_vector (l(u)+1, 1));
+  for (int i = 0; i <= l(u); i++)
+    elp_out(i) = tables.index_of (elp(u, i));
+
+  return l(u);
+}
+
+// Decode a batch of binary BCH codewords with bit-sliced syndrome
+// computation, Chien search and correction. The code is processed in
+// blocks of __OCTAVE_BITSLICE_LANES codewords, transposed so that bit j of
+// every codeword of the block is held in one plane. Only the error location
+// polynomial is computed one codeword at a time, and only for the
+// codewords with a non-zero syndrome.
+static void
+bchdeco_bitslice (const galois& tables, Matrix& code, ColumnVector& nerr,
+                  int t, bool parity_at_end)
+{
+  const int W = __OCTAVE_BITSLICE_WORDS;
+  const int L = __OCTAVE_BITSLICE_LANES;
+  int m = tables.m ();
+  int n = tables.n ();
+  int nsym = code.rows ();
+  int nn = code.cols ();
+  int t2 = t << 1;
+
+  OCTAVE_LOCAL_BUFFER (bitslice_word, c, nn * W);
+  OCTAVE_LOCAL_BUFFER (bitslice_word, syn, (t2 + 1) * m * W);
+  OCTAVE_LOCAL_BUFFER (bitslice_word, reg, (t + 1) * m * W);
+  OCTAVE_LOCAL_BUFFER (bitslice_word, tmp, m * W);
+  OCTAVE_LOCAL_BUFFER (bitslice_word, q, m * W);
+  OCTAVE_LOCAL_BUFFER (bitslice_word, root, n * W);
+  OCTAVE_LOCAL_BUFFER (bitslice_word, any, W);
+  OCTAVE_LOCAL_BUFFER (int, deg, L);
+
+  // Multiplication by alpha^j, j = 1..t, as linear maps for the Chien search
+  OCTAVE_LOCAL_BUFFER (int, cols, (t + 1) * m);
+  for (int j = 1; j <= t; j++)
+    for (int b = 0; b < m; b++)
+      cols[j*m+b] = tables.alpha_to (modn (j + b, m, n));
+
+  for (int l0 = 0; l0 < nsym; l0 += L)
+    {
+      OCTAVE_QUIT;
+
+      int nlanes = (nsym - l0 < L ? nsym - l0 : L);
+
+      // Transpose the codewords into bit planes, c(j) being the
+      // coefficient of x^j
+      for (int j = 0; j < nn; j++)
+        {
+          bitslice_word *cj = c + j * W;
+          int col = (parity_at_end ? nn-j-1 : j);
+          bitslice_clear (cj);
+          for (int lane = 0; lane < nlanes; lane++)
+            if (code(l0+lane, col) != 0)
+              bitslice_set_lane (cj, lane);
+        }
+
+      // Syndromes s(i) = c(alpha^i), one plane per bit of each syndrome
+      for (int i = 0; i < (t2 + 1) * m * W; i++)
+        syn[i] = 0;
+      for (int j = 0; j < nn; j++)
+        {
+          const bitslice_word *cj = c + j * W;
+          if (! bitslice_any (cj))
+            continue;
+          for (int i = 1; i <= t2; i++)
+            {
+              int a = tables.alpha_to (modn (i*j, m, n));
+              for (int b = 0; b < m; b++)
+                if (a & (1<<b))
+                  bitslice_xor (syn + (i * m + b) * W, cj);
+            }
+        }
+
+      bitslice_clear (any);
+      for (int i = m; i < (t2 + 1) * m; i++)
+        bitslice_or (any, syn + i * W);
+
+      for (int lane = 0; lane < nlanes; lane++)
+        nerr(l0+lane) = 0;
+
+      if (! bitslice_any (any))
+        continue;
+
+      // Error location polynomials, one codeword at a time, loaded back
+      // into bit planes. Codewords without errors, or with too many, keep
+      // the polynomial 1 which has no roots
+      for (int i = 0; i < (t + 1) * m * W; i++)
+        reg[i] = 0;
+      int maxdeg = 0;
+      for (int lane = 0; lane < nlanes; lane++)
+        {
+          deg[lane] = 0;
+          if (! bitslice_lane (any, lane))
+            continue;
+
+          Array<int> s (dim_vector (t2+1, 1), 0);
+          for (int i = 1; i <= t2; i++)
+            {
+              int si = 0;
+              for (int b = 0; b < m; b++)
+                if (bitslice_lane (syn + (i * m + b) * W, lane))
+                  si |= (1<<b);
+              s(i) = tables.index_of (si);
+            }
+
+          Array<int> elp;
+          deg[lane] = bch_error_locator (tables, s, t, elp);
+          for (int j = 1; j <= deg[lane]; j++)
+            if (elp(j) != n)
+              {
+                int a = tables.alpha_to (elp(j));
+                for (int b = 0; b < m; b++)
+                  if (a & (1<<b))
+                    bitslice_set_lane (reg + (j * m + b) * W, lane);
+              }
+          if (deg[lane] > maxdeg)
+            maxdeg = deg[lane];
+        }
+
+      // Chien search. At step i, reg(j) holds elp(j) * alpha^(i*j) and
+      // the codewords for which elp(alpha^i) is zero have an error at
+      // position n - i
+      for (int i = 1; i <= n; i++)
+        {
+          for (int b = 0; b < m * W; b++)
+            q[b] = 0;
+          for (int j = 1; j <= maxdeg; j++)
+            {
+              bitslice_word *rj = reg + j * m * W;
+              bitslice_gf_mul_const (tmp, rj, cols + j * m, m);
+              for (int b = 0; b < m * W; b++)
+                rj[b] = tmp[b];
+              for (int b = 0; b < m * W; b++)
+                q[b] ^= tmp[b];
+            }
+
+          // The sum must be one, as elp(0) is one
+          bitslice_word *ri = root + (n - i) * W;
+          for (int w = 0; w < W; w++)
+            ri[w] = ~q[w];
+          for (int b = 1; b < m; b++)
+            bitslice_or (ri, q + b * W);
+          for (int w = 0; w < W; w++)
+            ri[w] = ~ri[w] & any[w];
+        }
+
+      // Number of roots equal to the degree means at most t errors, which
+      // are corrected. Otherwise the codeword is flagged as uncorrectable
+      for (int lane = 0; lane < nlanes; lane++)
+        {
+          if (! bitslice_lane (any, lane))
+            continue;
+          if (deg[lane] < 0)
+            {
+              nerr(l0+lane) = -1;
+              continue;
+            }
+
+          // An error outside of a shortened codeword can not be corrected
+          int count = 0;
+          for (int j = 0; j < n; j++)
+            if (bitslice_lane (root + j * W, lane))
+              count += (j < nn ? 1 : t + 1);
+          if (count != deg[lane])
+            {
+              nerr(l0+lane) = -1;
+              continue;
+            }
+
+          nerr(l0+lane) = deg[lane];
+          for (int j = 0; j < nn; j++)
+            if (bitslice_lane (root + j * W, lane))
+              {
+                int col = (parity_at_end ? nn-j-1 : j);
+                code(l0+lane, col) = (int)code(l0+lane, col) ^ 1;
+              }
+        }
+    }
+}
+
 // PKG_ADD: autoload ("bchdeco", "gf.oct");
 // PKG_DEL: autoload ("bchdeco", "gf.oct", "remove");
 DEFUN_DLD (bchdeco, args, ,
@@ -2590,195 +3262,97 @@ can take the values @code{\"beginning\"} or @code{\"end\"}.\n\
   galois tables (1, 1, 0, m, prim);
   ColumnVector nerr (nsym, 0);
 
-  for (int lsym = 0; lsym < nsym; lsym++)
-    {
-      /* first form the syndromes */
-      Array<int> s (dim_vector(t2+1, 1), 0);
-      bool syn_error = false;
-
-      for (int i = 1; i <= t2; i++)
-        {
-          for (int j = 0; j < nn; j++)
-            {
-              if (parity_at_end)
-                {
-                  if (code(lsym, nn-j-1) != 0)
-                    s(i) ^= tables.alpha_to (modn (i*j, m, n));
-                }
-              else
-                {
-                  if (code(lsym, j) != 0)
-                    s(i) ^= tables.alpha_to (modn (i*j, m, n));
-                }
-            }
-          if (s(i) != 0)
-            syn_error = true; /* set error flag if non-zero syndrome */
-
-        }
-
-      if (syn_error)
-        {    /* if there are errors, try to correct them */
-          int q, u;
-          Array<int> d (dim_vector (t2+2, 1)), l(dim_vector (t2+2, 1)),
-            u_lu(dim_vector (t2+2, 1)), reg(dim_vector (t2+2, 1)),
-            elp(dim_vector (t2+2, t2+2));
+  if ((m <= 8) && (nsym >= 64))
+    bchdeco_bitslice (tables, code, nerr, t, parity_at_end);
+  else
+    for (int lsym = 0; lsym < nsym; lsym++)
+      {
+        /* first form the syndromes */
+        Array<int> s (dim_vector(t2+1, 1), 0);
+        bool syn_error = false;
 
-          /* convert syndrome from polynomial form to index form  */
-          for (int i = 1; i <= t2; i++)
-            s(i) = tables.index_of (s(i));
+        for (int i = 1; i <= t2; i++)
+          {
+            for (int j = 0; j < nn; j++)
+              {
+                if (parity_at_end)
+                  {
+                    if (code(lsym, nn-j-1) != 0)
+                      s(i) ^= tables.alpha_to (modn (i*j, m, n));
+                  }
+                else
+                  {
+                    if (code(lsym, j) != 0)
+                      s(i) ^= tables.alpha_to (modn (i*j, m, n));
+                  }
+              }
+            if (s(i) != 0)
+              syn_error = true; /* set error flag if non-zero syndrome */
 
-          /*
-           * Compute the error location polynomial via the Berlekamp
-           * iterative algorithm. Following the terminology of Lin and
-           * Costello's book :   d(u) is the 'mu'th discrepancy, where
-           * u='mu'+1 and 'mu' (the Greek letter!) is the step number
-           * ranging from -1 to 2*t (see L&C),  l(u) is the degree of
-           * the elp at that step, and u_l(u) is the difference between
-           * the step number and the degree of the elp.
-           */
-          /* initialise table entries */
-          d(0) = 0;          /* index form */
-          d(1) = s(1);       /* index form */
-          elp(0, 0) = 0;     /* index form */
-          elp(1, 0) = 1;     /* polynomial form */
-          for (int i = 1; i < t2; i++)
-            {
-              elp(0, i) = n; /* index form */
-              elp(1, i) = 0; /* polynomial form */
-            }
-          l(0) = 0;
-          l(1) = 0;
-          u_lu(0) = -1;
-          u_lu(1) = 0;
-          u = 0;
+          }
 
-          do
-            {
-              u++;
-              if (d(u) == n)
-                {
-                  l(u + 1) = l(u);
-                  for (int i = 0; i <= l(u); i++)
-                    {
-                      elp(u + 1, i) = elp(u, i);
-                      elp(u, i) = tables.index_of (elp(u, i));
-                    }
-                }
-              else
-                /*
-                 * search for words with greatest u_lu(q) for
-                 * which d(q)!=0
-                 */
-                {
-                  q = u - 1;
-                  while ((d(q) == n) && (q > 0))
-                    q--;
-                  /* have found first non-zero d(q)  */
-                  if (q > 0)
-                    {
-                      int j = q;
-                      do
+        if (syn_error)
+          {    /* if there are errors, try to correct them */
+            int q;
+            Array<int> reg (dim_vector (t2+2, 1)), elp;
+
+            /* convert syndrome from polynomial form to index form  */
+            for (int i = 1; i <= t2; i++)
+              s(i) = tables.index_of (s(i));
+
+            int deg = bch_error_locator (tables, s, t, elp);
+            if (deg >= 0)
+              {/* Can correct errors */
+                int count;
+                Array<int> loc (dim_vector (t+2, 1));
+
+                /* Chien search: find roots of the error location polynomial */
+                for (int i = 1; i <= deg; i++)
+                  reg(i) = elp(i);
+                count = 0;
+                for (int i = 1; i <= n; i++)
+                  {
+                    q = 1;
+                    for (int j = 1; j <= deg; j++)
+                      if (reg(j) != n)
                         {
-                          j--;
-                          if ((d(j) != n) && (u_lu(q) < u_lu(j)))
-                            q = j;
+                          reg(j) = modn ((reg(j) + j), m, n);
+                          q ^= tables.alpha_to (reg(j));
                         }
-                      while (j > 0);
-                    }
-
-                  /*
-                   * have now found q such that d(u)!=0 and
-                   * u_lu(q) is maximum
-                   */
-                  /* store degree of new elp polynomial */
-                  if (l(u) > l(q) + u - q)
-                    l(u + 1) = l(u);
-                  else
-                    l(u + 1) = l(q) + u - q;
-
-                  /* form new elp(x) */
-                  for (int i = 0; i < t2; i++)
-                    elp(u + 1, i) = 0;
-                  for (int i = 0; i <= l(q); i++)
-                    if (elp(q, i) != n)
-                      elp(u + 1, i + u - q) =
-                        tables.alpha_to (modn ((d(u) + n - d(q) + elp(q, i)), m, n));
-                  for (int i = 0; i <= l(u); i++)
-                    {
-                      elp(u + 1, i) ^= elp(u, i);
-                      elp(u, i) = tables.index_of (elp(u, i));
-                    }
-                }
-              u_lu(u + 1) = u - l(u + 1);
-
-              /* form (u+1)th discrepancy */
-              if (u < t2)
-                {
-                  /* no discrepancy computed on last iteration */
-                  d(u + 1) = tables.alpha_to (s(u + 1));
-
-                  for (int i = 1; i <= l(u + 1); i++)
-                    if ((s(u + 1 - i) != n) && (elp(u + 1, i) != 0))
-                      d(u + 1) ^= tables.alpha_to (modn (s(u + 1 - i)
-                                                         + tables.index_of (elp(u + 1, i)),
-                                                         m, n));
-                  /* put d(u+1) into index form */
-                  d(u + 1) = tables.index_of (d(u + 1));
-                }
-            }
-          while ((u < t2) && (l(u + 1) <= t));
-
-          u++;
-          if (l(u) <= t)
-            {/* Can correct errors */
-              int count;
-              Array<int> loc (dim_vector (t+2, 1));
-
-              /* put elp into index form */
-              for (int i = 0; i <= l(u); i++)
-                elp(u, i) = tables.index_of (elp(u, i));
-
-              /* Chien search: find roots of the error location polynomial */
-              for (int i = 1; i <= l(u); i++)
-                reg(i) = elp(u, i);
-              count = 0;
-              for (int i = 1; i <= n; i++)
-                {
-                  q = 1;
-                  for (int j = 1; j <= l(u); j++)
-                    if (reg(j) != n)
-                      {
-                        reg(j) = modn ((reg(j) + j), m, n);
-                        q ^= tables.alpha_to (reg(j));
+                    if (!q)
+                      { /* store root and error
+                                 * location number indices */
+                        loc(count) = n - i;
+                        count++;
+                        if (count > deg)
+                          break;
                       }
-                  if (!q)
-                    { /* store root and error
-                               * location number indices */
-                      loc(count) = n - i;
-                      count++;
-                      if (count > l(u))
-                        break;
-                    }
-                }
-
-              if (count == l(u))
-                {
-                  /* no. roots = degree of elp hence <= t errors */
-                  nerr(lsym) = l(u);
-                  for (int i = 0; i < l(u); i++)
-                    if (parity_at_end)
-                      code(lsym, nn-loc(i)-1) =
-                        (int)code(lsym, nn-loc(i)-1) ^ 1;
-                    else
-                      code(lsym, loc(i)) = (int)code(lsym, loc(i)) ^ 1;
-                }
-              else  /* elp has degree >t hence cannot solve */
-                nerr(lsym) = -1;
-            }
-          else
-            nerr(lsym) = -1;
-        }
-    }
+                  }
+
+                /* an error outside of a shortened codeword means that the
+                 * word can not be corrected */
+                for (int i = 0; i < count; i++)
+                  if (loc(i) >= nn)
+                    count = -1;
+
+                if (count == deg)
+                  {
+                    /* no. roots = degree of elp hence <= t errors */
+                    nerr(lsym) = deg;
+                    for (int i = 0; i < deg; i++)
+                      if (parity_at_end)
+                        code(lsym, nn-loc(i)-1) =
+                          (int)code(lsym, nn-loc(i)-1) ^ 1;
+                      else
+                        code(lsym, loc(i)) = (int)code(lsym, loc(i)) ^ 1;
+                  }
+                else  /* elp has degree >t hence cannot solve */
+                  nerr(lsym) = -1;
+              }
+            else
+              nerr(lsym) = -1;
+          }
+      }
 
   Matrix msg (nsym, k);
   if (parity_at_end)
@@ -2806,4 +3380,22 @@ can take the values @code{\"beginning\"} or @code{\"end\"}.\n\
 %!error bchdeco (1)
 %!error bchdeco (1, 2)
 %!error bchdeco (1, 2, 3, 4, 5, 6)
+
+%!test
+%! ## Batches of 64 or more codewords are decoded bit-sliced
+%! n = 31;
+%! k = 16;
+%! t = 3;
+%! msg = randi ([0 1], 200, k);
+%! code = bchenco (msg, n, k);
+%! for i = 1:200
+%!   idx = randperm (n, mod (i, 5));
+%!   code(i, idx) = ! code(i, idx);
+%! endfor
+%! [dec, nerr, ccode] = bchdeco (code, k, t);
+%! for i = 1:200
+%!   [d1, e1, c1] = bchdeco (code(i, :), k, t);
+%!   assert ([dec(i, :), nerr(i), ccode(i, :)], [d1, e1, c1])
+%! endfor
+%! assert (dec(nerr >= 0, :), msg(nerr >= 0, :))
 */
@@ -0,0 +1,329 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+#if !defined (octave_gf2poly_h)
+#define octave_gf2poly_h 1
+
+#include <vector>
+
+#include "bitpack.h"
+
+// A polynomial over GF(2) of any degree, the coefficient of x^i being
+// bit i of the packed words. The words above the leading term are
+// dropped, so that the zero polynomial has no words
+class
+gf2poly
+{
+public:
+
+  gf2poly (void) : w () { }
+
+  static gf2poly monomial (int d)
+  {
+    gf2poly r;
+    r.set (d);
+    return r;
+  }
+
+  // The polynomial whose coefficients are the bits of v
+  static gf2poly from_word (bitpack_word v)
+  {
+    gf2poly r;
+    if (v)
+      r.w.push_back (v);
+    return r;
+  }
+
+  bool is_zero (void) const { return w.empty (); }
+
+  int degree (void) const
+  {
+    if (w.empty ())
+      return -1;
+    int d = ((int)w.size () << 6) - 1;
+    bitpack_word top = w.back ();
+    while (! (top >> 63))
+      {
+        top <<= 1;
+        d--;
+      }
+    return d;
+  }
+
+  int coeff (int i) const
+  {
+    return ((i >> 6) < (int)w.size () ? bitpack_get (&w[0], i) : 0);
+  }
+
+  void set (int i)
+  {
+    if ((i >> 6) >= (int)w.size ())
+      w.resize ((i >> 6) + 1, 0);
+    bitpack_set (&w[0], i);
+  }
+
+  void flip (int i)
+  {
+    if ((i >> 6) >= (int)w.size ())
+      w.resize ((i >> 6) + 1, 0);
+    bitpack_flip (&w[0], i);
+    normalize ();
+  }
+
+  int weight (void) const
+  {
+    return (w.empty () ? 0 : bitpack_weight (&w[0], w.size ()));
+  }
+
+  const std::vector<bitpack_word>& words (void) const { return w; }
+
+  gf2poly& operator ^= (const gf2poly& b)
+  {
+    if (b.w.size () > w.size ())
+      w.resize (b.w.size (), 0);
+    for (size_t i = 0; i < b.w.size (); i++)
+      w[i] ^= b.w[i];
+    normalize ();
+    return *this;
+  }
+
+  // this += b * x^s
+  void add_shifted (const gf2poly& b, int s)
+  {
+    if (b.w.empty ())
+      return;
+    int ws = s >> 6;
+    int bs = s & 63;
+    size_t len = ws + b.w.size () + (bs ? 1 : 0);
+    if (len > w.size ())
+      w.resize (len, 0);
+    if (bs == 0)
+      for (size_t i = 0; i < b.w.size (); i++)
+        w[ws+i] ^= b.w[i];
+    else
+      for (size_t i = 0; i < b.w.size (); i++)
+        {
+          w[ws+i] ^= b.w[i] << bs;
+          w[ws+i+1] ^= b.w[i] >> (64 - bs);
+        }
+    normalize ();
+  }
+
+  // The sign of this - b, comparing the polynomials as binary integers
+  int compare (const gf2poly& b) const
+  {
+    if (w.size () != b.w.size ())
+      return (w.size () < b.w.size () ? -1 : 1);
+    for (size_t i = w.size (); i-- > 0; )
+      if (w[i] != b.w[i])
+        return (w[i] < b.w[i] ? -1 : 1);
+    return 0;
+  }
+
+  gf2poly& operator <<= (int s)
+  {
+    if (w.empty () || s == 0)
+      return *this;
+    int ws = s >> 6;
+    int bs = s & 63;
+    size_t len = w.size ();
+    w.resize (len + ws + 1, 0);
+    for (size_t i = len; i-- > 0; )
+      {
+        bitpack_word v = w[i];
+        w[i] = 0;
+        if (bs == 0)
+          w[i+ws] = v;
+        else
+          {
+            w[i+ws+1] |= v >> (64 - bs);
+            w[i+ws] |= v << bs;
+          }
+      }
+    normalize ();
+    return *this;
+  }
+
+  gf2poly operator << (int s) const
+  {
+    gf2poly r;
+    r.add_shifted (*this, s);
+    return r;
+  }
+
+  bool operator == (const gf2poly& b) const { return (w == b.w); }
+  bool operator != (const gf2poly& b) const { return (w != b.w); }
+
+  // Carry-less product, by four bits of a at a time with a table of the
+  // sixteen multiples of b
+  friend gf2poly operator * (const gf2poly& a, const gf2poly& b)
+  {
+    gf2poly r;
+    if (a.is_zero () || b.is_zero ())
+      return r;
+
+    size_t nb = b.w.size () + 1;
+    std::vector<bitpack_word> t (16 * nb, 0);
+    for (int j = 0; j < 4; j++)
+      for (size_t i = 0; i < b.w.size (); i++)
+        {
+          t[(1<<j)*nb+i] ^= b.w[i] << j;
+          if (j)
+            t[(1<<j)*nb+i+1] ^= b.w[i] >> (64 - j);
+        }
+    for (int v = 3; v < 16; v++)
+      if (v & (v - 1))
+        for (size_t i = 0; i < nb; i++)
+          t[v*nb+i] = t[(v & (v - 1))*nb+i] ^ t[(v & -v)*nb+i];
+
+    r.w.resize (a.w.size () + nb, 0);
+    for (size_t aw = 0; aw < a.w.size (); aw++)
+      for (int s = 0; s < 64; s += 4)
+        {
+          int v = (a.w[aw] >> s) & 15;
+          if (v == 0)
+            continue;
+          const bitpack_word *tv = &t[v*nb];
+          bitpack_word *rw = &r.w[aw];
+          if (s == 0)
+            for (size_t i = 0; i < nb; i++)
+              rw[i] ^= tv[i];
+          else
+            for (size_t i = 0; i < nb; i++)
+              {
+                rw[i] ^= tv[i] << s;
+                rw[i+1] ^= tv[i] >> (64 - s);
+              }
+        }
+    r.normalize ();
+    return r;
+  }
+
+  // The square, which over GF(2) spreads the coefficients of a to the
+  // even powers
+  static gf2poly sqr (const gf2poly& a)
+  {
+    gf2poly r;
+    r.w.resize (2 * a.w.size (), 0);
+    for (size_t i = 0; i < a.w.size (); i++)
+      {
+        r.w[2*i] = spread (a.w[i] & 0xFFFFFFFFULL);
+        r.w[2*i+1] = spread (a.w[i] >> 32);
+      }
+    r.normalize ();
+    return r;
+  }
+
+  // a = q * b + r, with the degree of r less than that of b
+  static void divmod (const gf2poly& a, const gf2poly& b, gf2poly& q,
+                      gf2poly& r)
+  {
+    int db = b.degree ();
+    r = a;
+    q = gf2poly ();
+    if (db < 0)
+      return;
+    for (int d = r.degree (); d >= db; d = r.degree ())
+      {
+        q.set (d - db);
+        r.add_shifted (b, d - db);
+      }
+  }
+
+  friend gf2poly operator % (const gf2poly& a, const gf2poly& b)
+  {
+    gf2poly q, r;
+    divmod (a, b, q, r);
+    return r;
+  }
+
+  friend gf2poly operator / (const gf2poly& a, const gf2poly& b)
+  {
+    gf2poly q, r;
+    divmod (a, b, q, r);
+    return q;
+  }
+
+  static gf2poly gcd (gf2poly a, gf2poly b)
+  {
+    while (! b.is_zero ())
+      {
+        gf2poly r = a % b;
+        a = b;
+        b = r;
+      }
+    return a;
+  }
+
+  static gf2poly mulmod (const gf2poly& a, const gf2poly& b,
+                         const gf2poly& p)
+  {
+    return (a * b) % p;
+  }
+
+  static gf2poly sqrmod (const gf2poly& a, const gf2poly& p)
+  {
+    return sqr (a) % p;
+  }
+
+  // a^e modulo p, by square and multiply from the leading bit of e
+  static gf2poly powmod (const gf2poly& a, uint64_t e, const gf2poly& p)
+  {
+    gf2poly r = monomial (0) % p;
+    gf2poly b = a % p;
+    for (int i = 63; i >= 0; i--)
+      {
+        if (! r.is_zero ())
+          r = sqrmod (r, p);
+        if ((e >> i) & 1)
+          r = mulmod (r, b, p);
+      }
+    return r;
+  }
+
+private:
+
+  // Interleave the 32 bits of x with zeros
+  static bitpack_word spread (bitpack_word x)
+  {
+    x = (x | (x << 16)) & 0x0000FFFF0000FFFFULL;
+    x = (x | (x << 8)) & 0x00FF00FF00FF00FFULL;
+    x = (x | (x << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    x = (x | (x << 2)) & 0x3333333333333333ULL;
+    x = (x | (x << 1)) & 0x5555555555555555ULL;
+    return x;
+  }
+
+  void normalize (void)
+  {
+    while (! w.empty () && (w.back () == 0))
+      w.pop_back ();
+  }
+
+  std::vector<bitpack_word> w;
+};
+
+#endif
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
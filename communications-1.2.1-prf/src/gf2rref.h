@@ -0,0 +1,136 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+#if !defined (octave_gf2rref_h)
+#define octave_gf2rref_h 1
+
+#include <algorithm>
+#include <vector>
+
+#include <octave/oct.h>
+
+#include "bitpack.h"
+
+// Reduce the k packed rows g of n columns to reduced row echelon form
+// over GF(2), the pivot of row i being in column piv[i]. Returns the
+// rank. The pivots are taken eight at a time, as in the method of Four
+// Russians: the candidate rows are reduced by the pivots of the block
+// found so far as they are searched, the block rows are reduced among
+// themselves, and then each other row is cleared in the pivot columns of
+// the block by a single exclusive or from a table of the 256 sums of the
+// block rows. The rows from the current one down are zero left of the
+// first column of the block, so the work starts at the word holding it
+static inline int
+gf2_rref (std::vector<bitpack_word>& g, int k, int n, std::vector<int>& piv)
+{
+  int nw = BITPACK_WORDS (n);
+  std::vector<bitpack_word> tab ((size_t)256 * nw, 0);
+  int r = 0;
+  int c = 0;
+
+  piv.resize (k);
+  while ((c < n) && (r < k))
+    {
+      OCTAVE_QUIT;
+
+      int w0 = c >> 6;
+      int t = 0;
+      for (; (c < n) && (t < 8) && (r + t < k); c++)
+        {
+          int p;
+          for (p = r + t; p < k; p++)
+            {
+              bitpack_word *pr = &g[(size_t)p*nw];
+              for (int s = 0; s < t; s++)
+                if (bitpack_get (pr, piv[r+s]))
+                  bitpack_xor (pr + w0, &g[(size_t)(r+s)*nw+w0], nw - w0);
+              if (bitpack_get (pr, c))
+                break;
+            }
+          if (p == k)
+            continue;
+
+          bitpack_word *pr = &g[(size_t)(r+t)*nw];
+          if (p != r + t)
+            std::swap_ranges (pr + w0, pr + nw, &g[(size_t)p*nw+w0]);
+          for (int s = 0; s < t; s++)
+            if (bitpack_get (&g[(size_t)(r+s)*nw], c))
+              bitpack_xor (&g[(size_t)(r+s)*nw+w0], pr + w0, nw - w0);
+          piv[r+t++] = c;
+        }
+
+      if (t == 0)
+        break;
+
+      for (int v = 1; v < (1 << t); v++)
+        {
+          int s = 0;
+          while (! ((v >> s) & 1))
+            s++;
+          bitpack_word *tv = &tab[(size_t)v*nw];
+          const bitpack_word *tu = &tab[(size_t)(v & (v - 1))*nw];
+          const bitpack_word *gs = &g[(size_t)(r+s)*nw];
+          for (int i = w0; i < nw; i++)
+            tv[i] = tu[i] ^ gs[i];
+        }
+
+      for (int q = 0; q < k; q++)
+        {
+          if (q == r)
+            q += t;
+          if (q >= k)
+            break;
+          bitpack_word *gq = &g[(size_t)q*nw];
+          int v = 0;
+          for (int s = 0; s < t; s++)
+            v |= bitpack_get (gq, piv[r+s]) << s;
+          if (v)
+            bitpack_xor (gq + w0, &tab[(size_t)v*nw+w0], nw - w0);
+        }
+
+      r += t;
+    }
+
+  return r;
+}
+
+// The columns of the pivots followed by the others, each in increasing
+// order
+static inline std::vector<int>
+gf2_pivot_order (const std::vector<int>& piv, int r, int n)
+{
+  std::vector<int> perm (piv.begin (), piv.begin () + r);
+  for (int c = 0, i = 0; c < n; c++)
+    {
+      if ((i < r) && (piv[i] == c))
+        i++;
+      else
+        perm.push_back (c);
+    }
+  return perm;
+}
+
+#endif
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
@@ -0,0 +1,191 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+
+#if !defined (octave_golomb_h)
+#define octave_golomb_h 1
+
+#include <stdint.h>
+
+#include <cmath>
+#include <vector>
+
+#include <octave/oct.h>
+
+#include "bitstream.h"
+
+// The largest integer of the signals, below which doubles are exact
+#define GOLOMB_MAX 9007199254740992.0
+
+// The Golomb code of parameter m. The quotient q = floor(s/m) of a
+// value s is written in unary, as q ones and a zero, followed by the
+// remainder r = s-q*m in binary: with c = ceil(log2(m)), the remainders
+// below limit = 2^c-m take c-1 bits, and the others are written as
+// r+limit in c bits. The Rice code of parameter k is the Golomb code of
+// m = 2^k, whose remainders all take k bits
+class golomb_code
+{
+public:
+
+  golomb_code (uint64_t _m) : m (_m), c (0)
+  {
+    while (((uint64_t)1 << c) < m)
+      c++;
+    limit = ((uint64_t)1 << c) - m;
+  }
+
+  // The length of the codeword of s
+  uint64_t length (uint64_t s) const
+  {
+    uint64_t q = s / m;
+    return q + 1 + (s - q*m < limit ? c - 1 : c);
+  }
+
+  // Write the codeword of s to w
+  void put (bitstream_writer& w, uint64_t s) const
+  {
+    uint64_t q = s / m;
+    uint64_t r = s - q*m;
+    w.mark ();
+    w.put_ones (q);
+    w.put (0, 1);
+    if (r < limit)
+      w.put (r, c - 1);
+    else
+      w.put (r + limit, c);
+  }
+
+  // Read a codeword from r into s. Returns false if the stream ends
+  // within it
+  bool get (bitstream_reader& r, double& s) const
+  {
+    uint64_t q, v = 0;
+    if (! r.get_unary (q))
+      return false;
+    if (c > 0)
+      {
+        if (! r.get (c - 1, v))
+          return false;
+        if (v >= limit)
+          {
+            uint64_t b;
+            if (! r.get (1, b))
+              return false;
+            v = ((v << 1) | b) - limit;
+          }
+      }
+    s = (double)q * m + v;
+    return true;
+  }
+
+private:
+
+  uint64_t m;
+  int c;
+  uint64_t limit;
+};
+
+// Read the signal arg of fcn into sig, reporting an error unless it
+// holds non-negative integers
+static bool
+golomb_get_signal (const octave_value& arg, const char *fcn,
+                   std::vector<uint64_t>& sig)
+{
+  const Matrix s = arg.matrix_value ();
+  sig.resize (s.numel ());
+  for (octave_idx_type i = 0; i < s.numel (); i++)
+    {
+      if (! (s(i) >= 0 && s(i) <= GOLOMB_MAX && s(i) == std::floor (s(i))))
+        {
+          error ("%s: all elements of SIG must be non-negative integers", fcn);
+          return false;
+        }
+      sig[i] = (uint64_t)s(i);
+    }
+  return true;
+}
+
+// Decode the code arg of fcn with g into sig: a cell array of codewords,
+// or a stream read by bitstream_load with nb, that must end with a
+// codeword
+static bool
+golomb_decode (const octave_value& arg, double nb, const golomb_code& g,
+               const char *fcn, RowVector& sig)
+{
+  std::vector<uint64_t> a;
+  uint64_t nbits;
+  std::vector<uint64_t> starts;
+  std::vector<double> out;
+  double s;
+
+  if (arg.is_cell ())
+    {
+      if (nb >= 0)
+        {
+          error ("%s: NBITS is only valid with a uint8 CODE", fcn);
+          return false;
+        }
+      if (! bitstream_load_cell (arg, fcn, "CODE", a, nbits, starts))
+        return false;
+
+      bitstream_reader r (a, nbits);
+      for (size_t k = 0; k < starts.size (); k++)
+        {
+          uint64_t end = (k + 1 < starts.size () ? starts[k+1] : nbits);
+          if (! g.get (r, s) || r.position () != end)
+            {
+              error ("%s: CODE{%d} is not a codeword", fcn, (int)k + 1);
+              return false;
+            }
+          out.push_back (s);
+        }
+    }
+  else
+    {
+      if (! bitstream_load (arg, nb, fcn, "CODE", a, nbits))
+        return false;
+
+      bitstream_reader r (a, nbits);
+      while (r.left () > 0)
+        {
+          if ((out.size () & 0xffff) == 0)
+            OCTAVE_QUIT;
+          if (! g.get (r, s))
+            {
+              error ("%s: CODE ends within a codeword", fcn);
+              return false;
+            }
+          out.push_back (s);
+        }
+    }
+
+  sig.resize (out.size ());
+  for (size_t i = 0; i < out.size (); i++)
+    sig(i) = out[i];
+  return true;
+}
+
+#endif
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
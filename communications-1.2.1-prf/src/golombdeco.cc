@@ -0,0 +1,120 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+
+
+#include <octave/oct.h>
+
+#include "golomb.h"
+
+DEFUN_DLD (golombdeco, args, ,
+  "-*- texinfo -*-\n\
+@deftypefn  {Loadable Function} {@var{sig} =} golombdeco (@var{code}, @var{m})\n\
+@deftypefnx {Loadable Function} {@var{sig} =} golombdeco (@var{code}, @var{m}, @var{nbits})\n\
+\n\
+Returns the Golomb decoded signal vector using @var{code} and @var{m}.\n\
+Compulsory m is need to be specified. A restrictions is that a\n\
+signal set must strictly be non-negative. The value of code\n\
+is a cell array of row-vectors which have the encoded Golomb value\n\
+for a single sample. The Golomb algorithm is\n\
+used to encode the \"code\" and only that can be meaningfully\n\
+decoded. @var{code} is assumed to have been of format generated\n\
+by the function @code{golombenco}. Also the parameter @var{m} must\n\
+be a positive integer.\n\
+This function works backward the Golomb algorithm see\n\
+@code{golombenco} for more details on that.\n\
+\n\
+@var{code} may also be the stream of the codewords, as a binary vector\n\
+or as a uint8 vector of packed bits, the first bit being the most\n\
+significant bit of its first element. The stream is then the first\n\
+@var{nbits} bits, by default all of them, and must end with a\n\
+codeword: the zeros padding the last element of a packed code would\n\
+otherwise be decoded, so that @var{nbits} should be given as returned\n\
+by @code{golombenco}. The stream is read 64 bits at a time, the\n\
+quotients being counted from the leading ones of a word.\n\
+\n\
+Reference: Solomon Golomb, Run length Encodings, 1966 IEEE Trans Info Theory\n\
+\n\
+An example of the use of @code{golombdeco} is\n\
+@example\n\
+@group\n\
+golombdeco (golombenco (1:4, 2), 2)\n\
+    @result{} [1 2 3 4]\n\
+golombdeco (uint8 ([101 192]), 2, 12)\n\
+    @result{} [1 2 3 4]\n\
+@end group\n\
+@end example\n\
+@seealso{golombenco}\n\
+@end deftypefn")
+{
+  octave_value_list retval;
+  int nargin = args.length ();
+
+  if (nargin < 2 || nargin > 3)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  double m = args(1).double_value ();
+  if (! (m >= 1 && m <= GOLOMB_MAX && m == std::floor (m)))
+    {
+      error ("golombdeco: M must be a positive integer");
+      return retval;
+    }
+
+  RowVector sig;
+  if (! golomb_decode (args(0), (nargin > 2 ? args(2).double_value () : -1),
+                       golomb_code ((uint64_t)m), "golombdeco", sig))
+    return retval;
+
+  retval(0) = octave_value (sig);
+  return retval;
+}
+
+/*
+%!assert (golombdeco (golombenco (1:4, 2), 2), [1:4])
+%!assert (golombdeco (golombenco (0:20, 1), 1), [0:20])
+
+%!test
+%! for m = 1:10
+%!   sig = randi ([0 255], 1, 100);
+%!   assert (golombdeco (golombenco (sig, m), m), sig)
+%!   assert (golombdeco (golombenco (sig, m, "dense"), m), sig)
+%!   [gcode, Ltot] = golombenco (sig, m, "packed");
+%!   assert (golombdeco (gcode, m, Ltot), sig)
+%! endfor
+
+%!error <CODE ends> golombdeco ([1 1 0 1], 3)
+%!error <CODE\{2\}> golombdeco ({[0 1], [1 0 0 0]}, 2)
+
+%% Test input validation
+%!error golombdeco ()
+%!error golombdeco (1)
+%!error golombdeco (1, 2)
+%!error golombdeco ({}, 0)
+%!error <NBITS> golombdeco ([0 1], 2, 2)
+*/
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
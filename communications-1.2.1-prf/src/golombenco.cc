@@ -0,0 +1,151 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+
+
+#include <vector>
+
+#include <octave/oct.h>
+
+#include "bitstream.h"
+#include "golomb.h"
+
+DEFUN_DLD (golombenco, args, nargout,
+  "-*- texinfo -*-\n\
+@deftypefn  {Loadable Function} {@var{gcode} =} golombenco (@var{sig}, @var{m})\n\
+@deftypefnx {Loadable Function} {@var{gcode} =} golombenco (@var{sig}, @var{m}, @var{format})\n\
+@deftypefnx {Loadable Function} {[@var{gcode}, @var{Ltot}] =} golombenco (@dots{})\n\
+\n\
+Returns the Golomb coded signal as cell array.\n\
+Also total length of output code in bits can be obtained.\n\
+This function uses a @var{m} need to be supplied for encoding signal vector\n\
+into a Golomb coded vector. A restrictions is that\n\
+a signal set must strictly be non-negative integers. Also the parameter\n\
+@var{m} must be a positive integer.\n\
+The Golomb algorithm [1], is used to encode the data into unary coded\n\
+quotient part which is represented as a set of 1's separated from\n\
+the K-part (binary) using a zero. This scheme doesn't need any\n\
+kind of dictionaries, it is a parameterized prefix codes.\n\
+Details of the scheme are, to\n\
+encode the remainder(r of number N) using the floor(log2(m)) bits\n\
+when rem is in range 0:(2^ceil(log2(m)) - N), and encode it as\n\
+r+(2^ceil(log2(m)) - N), using total of 2^ceil(log2(m)) bits\n\
+in other instance it doesn't belong to case 1. Quotient is coded\n\
+simply just using the unary code. Also according to [2] Golomb codes\n\
+are optimal for sequences using the Bernoulli probability model:\n\
+P(n)=p^n-1.q & p+q=1, and when M=[1/log2(p)], or P=2^(1/M).\n\
+\n\
+The codewords are returned in a cell array, unless @var{format} is\n\
+'dense' for a double row vector of their bits, 'logical' for a logical\n\
+one, or 'packed' for a uint8 row vector of eight bits per element, the\n\
+first bit being the most significant bit of the first element, and the\n\
+last element being padded with zeros. @var{format} may also be 'cell'\n\
+for the default. The codewords are written into 64-bit words, a whole\n\
+codeword at a time.\n\
+\n\
+Reference: 1. Solomon Golomb, Run length Encodings, 1966 IEEE Trans\n\
+Info' Theory. 2. Khalid Sayood, Data Compression, 3rd Edition\n\
+\n\
+An example of the use of @code{golombenco} is\n\
+@example\n\
+@group\n\
+golombenco (1:4, 2)\n\
+    @result{} @{[0 1], [1 0 0], [1 0 1], [1 1 0 0]@}\n\
+golombenco (1:10, 2)\n\
+    @result{} @{[0 1], [1 0 0], [1 0 1], [1 1 0 0],\n\
+        [1 1 0 1], [1 1 1 0 0], [1 1 1 0 1], [1 1 1 1 0 0],\n\
+        [1 1 1 1 0 1], [1 1 1 1 1 0 0]@}\n\
+golombenco (1:4, 2, \"packed\")\n\
+    @result{} [101 192]\n\
+@end group\n\
+@end example\n\
+@seealso{golombdeco}\n\
+@end deftypefn")
+{
+  octave_value_list retval;
+  int nargin = args.length ();
+
+  if (nargin < 2 || nargin > 3)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  double m = args(1).double_value ();
+  if (! (m >= 1 && m <= GOLOMB_MAX && m == std::floor (m)))
+    {
+      error ("golombenco: M must be a positive integer");
+      return retval;
+    }
+
+  bitstream_format fmt = BITSTREAM_CELL;
+  if (nargin > 2
+      && ! bitstream_get_format (args(2), "golombenco", true, fmt))
+    return retval;
+
+  std::vector<uint64_t> sig;
+  if (! golomb_get_signal (args(0), "golombenco", sig))
+    return retval;
+
+  golomb_code g ((uint64_t)m);
+  bitstream_writer w (fmt == BITSTREAM_CELL);
+  for (size_t i = 0; i < sig.size (); i++)
+    {
+      if ((i & 0xffff) == 0)
+        OCTAVE_QUIT;
+      g.put (w, sig[i]);
+    }
+
+  retval(0) = w.value (fmt);
+  if (nargout > 1)
+    retval(1) = octave_value ((double)w.size ());
+
+  return retval;
+}
+
+/*
+%!assert (golombenco (3:5, 5), {[0 1 1 0], [0 1 1 1], [1 0 0 0 ]})
+%!assert (golombenco (3:5, 3), {[1 0 0] , [1 0 1 0], [1 0 1 1]})
+%!assert (golombenco (0:2, 1), {[0], [1 0], [1 1 0]})
+%!assert (golombenco (1:4, 2, "dense"), [0 1 1 0 0 1 0 1 1 1 0 0])
+%!assert (golombenco (1:4, 2, "logical"), logical ([0 1 1 0 0 1 0 1 1 1 0 0]))
+%!assert (golombenco (1:4, 2, "packed"), uint8 ([101 192]))
+
+%!test
+%! [gcode, Ltot] = golombenco ([0 7 100], 6, "packed");
+%! assert (Ltot, numel ([golombenco([0 7 100], 6){:}]))
+%! assert (golombdeco (gcode, 6, Ltot), [0 7 100])
+
+%% Test input validation
+%!error golombenco ()
+%!error golombenco (1)
+%!error golombenco (1, 2, 3)
+%!error golombenco (1, 0)
+%!error <M must> golombenco (1, 2.5)
+%!error <non-negative> golombenco (-1, 2)
+%!error <non-negative> golombenco (1.5, 2)
+%!error <FORMAT> golombenco (1, 2, "foo")
+*/
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
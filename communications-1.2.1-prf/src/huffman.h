@@ -0,0 +1,289 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+
+#if !defined (octave_huffman_h)
+#define octave_huffman_h 1
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <vector>
+
+#include <octave/oct.h>
+#include <octave/Cell.h>
+
+#include "bitstream.h"
+
+// A prefix code, the codeword of the symbol i being the len[i] bits of
+// code[i], most significant first. The symbols with a length of 0 have
+// no codeword, as those of huffmandict marked with -1 and those of
+// shannonfanodict left empty
+struct huffman_code
+{
+  std::vector<uint64_t> code;
+  std::vector<int> len;
+  int minlen;
+  int maxlen;
+};
+
+// Read the dictionary arg of huffmandict, a cell array of binary row
+// vectors, reporting an error as fcn otherwise
+static bool
+get_huffman_dict (const octave_value& arg, const char *fcn, huffman_code& c)
+{
+  if (! arg.is_cell ())
+    {
+      error ("%s: DICT must be a dictionary from huffmandict", fcn);
+      return false;
+    }
+
+  Cell dict = arg.cell_value ();
+  octave_idx_type nsym = dict.numel ();
+  c.code.assign (nsym, 0);
+  c.len.assign (nsym, 0);
+  c.minlen = 64;
+  c.maxlen = 0;
+
+  for (octave_idx_type i = 0; i < nsym; i++)
+    {
+      Matrix w = dict(i).matrix_value ();
+      if (w.numel () == 0 || (w.numel () == 1 && w(0) == -1))
+        continue;
+
+      bool ok = (w.numel () > 0 && w.numel () <= 64);
+      uint64_t x = 0;
+      for (octave_idx_type j = 0; ok && (j < w.numel ()); j++)
+        {
+          ok = (w(j) == 0 || w(j) == 1);
+          x = (x << 1) | (w(j) != 0);
+        }
+      if (! ok)
+        {
+          error ("%s: DICT must hold binary codewords of 1 to 64 bits", fcn);
+          return false;
+        }
+
+      c.code[i] = x;
+      c.len[i] = w.numel ();
+      c.minlen = std::min (c.minlen, c.len[i]);
+      c.maxlen = std::max (c.maxlen, c.len[i]);
+    }
+
+  if (c.maxlen == 0)
+    {
+      error ("%s: DICT must have at least one codeword", fcn);
+      return false;
+    }
+
+  return true;
+}
+
+// Write the codewords of the symbols arg of fcn, integers from 1 to the
+// number of symbols of c, to w. Returns false after reporting an error
+// otherwise
+static bool
+huffman_encode (const octave_value& arg, const huffman_code& c,
+                const char *fcn, bitstream_writer& w)
+{
+  const Matrix sig = arg.matrix_value ();
+  octave_idx_type nsym = c.len.size ();
+
+  for (octave_idx_type i = 0; i < sig.numel (); i++)
+    {
+      double s = sig(i);
+      if (! (s >= 1 && s <= nsym && s == std::floor (s)))
+        {
+          error ("%s: all elements of SIG must be integers in the range [1,N]",
+                 fcn);
+          return false;
+        }
+      int k = (int)s - 1;
+      if (c.len[k] == 0)
+        {
+          error ("%s: symbol %d of SIG has no codeword in DICT", fcn, k + 1);
+          return false;
+        }
+      w.mark ();
+      w.put (c.code[k], c.len[k]);
+    }
+
+  return true;
+}
+
+// The number of bits of the lookup tables of the decoder
+#define HUFFMAN_TABLE_BITS 10
+
+// An entry of the lookup tables: a symbol whose codeword has len bits
+// in all, a subtable of 2^sub entries at value for the codewords
+// continuing beyond the table, or no codeword if len and sub are 0
+struct huffman_entry
+{
+  int32_t value;
+  int8_t len;
+  int8_t sub;
+};
+
+// Decoding with multi-level lookup tables. The first table is indexed
+// by the next HUFFMAN_TABLE_BITS bits of the stream, or fewer if all
+// the codewords are shorter, and gives the symbol of any codeword that
+// fits in it. The longer codewords with the same first bits share a
+// subtable indexed by the following bits, and so on
+class huffman_decoder
+{
+public:
+
+  // Build the tables of the code c. Returns false if it is not prefix
+  // free
+  bool build (const huffman_code& c)
+  {
+    std::vector<int> order;
+    for (size_t i = 0; i < c.len.size (); i++)
+      if (c.len[i] > 0)
+        order.push_back (i);
+
+    // The codewords aligned to the most significant bit, so that those
+    // with the same first bits are together once sorted
+    left.resize (c.len.size ());
+    for (size_t j = 0; j < order.size (); j++)
+      left[order[j]] = c.code[order[j]] << (64 - c.len[order[j]]);
+    std::sort (order.begin (), order.end (), [&] (int a, int b)
+      {
+        return (left[a] < left[b]
+                || (left[a] == left[b] && c.len[a] < c.len[b]));
+      });
+
+    table.clear ();
+    bits = std::min (HUFFMAN_TABLE_BITS, c.maxlen);
+    return fill (c, order, 0, order.size (), 0, bits);
+  }
+
+  // Decode the bits [pos, nbits) of the packed words a into the symbols
+  // sym, 1-based, advancing pos to the first bit not decoded. a must
+  // have two words more than the bits need. Returns the number of
+  // symbols, or -1 if the bits are not a sequence of codewords. If
+  // resync is true, the bit at a position where no codeword is found,
+  // or where the codeword does not end before nbits, is decoded as -1
+  // and skipped instead, so that every bit is decoded
+  octave_idx_type decode (const uint64_t *a, uint64_t& pos, uint64_t nbits,
+                          double *sym, bool resync = false) const
+  {
+    octave_idx_type n = 0;
+
+    while (pos < nbits)
+      {
+        if ((n & 0xffff) == 0)
+          OCTAVE_QUIT;
+
+        int w = bits;
+        int d = 0;
+        const huffman_entry *e = &table[bitstream_peek (a, pos, w)];
+        while (e->sub && pos + d + w < nbits)
+          {
+            d += w;
+            w = e->sub;
+            e = &table[e->value + bitstream_peek (a, pos + d, w)];
+          }
+
+        // The bits beyond the end of the stream are zeros, and a
+        // codeword reaching them is not in the stream
+        if (e->len == 0 || pos + e->len > nbits)
+          {
+            if (! resync)
+              return (e->sub || e->len || pos + d + w > nbits ? n : -1);
+            sym[n++] = -1;
+            pos++;
+            continue;
+          }
+
+        sym[n++] = e->value + 1;
+        pos += e->len;
+      }
+
+    return n;
+  }
+
+private:
+
+  // Fill a table of 2^w entries for the bits from d of the codewords
+  // order[lo] to order[hi-1]
+  bool fill (const huffman_code& c, const std::vector<int>& order,
+             size_t lo, size_t hi, int d, int w)
+  {
+    size_t base = table.size ();
+    huffman_entry none = {0, 0, 0};
+    table.resize (base + ((size_t)1 << w), none);
+
+    for (size_t j = lo; j < hi; )
+      {
+        int s = order[j];
+        uint64_t idx = (left[s] << d) >> (64 - w);
+        int l = c.len[s] - d;
+
+        if (l <= w)
+          {
+            // The entries of all the bits that may follow the codeword
+            for (uint64_t x = idx; x < idx + ((uint64_t)1 << (w - l)); x++)
+              {
+                huffman_entry& e = table[base + x];
+                if (e.len || e.sub)
+                  return false;
+                e.value = s;
+                e.len = c.len[s];
+              }
+            j++;
+          }
+        else
+          {
+            // The codewords with the same first d+w bits, continuing
+            // beyond this table
+            size_t k = j;
+            int maxlen = 0;
+            while (k < hi && c.len[order[k]] > d + w
+                   && ((left[order[k]] << d) >> (64 - w)) == idx)
+              maxlen = std::max (maxlen, c.len[order[k++]]);
+
+            if (table[base + idx].len || table[base + idx].sub)
+              return false;
+            int sub = std::min (HUFFMAN_TABLE_BITS, maxlen - d - w);
+            size_t off = table.size ();
+            if (! fill (c, order, j, k, d + w, sub))
+              return false;
+            table[base + idx].value = off;
+            table[base + idx].sub = sub;
+            j = k;
+          }
+      }
+
+    return true;
+  }
+
+  int bits;
+  std::vector<uint64_t> left;
+  std::vector<huffman_entry> table;
+};
+
+#endif
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
@@ -0,0 +1,170 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+
+#include <vector>
+
+#include <octave/oct.h>
+
+#include "bitstream.h"
+#include "huffman.h"
+
+DEFUN_DLD (huffmandeco, args, nargout,
+  "-*- texinfo -*-\n\
+@deftypefn  {Loadable Function} {@var{sig} =} huffmandeco (@var{hcode}, @var{dict})\n\
+@deftypefnx {Loadable Function} {@var{sig} =} huffmandeco (@var{hcode}, @var{dict}, @var{nbits})\n\
+@deftypefnx {Loadable Function} {[@var{sig}, @var{rest}] =} huffmandeco (@dots{})\n\
+Decode signal encoded by @code{huffmanenco}.\n\
+\n\
+This function uses a Huffman dictionary, created using @code{huffmandict},\n\
+and decodes the binary vector @var{hcode} into the row vector @var{sig}\n\
+of the indices of its symbols in @var{dict}.\n\
+\n\
+@var{hcode} may also be a uint8 vector of packed bits, the first bit of\n\
+the stream being the most significant bit of its first element, as\n\
+written by @code{huffmanenco}. The stream is then the first @var{nbits}\n\
+bits, by default all of them.\n\
+\n\
+If the stream ends with bits that do not make a whole codeword, they\n\
+are returned in the logical row vector @var{rest}, or with a single\n\
+output, -1 is appended to @var{sig} with a warning.\n\
+\n\
+The decoder looks the codewords up in tables of up to 1024 entries,\n\
+indexed by the next 10 bits of the stream, with further tables for the\n\
+longer codewords.\n\
+\n\
+@example\n\
+@group\n\
+hd = huffmandict (1:4, [0.5 0.25 0.15 0.10]);\n\
+hcode = huffmanenco (1:4, hd); # [1 0 1 0 0 0 0 0 1]\n\
+huffmandeco (hcode, hd)\n\
+    @result{} [1 2 3 4]\n\
+@end group\n\
+@end example\n\
+@seealso{huffmandict, huffmanenco}\n\
+@end deftypefn")
+{
+  octave_value_list retval;
+  int nargin = args.length ();
+
+  if (nargin < 2 || nargin > 3)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  // The stream in words of 64 bits, with two zero words after it
+  std::vector<uint64_t> a;
+  uint64_t nbits;
+
+  if (! bitstream_load (args(0), (nargin > 2 ? args(2).double_value () : -1),
+                        "huffmandeco", "HCODE", a, nbits))
+    return retval;
+
+  huffman_code c;
+  if (! get_huffman_dict (args(1), "huffmandeco", c))
+    return retval;
+
+  huffman_decoder dec;
+  if (! dec.build (c))
+    {
+      error ("huffmandeco: DICT must be a prefix-free code");
+      return retval;
+    }
+
+  // The symbols are written in place, there being at most one for each
+  // minlen bits
+  RowVector sig (nbits / c.minlen + 1);
+  uint64_t pos = 0;
+  octave_idx_type n = dec.decode (&a[0], pos, nbits, sig.fortran_vec ());
+  if (n < 0)
+    {
+      error ("huffmandeco: HCODE is not a sequence of codewords of DICT");
+      return retval;
+    }
+
+  if (nargout > 1)
+    {
+      boolMatrix rest (dim_vector (1, nbits - pos));
+      for (uint64_t i = pos; i < nbits; i++)
+        rest(i - pos) = (a[i >> 6] >> (63 - (i & 63))) & 1;
+      retval(1) = octave_value (rest);
+    }
+  else if (pos < nbits)
+    {
+      warning ("huffmandeco: could not decode last symbol");
+      sig(n++) = -1;
+    }
+
+  sig.resize (n);
+  retval(0) = octave_value (sig);
+  return retval;
+}
+
+/*
+%!assert (huffmandeco (huffmanenco (1:4, huffmandict (1:4, [0.5 0.25 0.15 0.10])), huffmandict (1:4, [0.5 0.25 0.15 0.10])), [1:4], 0)
+%!assert (huffmandeco (huffmanenco ([1:100 100:-1:1], huffmandict (1:100, ones (1, 100)/100)), huffmandict (1:100, ones (1, 100)/100)), [1:100 100:-1:1], 0)
+%!assert (huffmandeco ([huffmanenco(1:4, huffmandict (1:4, [0.5 0.25 0.15 0.10])) 0], huffmandict (1:4, [0.5 0.25 0.15 0.10])), [1:4 -1], 0)
+%!fail ("huffmandeco ([huffmanenco(1:4, huffmandict (1:4, [0.5 0.25 0.15 0.10])) 0], huffmandict (1:4, [0.5 0.25 0.15 0.10]))", "warning")
+%!fail ("huffmandeco ('this is not a code', huffmandict (1:4, [0.5 0.25 0.15 0.10]))")
+%!fail ("huffmandeco ([1 0 1 0], 'this is not a dictionary')")
+
+%!test
+%! ## Codewords longer than the first table, and the trailing bits
+%! p = 2 .^ -(1:24);
+%! p(end) *= 2;
+%! dict = huffmandict (1:24, p);
+%! sig = randi (24, 1, 1000);
+%! hcode = huffmanenco (sig, dict);
+%! assert (huffmandeco (hcode, dict), sig)
+%! [s, rest] = huffmandeco ([hcode ones(1, 5)], dict);
+%! assert (s, sig)
+%! assert (rest, true (1, 5))
+
+%!test
+%! ## Packed bits, most significant first
+%! dict = {[0], [1 0], [1 1 0], [1 1 1]};
+%! hcode = [0 1 0 1 1 0 1 1 1 0 0 1 1];
+%! packed = uint8 ([91 152]);
+%! [s, rest] = huffmandeco (packed, dict, 13);
+%! [s1, rest1] = huffmandeco (hcode, dict);
+%! assert (s, [1 2 3 4 1 1])
+%! assert (s1, s)
+%! assert (rest, true (1, 2))
+%! assert (rest1, rest)
+%! assert (huffmandeco (packed, dict), [1 2 3 4 1 1 3 1 1])
+
+%!error <prefix-free> huffmandeco ([0 1], {[0], [0 1]})
+%!error <sequence of codewords> huffmandeco ([1 1 0], {[0], [1 0]})
+
+%% Test input validation
+%!error huffmandeco ()
+%!error huffmandeco (1)
+%!error huffmandeco (1, 2, 3)
+%!error huffmandeco (1, 2)
+%!error huffmandeco (2, {})
+%!error <NBITS> huffmandeco (uint8 (1), {[0], [1]}, 9)
+*/
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
@@ -0,0 +1,447 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+
+#include <algorithm>
+#include <queue>
+#include <string>
+#include <vector>
+
+#include <octave/oct.h>
+#include <octave/Cell.h>
+
+// A node waiting to be merged. The nodes are merged as the list of the
+// original function was, smallest probability first and, among equal
+// probabilities, from the end of the list, given by the largest rank
+struct huffmandict_node
+{
+  double prob;
+  double rank;
+  int id;
+};
+
+struct huffmandict_later
+{
+  bool operator () (const huffmandict_node& a, const huffmandict_node& b) const
+  {
+    return (a.prob > b.prob || (a.prob == b.prob && a.rank < b.rank));
+  }
+};
+
+// The code tree of the n symbols of probabilities p, the leaves being
+// the nodes 0 to n-1 and the merged nodes the following ones, each node
+// being the child of parent[i] through the bit bit[i]. The symbols are
+// first listed by decreasing probability, and a merged node is put back
+// after the nodes of equal probability, or before them if minvar is
+// true. As in the original list, a merged node that would end the list
+// is put just before its last node instead, which swaps their bits in
+// the next merge
+static void
+huffmandict_tree (const Matrix& p, bool minvar, int one,
+                  std::vector<int>& parent, std::vector<int>& bit)
+{
+  int n = p.numel ();
+  std::vector<int> order (n);
+  for (int i = 0; i < n; i++)
+    order[i] = i;
+  std::stable_sort (order.begin (), order.end (), [&] (int a, int b)
+    {
+      return p(a) > p(b);
+    });
+
+  std::priority_queue<huffmandict_node, std::vector<huffmandict_node>,
+                      huffmandict_later> q;
+  for (int i = 0; i < n; i++)
+    q.push ({p(order[i]), (double)i, order[i]});
+
+  parent.assign (2*n - 1, -1);
+  bit.assign (2*n - 1, 0);
+  bool swap = false;
+
+  for (int s = 0; s < n - 1; s++)
+    {
+      huffmandict_node a = q.top ();
+      q.pop ();
+      huffmandict_node b = q.top ();
+      q.pop ();
+      if (swap)
+        std::swap (a, b);
+
+      int id = n + s;
+      parent[a.id] = parent[b.id] = id;
+      bit[a.id] = one;
+      bit[b.id] = 1 - one;
+
+      huffmandict_node c = {b.prob + a.prob, (minvar ? -1. - s : n + s), id};
+      swap = (! q.empty () && huffmandict_later () (q.top (), c));
+      q.push (c);
+    }
+}
+
+// The lengths len of the optimal prefix code of the n symbols of
+// probabilities p with codewords of at most maxlen bits, n being at most
+// 2^maxlen, by the package-merge algorithm. The list of each depth is
+// the symbols by increasing probability merged with the pairs of the
+// list of the next depth, and the code takes the first 2n-2 items of
+// the list of depth 1. Each symbol taken in a list, directly or within
+// the pairs taken, adds a bit to its codeword
+static void
+huffmandict_limit (const Matrix& p, int maxlen, std::vector<int>& len)
+{
+  int n = p.numel ();
+  std::vector<int> order (n);
+  for (int i = 0; i < n; i++)
+    order[i] = i;
+  std::stable_sort (order.begin (), order.end (), [&] (int a, int b)
+    {
+      return p(a) < p(b);
+    });
+
+  // The lists are kept as flags telling the symbols from the pairs
+  std::vector<std::vector<bool> > leaf (maxlen);
+  std::vector<double> cur (n), next;
+  for (int i = 0; i < n; i++)
+    cur[i] = p(order[i]);
+  leaf[maxlen-1].assign (n, true);
+
+  for (int d = maxlen - 2; d >= 0; d--)
+    {
+      size_t npairs = cur.size () / 2;
+      next.clear ();
+      leaf[d].clear ();
+      int i = 0;
+      size_t j = 0;
+      while (i < n || j < npairs)
+        {
+          double w = (j < npairs ? cur[2*j] + cur[2*j+1] : 0);
+          if (j == npairs || (i < n && p(order[i]) <= w))
+            {
+              next.push_back (p(order[i++]));
+              leaf[d].push_back (true);
+            }
+          else
+            {
+              next.push_back (w);
+              leaf[d].push_back (false);
+              j++;
+            }
+        }
+      cur.swap (next);
+    }
+
+  len.assign (n, 0);
+  size_t m = 2*n - 2;
+  for (int d = 0; d < maxlen && m > 0; d++)
+    {
+      size_t nleaf = 0;
+      for (size_t k = 0; k < m; k++)
+        nleaf += leaf[d][k];
+      for (size_t k = 0; k < nleaf; k++)
+        len[order[k]]++;
+      m = 2 * (m - nleaf);
+    }
+}
+
+DEFUN_DLD (huffmandict, args, nargout,
+  "-*- texinfo -*-\n\
+@deftypefn  {Loadable Function} {@var{dict} =} huffmandict (@var{symb}, @var{prob})\n\
+@deftypefnx {Loadable Function} {@var{dict} =} huffmandict (@var{symb}, @var{prob}, @var{toggle})\n\
+@deftypefnx {Loadable Function} {@var{dict} =} huffmandict (@var{symb}, @var{prob}, @var{toggle}, @var{minvar})\n\
+@deftypefnx {Loadable Function} {@var{dict} =} huffmandict (@dots{}, @var{prop}, @var{val}, @dots{})\n\
+@deftypefnx {Loadable Function} {[@var{dict}, @var{avglen}] =} huffmandict (@dots{})\n\
+Builds a Huffman code, given a probability list. The Huffman codes\n\
+per symbol are output as a list of strings-per-source symbol. A zero\n\
+probability symbol is assigned a codeword as any other symbol, and\n\
+a single symbol is assigned a codeword of one bit.\n\
+\n\
+@var{toggle} is an optional argument with values 1 or 0, that starts\n\
+building a code based on 1s or 0s, defaulting to 0. Also @var{minvar}\n\
+is a boolean value that is useful in choosing if you want to optimize\n\
+buffer for transmission in the applications of Huffman coding, however\n\
+it doesn't affect the type or average codeword length of the generated\n\
+code.\n\
+\n\
+The optional average length of the codewords @var{avglen} is\n\
+@code{sum (@var{prob} .* cellfun (@@numel, @var{dict}))}.\n\
+\n\
+The properties @var{prop} may be:\n\
+\n\
+@table @asis\n\
+@item \"maxlen\"\n\
+The largest number of bits of a codeword. If the Huffman code has longer\n\
+codewords, the code is replaced by the optimal code of the same symbols\n\
+whose codewords have at most @var{val} bits, found with the\n\
+package-merge algorithm. A code of more than @code{2^@var{val}} symbols\n\
+is an error. The codewords are canonical, as with the \"canonical\"\n\
+property.\n\
+\n\
+@item \"canonical\"\n\
+If @var{val} is true, the codewords are assigned canonically from their\n\
+lengths: by increasing length, the symbols of the same length in order,\n\
+each codeword is the binary number following the previous one, extended\n\
+with zeros to its length. The code is then given by the lengths alone.\n\
+With @var{toggle} equal to 1 the bits are inverted.\n\
+@end table\n\
+\n\
+The code is built with a heap of the nodes left to merge. The symbols\n\
+of equal probability may be given other codewords of the same average\n\
+length than by older versions of this function.\n\
+\n\
+An example of the use of @code{huffmandict} is\n\
+\n\
+@example\n\
+@group\n\
+huffmandict (symbols, [0.5 0.25 0.15 0.1], 1)\n\
+    @result{} @{[0], [1 0], [1 1 1], [1 1 0]@}\n\
+huffmandict (symbols, 0.25 * ones (1,4), 1)\n\
+    @result{} @{[1 1], [1 0], [0 1], [0 0]@}\n\
+\n\
+prob = [0.5 0 0.25 0.15 0.1];\n\
+dict = huffmandict (1:5, prob, 1);\n\
+entropy (prob)\n\
+    @result{} 2.3219\n\
+laverage (dict, prob)\n\
+    @result{} 1.8500\n\
+\n\
+x = [0.2 0.4 0.2 0.1 0.1];\n\
+huffmandict (1, x, 0, true)\n\
+    @result{} @{[1 0], [0 0], [1 1], [0 1 0], [0 1 1]@}\n\
+huffmandict (1, x)\n\
+    @result{} @{[0 1], [1], [0 0 1], [0 0 0 0], [0 0 0 1]@}\n\
+huffmandict (1, x, \"maxlen\", 3)\n\
+    @result{} @{[0 0], [0 1], [1 0], [1 1 0], [1 1 1]@}\n\
+@end group\n\
+@end example\n\
+\n\
+Reference: Dr.Rao's course EE5351 Digital Video Coding, at UT-Arlington.\n\
+@seealso{huffmandeco, huffmanenco}\n\
+@end deftypefn")
+{
+  octave_value_list retval;
+  int nargin = args.length ();
+
+  if (nargin < 2)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  const Matrix p = args(1).matrix_value ();
+  int n = p.numel ();
+  bool ok = (n > 0);
+  double sum = 0;
+  for (int i = 0; i < n; i++)
+    {
+      ok = ok && (p(i) >= 0 && p(i) <= 1);
+      sum += p(i);
+    }
+  if (! ok)
+    {
+      error ("huffmandict: PROB must be a vector of probabilities");
+      return retval;
+    }
+  if (sum - 1.0 > 1e-7)
+    {
+      error ("huffmandict: the elements of PROB must add up to 1");
+      return retval;
+    }
+
+  // The optional toggle and minvar, then the properties
+  int one = 1;
+  bool minvar = false;
+  int i = 2;
+  for (; i < 4 && i < nargin && ! args(i).is_string (); i++)
+    {
+      bool v = args(i).bool_value ();
+      if (i == 2)
+        one = (v ? 0 : 1);
+      else
+        minvar = v;
+    }
+
+  int maxlen = 0;
+  bool canonical = false;
+  for (; i < nargin; i += 2)
+    {
+      if (! args(i).is_string () || i + 1 == nargin)
+        {
+          error ("huffmandict: properties must be given as name and value");
+          return retval;
+        }
+      std::string prop = args(i).string_value ();
+      if (prop == "maxlen")
+        {
+          double v = args(i+1).double_value ();
+          if (! (v >= 1 && v <= 64 && v == std::floor (v)))
+            {
+              error ("huffmandict: MAXLEN must be an integer from 1 to 64");
+              return retval;
+            }
+          maxlen = (int)v;
+          canonical = true;
+        }
+      else if (prop == "canonical")
+        canonical = canonical || args(i+1).bool_value ();
+      else
+        {
+          error ("huffmandict: unknown property %s", prop.c_str ());
+          return retval;
+        }
+    }
+
+  if (maxlen > 0 && maxlen < 31 && n > (1 << maxlen))
+    {
+      error ("huffmandict: MAXLEN is too small for the number of symbols");
+      return retval;
+    }
+
+  std::vector<int> parent, bit, len (n, 1);
+  if (n > 1)
+    {
+      huffmandict_tree (p, minvar, one, parent, bit);
+
+      // The depths of the nodes, whose parents follow them
+      std::vector<int> depth (2*n - 1, 0);
+      int deepest = 0;
+      for (int j = 2*n - 3; j >= 0; j--)
+        {
+          depth[j] = depth[parent[j]] + 1;
+          if (j < n)
+            {
+              len[j] = depth[j];
+              deepest = std::max (deepest, len[j]);
+            }
+        }
+
+      if (maxlen > 0 && deepest > maxlen)
+        huffmandict_limit (p, maxlen, len);
+    }
+
+  Cell dict (1, n);
+  if (canonical)
+    {
+      std::vector<int> order (n);
+      for (int j = 0; j < n; j++)
+        order[j] = j;
+      std::stable_sort (order.begin (), order.end (), [&] (int a, int b)
+        {
+          return len[a] < len[b];
+        });
+
+      // The codeword as a binary number, incremented from one symbol
+      // to the next
+      std::vector<char> code;
+      for (int j = 0; j < n; j++)
+        {
+          int s = order[j];
+          if (j > 0)
+            {
+              int b = code.size () - 1;
+              for (; b >= 0 && code[b]; b--)
+                code[b] = 0;
+              code[b] = 1;
+            }
+          code.resize (len[s], 0);
+
+          Matrix w (1, len[s]);
+          for (int b = 0; b < len[s]; b++)
+            w(b) = code[b] ^ (1 - one);
+          dict(s) = w;
+        }
+    }
+  else
+    for (int s = 0; s < n; s++)
+      {
+        Matrix w (1, len[s]);
+        if (n == 1)
+          w(0) = 1 - one;
+        else
+          for (int j = s, b = len[s] - 1; b >= 0; j = parent[j], b--)
+            w(b) = bit[j];
+        dict(s) = w;
+      }
+
+  if (nargout > 1)
+    {
+      double avglen = 0;
+      for (int s = 0; s < n; s++)
+        avglen += p(s) * len[s];
+      retval(1) = octave_value (avglen);
+    }
+
+  retval(0) = octave_value (dict);
+  return retval;
+}
+
+/*
+%!assert (huffmandict (1:4, [0.5 0.25 0.15 0.1], 1), {[0], [1 0], [1 1 1], [1 1 0]}, 0)
+%!assert (huffmandict (1:4, 0.25*ones (1, 4), 1), {[1 1], [1 0], [0 1], [0 0]}, 0)
+%!assert (huffmandict (1:4, [1 0 0 0 ]), {[1], [0 1], [0 0 0], [0 0 1]}, 0)
+%!assert (huffmandict (1, [0.2 0.4 0.2 0.1 0.1], 0, true), {[1 0], [0 0], [1 1], [0 1 0], [0 1 1]}, 0)
+%!assert (huffmandict (1, [0.2 0.4 0.2 0.1 0.1]), {[0 1], [1], [0 0 1], [0 0 0 0], [0 0 0 1]}, 0)
+%!assert (huffmandict (1, 1), {0})
+
+%!test
+%! ## Length limited and canonical codes
+%! [dict, avglen] = huffmandict (1, [0.2 0.4 0.2 0.1 0.1], "maxlen", 3);
+%! assert (dict, {[0 0], [0 1], [1 0], [1 1 0], [1 1 1]})
+%! assert (avglen, 2.2, 1e-12)
+%! [dict, avglen] = huffmandict (1, [0.2 0.4 0.2 0.1 0.1], "canonical", true);
+%! assert (dict, {[1 0], [0], [1 1 0], [1 1 1 0], [1 1 1 1]})
+%! assert (avglen, 2.2, 1e-12)
+
+%!test
+%! ## Probabilities decreasing geometrically give a code of n-1 bits,
+%! ## limited to 16 bits with a small loss
+%! p = 2 .^ -(1:40);
+%! p(end) *= 2;
+%! [dict, avglen] = huffmandict (1:40, p);
+%! assert (max (cellfun (@numel, dict)), 39)
+%! assert (avglen, 2 - 2^-38, 1e-12)
+%! [dict, avg16] = huffmandict (1:40, p, "maxlen", 16);
+%! assert (max (cellfun (@numel, dict)), 16)
+%! assert (sum (2 .^ -cellfun (@numel, dict)) <= 1)
+%! assert (avg16 < avglen + 1e-3)
+%! sig = randi (40, 1, 1000);
+%! assert (huffmandeco (huffmanenco (sig, dict), dict), sig)
+
+%!test
+%! ## Large alphabets
+%! p = rand (1, 65536);
+%! p /= sum (p);
+%! [dict, avglen] = huffmandict (1:65536, p);
+%! assert (abs (avglen - sum (p .* cellfun (@numel, dict))) < 1e-9)
+%! assert (sum (2 .^ -cellfun (@numel, dict)), 1, 1e-12)
+
+%% Test input validation
+%!error huffmandict ()
+%!error huffmandict (1)
+%!error huffmandict (1, [0.5 0.5 0.5])
+%!error <probabilities> huffmandict (1, [0.5 -0.5 1])
+%!error <MAXLEN> huffmandict (1, [0.5 0.5], "maxlen", 0)
+%!error <too small> huffmandict (1, 0.2 * ones (1, 5), "maxlen", 2)
+%!error <unknown property> huffmandict (1, [0.5 0.5], "foo", 1)
+*/
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
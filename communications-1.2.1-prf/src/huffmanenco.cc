@@ -0,0 +1,122 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+
+#include <octave/oct.h>
+
+#include "bitstream.h"
+#include "huffman.h"
+
+DEFUN_DLD (huffmanenco, args, nargout,
+  "-*- texinfo -*-\n\
+@deftypefn  {Loadable Function} {@var{hcode} =} huffmanenco (@var{sig}, @var{dict})\n\
+@deftypefnx {Loadable Function} {@var{hcode} =} huffmanenco (@var{sig}, @var{dict}, @var{format})\n\
+@deftypefnx {Loadable Function} {[@var{hcode}, @var{nbits}] =} huffmanenco (@dots{})\n\
+\n\
+Returns the Huffman encoded signal using @var{dict}. This function uses\n\
+a @var{dict} built from the @code{huffmandict} and uses it to encode a\n\
+signal list into a Huffman list. A restrictions is that a signal set must\n\
+strictly belong in the range @code{[1,N]} with @code{N = length (dict)}.\n\
+Also @var{dict} can only be from the @code{huffmandict} routine.\n\
+\n\
+The code is returned as a row vector of doubles, unless @var{format} is\n\
+'logical', or is 'packed' for a uint8 row vector of eight bits per\n\
+element, the first bit being the most significant bit of the first\n\
+element, and the last element being padded with zeros. @var{format} may\n\
+also be 'dense' for the default. The optional output @var{nbits} is the\n\
+number of bits of the code, for @code{huffmandeco}.\n\
+\n\
+An example of the use of @code{huffmanenco} is\n\
+\n\
+@example\n\
+@group\n\
+hd = huffmandict (1:4, [0.5 0.25 0.15 0.10]);\n\
+huffmanenco (1:4, hd)\n\
+    @result{} [1 0 1 0 0 0 0 0 1]\n\
+huffmanenco (1:4, hd, \"packed\")\n\
+    @result{} [160 128]\n\
+@end group\n\
+@end example\n\
+@seealso{huffmandict, huffmandeco}\n\
+@end deftypefn")
+{
+  octave_value_list retval;
+  int nargin = args.length ();
+
+  if (nargin < 2 || nargin > 3)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  bitstream_format fmt = BITSTREAM_DENSE;
+  if (nargin > 2
+      && ! bitstream_get_format (args(2), "huffmanenco", false, fmt))
+    return retval;
+
+  huffman_code c;
+  if (! get_huffman_dict (args(1), "huffmanenco", c))
+    return retval;
+
+  bitstream_writer w;
+  if (! huffman_encode (args(0), c, "huffmanenco", w))
+    return retval;
+
+  retval(0) = w.value (fmt);
+  if (nargout > 1)
+    retval(1) = octave_value ((double)w.size ());
+
+  return retval;
+}
+
+/*
+%!assert (huffmanenco (1:4, huffmandict (1:4, [0.5 0.25 0.15 0.10])), [1 0 1 0 0 0 0 0 1], 0)
+%!assert (huffmanenco (1:4, huffmandict (1:4, [0.5 0.25 0.15 0.10]), "logical"), logical ([1 0 1 0 0 0 0 0 1]))
+%!assert (huffmanenco (1:4, huffmandict (1:4, [0.5 0.25 0.15 0.10]), "packed"), uint8 ([160 128]))
+
+%!test
+%! ## Packed codes of long codewords
+%! p = 2 .^ -(1:64);
+%! p(end) *= 2;
+%! dict = huffmandict (1:64, p);
+%! sig = randi (64, 1, 1000);
+%! [hcode, nbits] = huffmanenco (sig, dict, "packed");
+%! bits = huffmanenco (sig, dict);
+%! assert (nbits, numel (bits))
+%! assert (numel (hcode), ceil (nbits / 8))
+%! unpacked = reshape (dec2bin (double (hcode), 8)' - "0", 1, []);
+%! assert (unpacked(1:nbits), bits)
+%! assert (huffmandeco (hcode, dict, nbits), sig)
+
+%% Test input validation
+%!error huffmanenco ()
+%!error huffmanenco (1)
+%!error huffmanenco (1, 2)
+%!error huffmanenco (1, 2, 3)
+%!error huffmanenco (1, {})
+%!error <range> huffmanenco (5, huffmandict (1:4, [0.5 0.25 0.15 0.10]))
+%!error <FORMAT> huffmanenco (1, huffmandict (1:4, [0.5 0.25 0.15 0.10]), "foo")
+*/
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
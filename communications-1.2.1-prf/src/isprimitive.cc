@@ -18,36 +18,27 @@
 // program with any Open Source program, as defined by the Open Source
 // Initiative (www.opensource.org)
 
+#include <cmath>
+#include <vector>
+
 #include <octave/oct.h>
 
+#include "primitive.h"
+
+// The primitivity of the polynomial with the coefficients in the bits
+// of hi:lo, the cofactors of 2^m-1 being computed once for each m
 static bool
-do_isprimitive (const int& a, const int& m)
+do_isprimitive (bitpack_word hi, bitpack_word lo,
+                std::vector<std::vector<uint64_t> >& cof)
 {
-  // Fast return since primitive polynomial can't be even
-  if (!(a & 1))
-    return false;
-
-  RowVector repr (1<<m, 0);
-  int mask = 1;
-  int n = (1<<m) - 1;
-
-  repr(0) = 1;
-  for (int i = 0; i < n; i++)
-    {
-      repr(mask) = 1;
-      mask <<= 1;
-      if (mask & (1<<m))
-        mask ^= a;
-    }
-
-  if (mask != 1)
+  int m = (hi ? 64 : primitive_degree (lo));
+  if (m < 1)
     return false;
 
-  for (int i = 0; i < n+1; i++)
-    if (!repr(i))
-      return false;
+  if (cof[m].empty () && (m > 1))
+    cof[m] = primitive_cofactors (m);
 
-  return true;
+  return primitive_test (lo & primitive_mask (m), m, cof[m]);
 }
 
 DEFUN_DLD (isprimitive, args, nargout,
@@ -77,7 +68,7 @@ polynomial of GF(2). Otherwise it returns zero.\n\
     {
       for (int j = 0; j < a.columns (); j++)
         {
-          if (((int)a(i, j) != 0) && ((int)a(i, j) != 1))
+          if ((a(i, j) != 0) && (a(i, j) != 1))
             {
               poly = false;
               break;
@@ -86,28 +77,34 @@ polynomial of GF(2). Otherwise it returns zero.\n\
       if (!poly) break;
     }
 
+  std::vector<std::vector<uint64_t> > cof (65);
+
   if (poly)
     {
-      if (a.columns () > 24)
-        {
-          error ("isprimitive: order of the primitive polynomial must "
-                 "be less than 22");
-          return retval;
-        }
-
+      int nc = a.columns ();
       Matrix b (a.rows (), 1);
 
       for (int i = 0; i < a.rows (); i++)
         {
-          int tmp = (int)a(i, 0);
-          for (int j = 1; j < a.columns (); j++)
-            tmp = (tmp << 1) | (int)a(i, j);
+          int j0 = 0;
+          while ((j0 < nc) && (a(i, j0) == 0))
+            j0++;
+          if (nc - j0 > 65)
+            {
+              error ("isprimitive: order of the primitive polynomial must "
+                     "be at most 64");
+              return retval;
+            }
 
-          int m = 1;
-          while (tmp > (1<<(m+1)))
-            m++;
+          // The highest order term is first
+          bitpack_word hi = 0, lo = 0;
+          for (int j = j0; j < nc; j++)
+            {
+              hi = (hi << 1) | (lo >> 63);
+              lo = (lo << 1) | (bitpack_word)a(i, j);
+            }
 
-          b(i, 0) = do_isprimitive (tmp, m);
+          b(i, 0) = do_isprimitive (hi, lo, cof);
         }
       retval = octave_value (b);
     }
@@ -115,26 +112,20 @@ polynomial of GF(2). Otherwise it returns zero.\n\
     {
       for (int i = 0; i < a.rows (); i++)
         for (int j = 0; j < a.columns (); j++)
-          if (a(i, j) > (1<<23))
+          if ((a(i, j) < 0) || (a(i, j) >= 9007199254740992.)
+              || (a(i, j) != std::floor (a(i, j))))
             {
-              error ("isprimitive: order of the primitive polynomial must "
-                     "be less than 22");
+              error ("isprimitive: the integer representation of the "
+                     "polynomials must be below 2^53");
               return retval;
             }
 
       Matrix b (a.rows (), a.columns ());
 
       for (int i = 0; i < a.rows (); i++)
-        {
-          for (int j = 0; j < a.columns (); j++)
-            {
-              int m = 1;
-              while (a(i, j) > (1<<(m+1)))
-                m++;
+        for (int j = 0; j < a.columns (); j++)
+          b(i, j) = do_isprimitive (0, (bitpack_word)a(i, j), cof);
 
-              b(i, j) = do_isprimitive ((int)a(i, j), m);
-            }
-        }
       retval = octave_value (b);
     }
 
@@ -145,6 +136,20 @@ polynomial of GF(2). Otherwise it returns zero.\n\
 %% Test input validation
 %!error isprimitive ()
 %!error isprimitive (1, 2)
+%!error isprimitive (0.5)
+
+%!assert (isprimitive ([11 13 15 19 21 25 31]), [1 1 0 1 0 1 0])
+%!assert (isprimitive ([1 0 1 1; 1 1 1 1]), [1; 0])
+%!assert (isprimitive (primpoly (20, "all", "nodisplay")), ones (1, 24000))
+%!assert (isprimitive (2^52 + 2^3 + 1), 1)
+%!assert (isprimitive (2^52 + 2^7 + 1), 0)
+%!test
+%! ## Degree 64, x^64 + x^4 + x^3 + x + 1
+%! p = zeros (1, 65);
+%! p([1, 61, 62, 64, 65]) = 1;
+%! assert (isprimitive (p), 1)
+%! p(62) = 0;
+%! assert (isprimitive (p), 0)
 */
 
 /*
@@ -0,0 +1,787 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <octave/oct.h>
+#include <octave/dSparse.h>
+#include <octave/oct-map.h>
+#include <octave/int32NDArray.h>
+#include <octave/uint64NDArray.h>
+
+#include "bitpack.h"
+#include "gf2rref.h"
+#include "parallel.h"
+
+// PKG_ADD: autoload ("ldpcencode", "ldpccode.oct");
+// PKG_DEL: autoload ("ldpcencode", "ldpccode.oct", "remove");
+// PKG_ADD: autoload ("ldpcdecode", "ldpccode.oct");
+// PKG_DEL: autoload ("ldpcdecode", "ldpccode.oct", "remove");
+
+// The number of frames decoded together, one in each lane of the
+// message arrays. The loops over the lanes have no dependencies between
+// iterations, so that the compiler can vectorize them
+#define LDPC_LANES 16
+
+// The parity check matrix of an LDPC code as returned by ldpccode. Its
+// edges are numbered row by row, and the edge e joins its row to the
+// column col[e], the edges of row i being rowptr[i] to rowptr[i+1]-1.
+// The message bits are in the columns info of the codewords. If par is
+// empty the last m columns of the matrix are lower triangular, and the
+// parity bits are found in order from the rows. Otherwise par holds the
+// rows of the reduced row echelon form of the matrix, bit-packed, and
+// the parity bit of row i is in the column piv[i]
+struct ldpc_code
+{
+  int n;
+  int m;
+  int k;
+  int32NDArray rowptr;
+  int32NDArray col;
+  int32NDArray info;
+  int32NDArray piv;
+  uint64NDArray par;
+};
+
+static const int32_t *
+ldpc_ptr (const int32NDArray& a)
+{
+  return reinterpret_cast<const int32_t *> (a.data ());
+}
+
+// The fields of a code returned by ldpccode, with their sizes checked so
+// that the kernels can index the arrays freely
+static bool
+get_ldpccode (const octave_value& arg, const char *fcn, ldpc_code& code)
+{
+  if (! arg.is_map ())
+    {
+      error ("%s: LDPC must be a code returned by ldpccode", fcn);
+      return false;
+    }
+
+  octave_scalar_map s = arg.scalar_map_value ();
+  if (! (s.isfield ("n") && s.isfield ("m") && s.isfield ("k")
+         && s.isfield ("rowptr") && s.isfield ("col") && s.isfield ("info")
+         && s.isfield ("piv") && s.isfield ("par")))
+    {
+      error ("%s: LDPC must be a code returned by ldpccode", fcn);
+      return false;
+    }
+
+  code.n = s.getfield ("n").int_value ();
+  code.m = s.getfield ("m").int_value ();
+  code.k = s.getfield ("k").int_value ();
+  code.rowptr = s.getfield ("rowptr").int32_array_value ();
+  code.col = s.getfield ("col").int32_array_value ();
+  code.info = s.getfield ("info").int32_array_value ();
+  code.piv = s.getfield ("piv").int32_array_value ();
+  code.par = s.getfield ("par").uint64_array_value ();
+
+  bool valid = ((code.n > 0) && (code.m >= 0) && (code.k > 0)
+                && (code.k <= code.n)
+                && (code.rowptr.numel () == code.m + 1)
+                && (code.info.numel () == code.k));
+
+  const int32_t *rowptr = ldpc_ptr (code.rowptr);
+  const int32_t *col = ldpc_ptr (code.col);
+  for (int i = 0; valid && (i < code.m); i++)
+    valid = ((rowptr[i] >= 0) && (rowptr[i] <= rowptr[i+1]));
+  valid = valid && (rowptr[0] == 0) && (rowptr[code.m] == code.col.numel ());
+  for (octave_idx_type e = 0; valid && (e < code.col.numel ()); e++)
+    valid = ((col[e] >= 0) && (col[e] < code.n));
+
+  const int32_t *info = ldpc_ptr (code.info);
+  for (int j = 0; valid && (j < code.k); j++)
+    valid = ((info[j] >= 0) && (info[j] < code.n));
+
+  if (valid && (code.par.numel () != 0))
+    {
+      int r = code.n - code.k;
+      const int32_t *piv = ldpc_ptr (code.piv);
+      valid = ((code.piv.numel () == r) && (code.par.rows () == BITPACK_WORDS (code.n))
+               && (code.par.columns () == r));
+      for (int i = 0; valid && (i < r); i++)
+        valid = ((piv[i] >= 0) && (piv[i] < code.n));
+    }
+  else
+    valid = valid && (code.k == code.n - code.m);
+
+  if (! valid)
+    {
+      error ("%s: LDPC is not a valid LDPC code", fcn);
+      return false;
+    }
+
+  return true;
+}
+
+DEFUN_DLD (ldpccode, args, ,
+  "-*- texinfo -*-\n\
+@deftypefn {Loadable Function} {@var{ldpc} =} ldpccode (@var{h})\n\
+Prepare the binary LDPC code with the parity check matrix @var{h} for\n\
+@code{ldpcencode} and @code{ldpcdecode}. @var{h} may be a full or sparse\n\
+matrix, logical or double, or a full or sparse Galois array in GF(2). Its\n\
+edges are stored once, row by row, in the returned structure @var{ldpc},\n\
+that can then be used for any number of codewords.\n\
+\n\
+If the last rows (@var{h}) columns of @var{h} are lower triangular with\n\
+ones on the diagonal, as for the staircase parity part of the DVB-S2\n\
+and most standard codes, the code is systematic with the message in the\n\
+first columns, and is encoded from the rows of @var{h} directly.\n\
+Otherwise @var{h} is reduced to row echelon form over GF(2), and the\n\
+message bits are in the columns without a pivot.\n\
+@seealso{ldpcencode, ldpcdecode, blkcode}\n\
+@end deftypefn")
+{
+  octave_value retval;
+
+  if (args.length () != 1)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  // The Galois arrays must be in GF(2), and the full ones are read
+  // through their matrix values
+  octave_value arg = args(0);
+  if (arg.class_name () == "galois")
+    {
+      std::list<octave_value_list> idx;
+      idx.push_back (octave_value_list (octave_value ("m")));
+      if (arg.subsref (".", idx).int_value () != 1)
+        {
+          error ("ldpccode: H must be in GF(2)");
+          return retval;
+        }
+    }
+
+  SparseMatrix h = (arg.is_sparse_type () ? arg.sparse_matrix_value ()
+                    : SparseMatrix (arg.matrix_value ()));
+  if (error_state)
+    return retval;
+
+  int m = h.rows ();
+  int n = h.cols ();
+
+  if (n == 0 || m >= n)
+    {
+      error ("ldpccode: H must have more columns than rows");
+      return retval;
+    }
+
+  // The edges row by row, by counting the elements of each row first
+  int32NDArray rowptr (dim_vector (m + 1, 1), octave_int32 (0));
+  int32_t *rp = reinterpret_cast<int32_t *> (rowptr.fortran_vec ());
+  for (int j = 0; j < n; j++)
+    for (octave_idx_type k = h.cidx (j); k < h.cidx (j+1); k++)
+      {
+        if (h.data (k) == 1)
+          rp[h.ridx (k) + 1]++;
+        else if (h.data (k) != 0)
+          {
+            error ("ldpccode: H must be a binary matrix");
+            return retval;
+          }
+      }
+  for (int i = 0; i < m; i++)
+    rp[i+1] += rp[i];
+
+  int32NDArray col (dim_vector (rp[m], 1));
+  int32_t *cp = reinterpret_cast<int32_t *> (col.fortran_vec ());
+  std::vector<int32_t> pos (rp, rp + m);
+  for (int j = 0; j < n; j++)
+    for (octave_idx_type k = h.cidx (j); k < h.cidx (j+1); k++)
+      if (h.data (k) == 1)
+        cp[pos[h.ridx (k)]++] = j;
+
+  // The parity part is lower triangular with a unit diagonal if the last
+  // element of each row is on the diagonal
+  int k = n - m;
+  bool tri = true;
+  for (int i = 0; tri && (i < m); i++)
+    tri = ((rp[i+1] > rp[i]) && (cp[rp[i+1] - 1] == k + i));
+
+  int32NDArray info;
+  int32NDArray piv;
+  uint64NDArray par;
+  if (tri)
+    {
+      info = int32NDArray (dim_vector (k, 1));
+      for (int j = 0; j < k; j++)
+        info(j) = octave_int32 (j);
+    }
+  else
+    {
+      int nw = BITPACK_WORDS (n);
+      std::vector<bitpack_word> g ((size_t)m * nw, 0);
+      for (int i = 0; i < m; i++)
+        for (int e = rp[i]; e < rp[i+1]; e++)
+          bitpack_set (&g[(size_t)i*nw], cp[e]);
+
+      std::vector<int> p;
+      int r = gf2_rref (g, m, n, p);
+      std::vector<int> perm = gf2_pivot_order (p, r, n);
+      k = n - r;
+
+      info = int32NDArray (dim_vector (k, 1));
+      for (int j = 0; j < k; j++)
+        info(j) = octave_int32 (perm[r + j]);
+      piv = int32NDArray (dim_vector (r, 1));
+      for (int i = 0; i < r; i++)
+        piv(i) = octave_int32 (p[i]);
+      par = uint64NDArray (dim_vector (nw, r));
+      std::copy (g.begin (), g.begin () + (size_t)r * nw,
+                 reinterpret_cast<bitpack_word *> (par.fortran_vec ()));
+    }
+
+  octave_scalar_map s;
+  s.assign ("n", octave_value (n));
+  s.assign ("m", octave_value (m));
+  s.assign ("k", octave_value (k));
+  s.assign ("rowptr", octave_value (rowptr));
+  s.assign ("col", octave_value (col));
+  s.assign ("info", octave_value (info));
+  s.assign ("piv", octave_value (piv));
+  s.assign ("par", octave_value (par));
+
+  retval = octave_value (s);
+  return retval;
+}
+
+// The codeword c of the message msg, with the bits as doubles
+static void
+ldpc_encode (const ldpc_code& code, const double *msg, double *c,
+             std::vector<bitpack_word>& buf)
+{
+  int n = code.n;
+  int k = code.k;
+  const int32_t *info = ldpc_ptr (code.info);
+
+  std::fill (c, c + n, 0.);
+  for (int j = 0; j < k; j++)
+    c[info[j]] = msg[j];
+
+  if (code.par.numel () == 0)
+    {
+      // Forward substitution, the parity bit of row i being last in it
+      const int32_t *rowptr = ldpc_ptr (code.rowptr);
+      const int32_t *col = ldpc_ptr (code.col);
+      for (int i = 0; i < code.m; i++)
+        {
+          int b = 0;
+          for (int e = rowptr[i]; e < rowptr[i+1] - 1; e++)
+            b ^= (c[col[e]] != 0);
+          c[k + i] = b;
+        }
+    }
+  else
+    {
+      // Row i of the reduced matrix has no other pivot than its own
+      int r = n - k;
+      int nw = BITPACK_WORDS (n);
+      const bitpack_word *par =
+        reinterpret_cast<const bitpack_word *> (code.par.data ());
+      const int32_t *piv = ldpc_ptr (code.piv);
+      buf.assign (nw, 0);
+      for (int j = 0; j < k; j++)
+        if (msg[j] != 0)
+          bitpack_set (&buf[0], info[j]);
+      for (int i = 0; i < r; i++)
+        c[piv[i]] = bitpack_dot (par + (size_t)i * nw, &buf[0], nw);
+    }
+}
+
+DEFUN_DLD (ldpcencode, args, ,
+  "-*- texinfo -*-\n\
+@deftypefn {Loadable Function} {@var{code} =} ldpcencode (@var{ldpc}, @var{msg})\n\
+Encode the binary messages in the rows of @var{msg} with the LDPC code\n\
+@var{ldpc} returned by @code{ldpccode}. Each row of @var{code} is a\n\
+codeword, whose product with the parity check matrix is zero modulo 2.\n\
+@seealso{ldpccode, ldpcdecode}\n\
+@end deftypefn")
+{
+  octave_value retval;
+
+  if (args.length () != 2)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  ldpc_code code;
+  if (! get_ldpccode (args(0), "ldpcencode", code))
+    return retval;
+
+  Matrix msg = args(1).matrix_value ();
+  int nsym = msg.rows ();
+  int n = code.n;
+  int k = code.k;
+
+  if (msg.columns () != k)
+    {
+      error ("ldpcencode: MSG must be a matrix with %d columns", k);
+      return retval;
+    }
+  for (octave_idx_type i = 0; i < msg.numel (); i++)
+    if ((msg(i) != 0) && (msg(i) != 1))
+      {
+        error ("ldpcencode: MSG must be a binary matrix");
+        return retval;
+      }
+
+  Matrix cw (nsym, n);
+  OCTAVE_LOCAL_BUFFER (double, m, k);
+  OCTAVE_LOCAL_BUFFER (double, c, n);
+  std::vector<bitpack_word> buf;
+
+  for (int l = 0; l < nsym; l++)
+    {
+      OCTAVE_QUIT;
+
+      for (int j = 0; j < k; j++)
+        m[j] = msg(l, j);
+      ldpc_encode (code, m, c, buf);
+      for (int j = 0; j < n; j++)
+        cw(l, j) = c[j];
+    }
+
+  retval = octave_value (cw);
+  return retval;
+}
+
+enum ldpc_algorithm
+{
+  LDPC_NORM_MIN_SUM=0,
+  LDPC_OFFSET_MIN_SUM
+};
+
+// The decoding options, with the scaling factor in sixteenths and the
+// offset in the fixed-point units of the messages
+struct ldpc_options
+{
+  ldpc_algorithm alg;
+  int scaling;
+  int offset;
+  double scale;
+  int maxiter;
+  bool early;
+};
+
+// Layered min-sum decoding of the frames f0 to f0+nl-1 of the nframes
+// rows of llr, nl being at most LDPC_LANES. The messages from the checks
+// to the variables are stored per edge in the type T, and the a
+// posteriori values of the variables in the wider type A, the lanes of
+// each being consecutive. Each row of the parity check matrix is a
+// layer, whose checks are updated with the latest values of their
+// variables. A frame is done when all of its checks are satisfied, and
+// its message bits and number of iterations are then stored
+template <typename T, typename A>
+static void
+ldpc_decode_lanes (const ldpc_code& code, const ldpc_options& opt,
+                   const double *llr, octave_idx_type nframes,
+                   octave_idx_type f0, int nl, double *msg, double *niter,
+                   bool *valid)
+{
+  const int W = LDPC_LANES;
+  const A tmax = std::numeric_limits<T>::max ();
+  const A amax = std::numeric_limits<A>::max () - tmax;
+
+  int n = code.n;
+  int m = code.m;
+  int k = code.k;
+  const int32_t *rowptr = ldpc_ptr (code.rowptr);
+  const int32_t *col = ldpc_ptr (code.col);
+  const int32_t *info = ldpc_ptr (code.info);
+
+  int maxdeg = 0;
+  for (int i = 0; i < m; i++)
+    maxdeg = std::max (maxdeg, rowptr[i+1] - rowptr[i]);
+
+  std::vector<A> L ((size_t)n * W, 0);
+  std::vector<T> R ((size_t)rowptr[m] * W, 0);
+  std::vector<A> t ((size_t)maxdeg * W);
+  std::vector<bool> done (W, false);
+  int ndone = 0;
+
+  // The channel values, rounded and saturated to the message range
+  for (int v = 0; v < n; v++)
+    for (int l = 0; l < nl; l++)
+      {
+        double q = std::floor (llr[f0 + l + v * nframes] * opt.scale + 0.5);
+        L[(size_t)v*W+l] = (A)std::max (-(double)tmax,
+                                        std::min ((double)tmax, q));
+      }
+
+  for (int it = 1; it <= opt.maxiter; it++)
+    {
+      for (int i = 0; i < m; i++)
+        {
+          int e0 = rowptr[i];
+          int d = rowptr[i+1] - e0;
+          A min1[W], min2[W], sgn[W];
+          int idx[W];
+
+          for (int l = 0; l < W; l++)
+            {
+              min1[l] = tmax;
+              min2[l] = tmax;
+              sgn[l] = 0;
+              idx[l] = 0;
+            }
+
+          // The two smallest magnitudes and the sign product of the
+          // messages from the variables, without branches
+          for (int j = 0; j < d; j++)
+            {
+              const A *Lv = &L[(size_t)col[e0+j]*W];
+              const T *Re = &R[(size_t)(e0+j)*W];
+              A *tj = &t[(size_t)j*W];
+              for (int l = 0; l < W; l++)
+                {
+                  A x = Lv[l] - Re[l];
+                  A a = std::min ((A)(x < 0 ? -x : x), tmax);
+                  tj[l] = x;
+                  sgn[l] ^= (x < 0);
+                  min2[l] = std::min (min2[l], std::max (min1[l], a));
+                  idx[l] = (a < min1[l] ? j : idx[l]);
+                  min1[l] = std::min (min1[l], a);
+                }
+            }
+
+          for (int l = 0; l < W; l++)
+            {
+              if (opt.alg == LDPC_NORM_MIN_SUM)
+                {
+                  min1[l] = (min1[l] * opt.scaling) >> 4;
+                  min2[l] = (min2[l] * opt.scaling) >> 4;
+                }
+              else
+                {
+                  min1[l] = std::max ((A)(min1[l] - opt.offset), (A)0);
+                  min2[l] = std::max ((A)(min2[l] - opt.offset), (A)0);
+                }
+            }
+
+          for (int j = 0; j < d; j++)
+            {
+              A *Lv = &L[(size_t)col[e0+j]*W];
+              T *Re = &R[(size_t)(e0+j)*W];
+              const A *tj = &t[(size_t)j*W];
+              for (int l = 0; l < W; l++)
+                {
+                  A mag = (idx[l] == j ? min2[l] : min1[l]);
+                  A r = ((sgn[l] ^ (tj[l] < 0)) ? -mag : mag);
+                  Re[l] = (T)r;
+                  Lv[l] = std::max ((A)-amax, std::min (amax, (A)(tj[l] + r)));
+                }
+            }
+        }
+
+      if (! opt.early && (it < opt.maxiter))
+        continue;
+
+      // The frames whose hard decisions satisfy all of the checks
+      A fail[W];
+      for (int l = 0; l < W; l++)
+        fail[l] = 0;
+      for (int i = 0; i < m; i++)
+        {
+          A par[W];
+          for (int l = 0; l < W; l++)
+            par[l] = 0;
+          for (int e = rowptr[i]; e < rowptr[i+1]; e++)
+            {
+              const A *Lv = &L[(size_t)col[e]*W];
+              for (int l = 0; l < W; l++)
+                par[l] ^= (Lv[l] < 0);
+            }
+          for (int l = 0; l < W; l++)
+            fail[l] |= par[l];
+        }
+
+      for (int l = 0; l < nl; l++)
+        if (! done[l] && (! fail[l] || (it == opt.maxiter)))
+          {
+            done[l] = true;
+            ndone++;
+            for (int j = 0; j < k; j++)
+              msg[f0 + l + j * nframes] = (L[(size_t)info[j]*W+l] < 0);
+            niter[f0 + l] = it;
+            valid[f0 + l] = ! fail[l];
+          }
+
+      if (ndone == nl)
+        break;
+    }
+}
+
+DEFUN_DLD (ldpcdecode, args, nargout,
+  "-*- texinfo -*-\n\
+@deftypefn  {Loadable Function} {@var{msg} =} ldpcdecode (@var{ldpc}, @var{llr})\n\
+@deftypefnx {Loadable Function} {@var{msg} =} ldpcdecode (@var{ldpc}, @var{llr}, @var{prop}, @var{val}, @dots{})\n\
+@deftypefnx {Loadable Function} {[@var{msg}, @var{niter}, @var{valid}] =} ldpcdecode (@dots{})\n\
+Decode the frames in the rows of @var{llr} with the LDPC code @var{ldpc}\n\
+returned by @code{ldpccode}, by layered min-sum decoding. The elements\n\
+of @var{llr} are the log-likelihood ratios log (P(0) / P(1)) of the bits\n\
+of the codewords, so that positive values favour zero.\n\
+\n\
+The decoded messages are returned in the rows of @var{msg}, the number\n\
+of iterations used for each frame in the column vector @var{niter}, and\n\
+in @var{valid} whether the hard decisions of each frame satisfy all of\n\
+the parity checks.\n\
+\n\
+The messages between the checks and the variables are fixed-point\n\
+integers, the log-likelihood ratios being scaled by 2^@var{fracbits}\n\
+and saturated to their range. The frames are decoded 16 at a time,\n\
+with the arithmetic vectorized across them, and the groups of frames\n\
+are decoded on all available processors. The properties are\n\
+\n\
+@table @asis\n\
+@item \"algorithm\"\n\
+\"norm-min-sum\", the default, scales the check messages by\n\
+\"scaling\", and \"offset-min-sum\" reduces them by \"offset\".\n\
+@item \"scaling\"\n\
+The scaling factor of normalized min-sum, rounded to sixteenths. The\n\
+default is 0.75.\n\
+@item \"offset\"\n\
+The offset of offset min-sum, in units of log-likelihood ratio. The\n\
+default is 0.5.\n\
+@item \"maxiter\"\n\
+The maximum number of iterations, by default 50.\n\
+@item \"termination\"\n\
+\"early\", the default, stops decoding a frame as soon as its checks are\n\
+satisfied, and \"max\" always does \"maxiter\" iterations.\n\
+@item \"type\"\n\
+The type of the messages, \"int16\", the default, or \"int8\".\n\
+@item \"fracbits\"\n\
+The number of fractional bits of the messages, by default 8 for\n\
+\"int16\" and 2 for \"int8\".\n\
+@end table\n\
+@seealso{ldpccode, ldpcencode}\n\
+@end deftypefn")
+{
+  octave_value_list retval;
+  int nargin = args.length ();
+
+  if (nargin < 2 || (nargin % 2) != 0)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  ldpc_code code;
+  if (! get_ldpccode (args(0), "ldpcdecode", code))
+    return retval;
+
+  Matrix llr = args(1).matrix_value ();
+  octave_idx_type nframes = llr.rows ();
+  int n = code.n;
+  int k = code.k;
+
+  if (llr.columns () != n)
+    {
+      error ("ldpcdecode: LLR must be a matrix with %d columns", n);
+      return retval;
+    }
+
+  ldpc_options opt;
+  opt.alg = LDPC_NORM_MIN_SUM;
+  opt.maxiter = 50;
+  opt.early = true;
+  double scaling = 0.75;
+  double offset = 0.5;
+  bool int8 = false;
+  int fracbits = -1;
+
+  for (int i = 2; i < nargin; i += 2)
+    {
+      if (! args(i).is_string ())
+        {
+          error ("ldpcdecode: property names must be strings");
+          return retval;
+        }
+      std::string prop = args(i).string_value ();
+      octave_value val = args(i+1);
+
+      if (prop == "algorithm" || prop == "termination" || prop == "type")
+        {
+          if (! val.is_string ())
+            {
+              error ("ldpcdecode: %s must be a string", prop.c_str ());
+              return retval;
+            }
+          std::string s = val.string_value ();
+          if (prop == "algorithm" && s == "norm-min-sum")
+            opt.alg = LDPC_NORM_MIN_SUM;
+          else if (prop == "algorithm" && s == "offset-min-sum")
+            opt.alg = LDPC_OFFSET_MIN_SUM;
+          else if (prop == "termination" && (s == "early" || s == "max"))
+            opt.early = (s == "early");
+          else if (prop == "type" && (s == "int8" || s == "int16"))
+            int8 = (s == "int8");
+          else
+            {
+              error ("ldpcdecode: invalid %s \"%s\"", prop.c_str (),
+                     s.c_str ());
+              return retval;
+            }
+        }
+      else if (prop == "scaling")
+        {
+          scaling = val.double_value ();
+          if (! (scaling > 0 && scaling <= 1))
+            {
+              error ("ldpcdecode: scaling must be in the range (0, 1]");
+              return retval;
+            }
+        }
+      else if (prop == "offset")
+        {
+          offset = val.double_value ();
+          if (! (offset >= 0))
+            {
+              error ("ldpcdecode: offset must be non-negative");
+              return retval;
+            }
+        }
+      else if (prop == "maxiter")
+        {
+          opt.maxiter = val.int_value ();
+          if (opt.maxiter < 1)
+            {
+              error ("ldpcdecode: maxiter must be a positive integer");
+              return retval;
+            }
+        }
+      else if (prop == "fracbits")
+        {
+          fracbits = val.int_value ();
+          if (fracbits < 0 || fracbits > 12)
+            {
+              error ("ldpcdecode: fracbits must be between 0 and 12");
+              return retval;
+            }
+        }
+      else
+        {
+          error ("ldpcdecode: unknown property \"%s\"", prop.c_str ());
+          return retval;
+        }
+    }
+
+  if (fracbits < 0)
+    fracbits = (int8 ? 2 : 8);
+  opt.scale = std::ldexp (1., fracbits);
+  opt.scaling = std::max (1, (int)std::floor (scaling * 16 + 0.5));
+  opt.offset = (int)std::floor (offset * opt.scale + 0.5);
+
+  Matrix msg (nframes, k);
+  ColumnVector niter (nframes);
+  boolMatrix valid (dim_vector (nframes, 1), false);
+
+  // The outputs are unshared before the threads write to them
+  double *pmsg = msg.fortran_vec ();
+  double *pniter = niter.fortran_vec ();
+  bool *pvalid = valid.fortran_vec ();
+  const double *pllr = llr.data ();
+
+  int ngroups = (nframes + LDPC_LANES - 1) / LDPC_LANES;
+  parallel_for (ngroups, parallel_threads (), [&] (int g)
+    {
+      octave_idx_type f0 = (octave_idx_type)g * LDPC_LANES;
+      int nl = std::min ((octave_idx_type)LDPC_LANES, nframes - f0);
+      if (int8)
+        ldpc_decode_lanes<int8_t, int16_t> (code, opt, pllr, nframes, f0, nl,
+                                            pmsg, pniter, pvalid);
+      else
+        ldpc_decode_lanes<int16_t, int32_t> (code, opt, pllr, nframes, f0,
+                                             nl, pmsg, pniter, pvalid);
+    });
+
+  retval(2) = octave_value (valid);
+  retval(1) = octave_value (niter);
+  retval(0) = octave_value (msg);
+  return retval;
+}
+
+/*
+%% Test input validation
+%!error ldpccode ()
+%!error ldpccode (1, 2)
+%!error <more columns than rows> ldpccode (eye (3))
+%!error <binary matrix> ldpccode ([1 2 0 1])
+%!error <GF\(2\)> ldpccode (gf (sparse ([1 1 0 1]), 2))
+%!error <code returned by ldpccode> ldpcencode (struct ("n", 3), 2)
+%!error <MSG must be> ldpcencode (ldpccode ([1 1 1]), [1 1 0])
+%!error <LLR must be> ldpcdecode (ldpccode ([1 1 1]), [1 1])
+%!error <unknown property> ldpcdecode (ldpccode ([1 1 1]), [1 1 1], "foo", 1)
+
+%!test
+%! ## A staircase parity part is encoded from the rows
+%! h = [1 1 0 1 1 0 0; 1 0 1 1 1 1 0; 0 1 1 1 0 1 1];
+%! ldpc = ldpccode (sparse (h));
+%! assert (ldpc.k, 4)
+%! assert (ldpccode (gf (sparse (h))), ldpc)
+%! assert (ldpccode (gf (h)), ldpc)
+%! msg = dec2bin (0:15) - "0";
+%! code = ldpcencode (ldpc, msg);
+%! assert (code(:, 1:4), msg)
+%! assert (all (all (mod (code * h', 2) == 0)))
+%! llr = 4 * (1 - 2 * code);
+%! llr(:, 3) = -llr(:, 3) / 4;
+%! [dec, niter, valid] = ldpcdecode (ldpc, llr);
+%! assert (dec, msg)
+%! assert (all (valid))
+%! assert (all (niter <= 2))
+
+%!test
+%! ## Other parity check matrices are reduced to echelon form
+%! h = cyclgen (15, cyclpoly (15, 7));
+%! h = [h; mod(h(1, :) + h(2, :), 2)];
+%! ldpc = ldpccode (h);
+%! assert (ldpc.k, 7)
+%! msg = randi ([0 1], 40, 7);
+%! code = ldpcencode (ldpc, msg);
+%! assert (all (all (mod (code * h', 2) == 0)))
+%! for type = {"int8", "int16"}
+%!   for alg = {"norm-min-sum", "offset-min-sum"}
+%!     [dec, niter, valid] = ldpcdecode (ldpc, 3 * (1 - 2 * code), ...
+%!                                       "type", type{1}, "algorithm", alg{1});
+%!     assert (dec, msg)
+%!     assert (niter, ones (40, 1))
+%!     assert (valid, true (40, 1))
+%!   endfor
+%! endfor
+%! [~, niter] = ldpcdecode (ldpc, 3 * (1 - 2 * code), "termination", "max", ...
+%!                          "maxiter", 5);
+%! assert (niter, 5 * ones (40, 1))
+*/
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
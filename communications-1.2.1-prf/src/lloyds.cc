@@ -0,0 +1,395 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <octave/oct.h>
+
+// The training signal, sorted once: its distinct values v with the
+// prefix sums of their weights, of the values times their weights and
+// of their squares times their weights, for the sums over any interval
+// of the values in constant time. The values are centered on the
+// middle of their range, for the accuracy of the sums
+struct lloyds_signal
+{
+  double offset;
+  std::vector<double> v;
+  std::vector<double> sw;
+  std::vector<double> sx;
+  std::vector<double> sxx;
+};
+
+// The bounds of the values of s in the intervals of the partition t of
+// the quantiz convention, t[i-1] < x <= t[i], the interval i holding the
+// values from b[i] to b[i+1]
+static void
+lloyds_bounds (const lloyds_signal& s, const std::vector<double>& t,
+               std::vector<size_t>& b)
+{
+  size_t n = s.v.size ();
+  b.resize (t.size () + 2);
+  b[0] = 0;
+  for (size_t i = 0; i < t.size (); i++)
+    b[i+1] = std::max (b[i], (size_t)(std::upper_bound (s.v.begin (),
+                                                        s.v.end (), t[i])
+                                      - s.v.begin ()));
+  b[t.size () + 1] = n;
+}
+
+// The mean of the values of s from lo to hi-1, not empty. It is
+// clamped to their range, and exact for a single value, so that the
+// rounding of the sums does not move it past a value equal to it
+static double
+lloyds_mean (const lloyds_signal& s, size_t lo, size_t hi)
+{
+  if (hi == lo + 1)
+    return s.v[lo];
+  double m = (s.sx[hi] - s.sx[lo]) / (s.sw[hi] - s.sw[lo]);
+  return std::min (std::max (m, s.v[lo]), s.v[hi-1]);
+}
+
+// The mean squared error of the values of s quantized with the
+// partition of the bounds b to the codes c
+static double
+lloyds_distortion (const lloyds_signal& s, const std::vector<size_t>& b,
+                   const std::vector<double>& c)
+{
+  double d = 0;
+  for (size_t i = 0; i < c.size (); i++)
+    {
+      size_t lo = b[i], hi = b[i+1];
+      d += ((s.sxx[hi] - s.sxx[lo]) - 2 * c[i] * (s.sx[hi] - s.sx[lo])
+            + c[i] * c[i] * (s.sw[hi] - s.sw[lo]));
+    }
+  return std::max (d, 0.) / s.sw[s.v.size ()];
+}
+
+DEFUN_DLD (lloyds, args, nargout,
+  "-*- texinfo -*-\n\
+@deftypefn  {Loadable Function} {[@var{table}, @var{codes}] =} lloyds (@var{sig}, @var{init_codes})\n\
+@deftypefnx {Loadable Function} {[@var{table}, @var{codes}] =} lloyds (@var{sig}, @var{len})\n\
+@deftypefnx {Loadable Function} {[@var{table}, @var{codes}] =} lloyds (@var{sig}, @dots{}, @var{tol})\n\
+@deftypefnx {Loadable Function} {[@var{table}, @var{codes}] =} lloyds (@var{sig}, @dots{}, @var{tol}, @var{type})\n\
+@deftypefnx {Loadable Function} {[@var{table}, @var{codes}] =} lloyds (@var{sig}, @dots{}, @var{tol}, @var{type}, @var{weights})\n\
+@deftypefnx {Loadable Function} {[@var{table}, @var{codes}, @var{dist}] =} lloyds (@dots{})\n\
+@deftypefnx {Loadable Function} {[@var{table}, @var{codes}, @var{dist}, @var{reldist}] =} lloyds (@dots{})\n\
+\n\
+Optimize the quantization table and codes to reduce distortion. This is\n\
+based on the article by Lloyd\n\
+\n\
+ S. Lloyd @emph{Least squared quantization in PCM}, IEEE Trans Inform\n\
+ Theory, Mar 1982, no 2, p129-137\n\
+\n\
+which describes an iterative technique to reduce the quantization error\n\
+by making the intervals of the table such that each interval has the same\n\
+area under the PDF of the training signal @var{sig}. The initial codes to\n\
+try can either be given in the vector @var{init_codes} or as scalar\n\
+@var{len}. In the case of a scalar the initial codes will be an equi-spaced\n\
+vector of length @var{len} between the minimum and maximum value of the\n\
+training signal.\n\
+\n\
+The stopping criteria of the iterative algorithm is given by\n\
+\n\
+@example\n\
+abs(@var{dist}(n) - @var{dist}(n-1)) < max(@var{tol}, abs(@var{eps}*max(@var{sig}))\n\
+@end example\n\
+\n\
+By default @var{tol} is 1.e-7. The final input argument determines how the\n\
+updated table is created. By default the centroid of the values of the\n\
+training signal that fall within the interval described by @var{codes}\n\
+are used to update @var{table}. If @var{type} is any other string than\n\
+\"centroid\", this behavior is overridden and @var{table} is updated as\n\
+follows.\n\
+\n\
+@example\n\
+@var{table} = (@var{code}(2:length(@var{code})) + @var{code}(1:length(@var{code}-1))) / 2\n\
+@end example\n\
+\n\
+The training signal may be given as a histogram, @var{sig} holding the\n\
+values and @var{weights} their non-negative weights, such as the number\n\
+of times each value occurs. The distortion is then the weighted mean of\n\
+the squared errors. @var{tol} and @var{type} may be empty for their\n\
+defaults.\n\
+\n\
+The optimized values are returned as @var{table} and @var{code}. In\n\
+addition the distortion of the optimized codes representing the training\n\
+signal is returned as @var{dist}. The relative distortion in the final\n\
+iteration is also returned as @var{reldist}.\n\
+\n\
+The training signal is sorted once, with the prefix sums of its values\n\
+and of their squares, so that each iteration finds the intervals by\n\
+binary search and their centroids and distortion from these sums, in\n\
+O(L log N) for L codes and N distinct values.\n\
+\n\
+@seealso{quantiz}\n\
+@end deftypefn")
+{
+  octave_value_list retval;
+  int nargin = args.length ();
+
+  if (nargin < 2 || nargin > 5)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  const Matrix sig = args(0).matrix_value ();
+  if (std::min (sig.rows (), sig.columns ()) != 1)
+    {
+      error ("lloyds: SIG must be a vector");
+      return retval;
+    }
+  octave_idx_type n = sig.numel ();
+
+  Matrix weights;
+  if (nargin > 4)
+    {
+      weights = args(4).matrix_value ();
+      bool ok = (weights.numel () == n);
+      for (octave_idx_type i = 0; ok && (i < n); i++)
+        ok = (weights(i) >= 0 && weights(i) < octave_Inf);
+      if (! ok)
+        {
+          error ("lloyds: WEIGHTS must be a vector of non-negative weights "
+                 "of the length of SIG");
+          return retval;
+        }
+    }
+
+  // The values of non-zero weight, sorted
+  std::vector<std::pair<double, double> > xw;
+  xw.reserve (n);
+  for (octave_idx_type i = 0; i < n; i++)
+    {
+      if (std::isnan (sig(i)))
+        {
+          error ("lloyds: SIG must not hold NaN values");
+          return retval;
+        }
+      double w = (nargin > 4 ? weights(i) : 1.);
+      if (w > 0)
+        xw.push_back (std::make_pair (sig(i), w));
+    }
+  if (xw.empty ())
+    {
+      error ("lloyds: WEIGHTS must not all be zero");
+      return retval;
+    }
+  std::sort (xw.begin (), xw.end ());
+  double sigmin = xw.front ().first;
+  double sigmax = xw.back ().first;
+
+  lloyds_signal s;
+  s.offset = sigmin / 2 + sigmax / 2;
+  s.sw.push_back (0);
+  s.sx.push_back (0);
+  s.sxx.push_back (0);
+  for (size_t i = 0; i < xw.size (); i++)
+    {
+      double x = xw[i].first - s.offset;
+      double w = xw[i].second;
+      if (s.v.empty () || x != s.v.back ())
+        {
+          s.v.push_back (x);
+          s.sw.push_back (s.sw.back ());
+          s.sx.push_back (s.sx.back ());
+          s.sxx.push_back (s.sxx.back ());
+        }
+      s.sw.back () += w;
+      s.sx.back () += w * x;
+      s.sxx.back () += w * x * x;
+    }
+  xw.clear ();
+
+  // The codes, centered as the values
+  const Matrix init = args(1).matrix_value ();
+  std::vector<double> code;
+  if (init.numel () == 1)
+    {
+      double len = init(0);
+      if (! (len >= 2 && len < 1e9 && len == std::floor (len)))
+        {
+          error ("lloyds: LEN must be an integer of at least 2");
+          return retval;
+        }
+      code.resize ((size_t)len);
+      for (size_t i = 0; i < code.size (); i++)
+        code[i] = (i / (len - 1) * (sigmax - sigmin) + sigmin) - s.offset;
+    }
+  else if (std::min (init.rows (), init.columns ()) > 0)
+    {
+      code.resize (init.numel ());
+      for (octave_idx_type i = 0; i < init.numel (); i++)
+        {
+          if (std::isnan (init(i)) || (i > 0 && init(i) < init(i-1)))
+            {
+              error ("lloyds: INIT_CODES must be monotonically increasing");
+              return retval;
+            }
+          code[i] = init(i) - s.offset;
+        }
+    }
+  else
+    {
+      error ("lloyds: invalid initial codebook");
+      return retval;
+    }
+  size_t lcode = code.size ();
+
+  double tol = 1e-7;
+  if (nargin > 2 && ! args(2).is_empty ())
+    tol = args(2).double_value ();
+  double eps = std::numeric_limits<double>::epsilon ();
+  double stop_criteria = std::max (std::abs (eps * sigmax), std::abs (tol));
+
+  bool centroid = true;
+  if (nargin > 3 && ! args(3).is_empty ())
+    {
+      if (! args(3).is_string ())
+        {
+          error ("lloyds: TYPE must be a string");
+          return retval;
+        }
+      centroid = (args(3).string_value () == "centroid");
+    }
+
+  // The initial table, of the midpoints of the codes, and distortion
+  std::vector<double> table (lcode - 1);
+  for (size_t i = 0; i + 1 < lcode; i++)
+    table[i] = (code[i+1] + code[i]) / 2;
+  std::vector<size_t> b;
+  lloyds_bounds (s, table, b);
+  double dist = lloyds_distortion (s, b, code);
+  double reldist = std::abs (dist);
+  double vmin = sigmin - s.offset;
+  double vmax = sigmax - s.offset;
+
+  while (reldist > stop_criteria)
+    {
+      OCTAVE_QUIT;
+
+      // The codes are the centroids of the values in the intervals of
+      // the table, or the middle of the empty intervals
+      for (size_t i = 0; i < lcode; i++)
+        {
+          if (b[i+1] > b[i])
+            code[i] = lloyds_mean (s, b[i], b[i+1]);
+          else if (i == 0)
+            code[i] = (table[i] + vmin) / 2;
+          else if (i == lcode - 1)
+            code[i] = (vmax + table[i-1]) / 2;
+          else
+            code[i] = (table[i] + table[i-1]) / 2;
+        }
+
+      // The table is made of the centroids of the values between the
+      // codes, code(i) <= x < code(i+1), as Matlab does, or of the
+      // midpoints of the codes
+      for (size_t i = 0; i + 1 < lcode; i++)
+        {
+          size_t lo = std::lower_bound (s.v.begin (), s.v.end (), code[i])
+                      - s.v.begin ();
+          size_t hi = std::lower_bound (s.v.begin (), s.v.end (), code[i+1])
+                      - s.v.begin ();
+          if (centroid && hi > lo)
+            table[i] = lloyds_mean (s, lo, hi);
+          else
+            table[i] = (code[i+1] + code[i]) / 2;
+        }
+
+      reldist = dist;
+      lloyds_bounds (s, table, b);
+      dist = lloyds_distortion (s, b, code);
+      reldist = std::abs (reldist - dist);
+    }
+
+  // Row vectors, if the initial codes are a row
+  bool column = (init.rows () > 1 || init.numel () == 1);
+  ColumnVector tv (lcode - 1);
+  ColumnVector cv (lcode);
+  for (size_t i = 0; i < lcode; i++)
+    {
+      cv(i) = code[i] + s.offset;
+      if (i + 1 < lcode)
+        tv(i) = table[i] + s.offset;
+    }
+  retval(0) = (column ? octave_value (tv) : octave_value (tv.transpose ()));
+  retval(1) = (column ? octave_value (cv) : octave_value (cv.transpose ()));
+  retval(2) = octave_value (dist);
+  retval(3) = octave_value (reldist);
+
+  return retval;
+}
+
+/*
+%!test
+%! [table, code, dist] = lloyds ([-1 -1 1 1], 2);
+%! assert (table, 0)
+%! assert (code, [-1; 1])
+%! assert (dist, 0)
+
+%!test
+%! ## A signal and its histogram give the same quantizer
+%! sig = round (10 * randn (1, 10000)) / 10;
+%! [x, ~, j] = unique (sig);
+%! w = accumarray (j(:), 1)';
+%! [table1, code1, dist1] = lloyds (sig, 8);
+%! [table2, code2, dist2] = lloyds (x, 8, [], [], w);
+%! assert (size (code1), [8 1])
+%! assert (table2, table1, 1e-10)
+%! assert (code2, code1, 1e-10)
+%! assert (dist2, dist1, 1e-10)
+
+%!test
+%! ## The distortion of quantiz, and the orientation of the codes
+%! sig = rand (1, 1000);
+%! [table, code, dist] = lloyds (sig, [0.1 0.5 0.9], 1e-10, "midpoint");
+%! assert (size (table), [1 2])
+%! assert (size (code), [1 3])
+%! assert (table, (code(1:2) + code(2:3)) / 2, 1e-12)
+%! [~, ~, d] = quantiz (sig, table, code);
+%! assert (dist, d, 1e-12)
+%! [table2, code2] = lloyds (sig, [0.1; 0.5; 0.9], 1e-10, "midpoint");
+%! assert (table2, table')
+%! assert (code2, code')
+
+%% Test input validation
+%!error lloyds ()
+%!error lloyds (1)
+%!error <TYPE> lloyds (1, 2, 3, 4, 5)
+%!error lloyds (1, 2, 3, 4, 5, 6)
+%!error lloyds (1, [3 2 1])
+%!error lloyds (1, 2, 3, 4)
+%!error <WEIGHTS> lloyds ([1 2], 2, [], [], [1 -1])
+%!error <LEN> lloyds ([1 2], 1)
+*/
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
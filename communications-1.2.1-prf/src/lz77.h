@@ -0,0 +1,71 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+
+#if !defined (octave_lz77_h)
+#define octave_lz77_h 1
+
+#include <cmath>
+
+#include <octave/oct.h>
+
+// Read the alphabet size alph, the lookahead buffer size la and the
+// window size n of lz77enco and lz77deco from args(1) to args(3),
+// reporting an error as fcn otherwise. The search buffer holds the n-la
+// symbols before the lookahead buffer
+static bool
+lz77_get_params (const octave_value_list& args, const char *fcn,
+                 double& alph, int& la, int& n)
+{
+  double a = args(1).double_value ();
+  double l = args(2).double_value ();
+  double w = args(3).double_value ();
+
+  if (! (l > 0 && w > 0 && l == std::floor (l) && w == std::floor (w)
+         && w < 1e9))
+    {
+      error ("%s: LA and N must be positive integers", fcn);
+      return false;
+    }
+  if (w - l < l)
+    {
+      error ("%s: N must be >= 2*LA", fcn);
+      return false;
+    }
+  // The encoder compares and hashes the symbols as 32 bit integers
+  if (! (a >= 2 && a <= 4294967296.0))
+    {
+      error ("%s: ALPH must be from 2 to 2^32", fcn);
+      return false;
+    }
+
+  alph = a;
+  la = (int)l;
+  n = (int)w;
+  return true;
+}
+
+#endif
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
@@ -0,0 +1,142 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+
+#include <limits>
+
+#include <octave/oct.h>
+
+#include "lz77.h"
+
+DEFUN_DLD (lz77deco, args, ,
+  "-*- texinfo -*-\n\
+@deftypefn {Loadable Function} {@var{m} =} lz77deco (@var{c}, @var{alph}, @var{la}, @var{n})\n\
+Lempel-Ziv 77 source algorithm decoding implementation. Where\n\
+\n\
+@table @asis\n\
+@item @var{m}\n\
+message decoded (1xN).\n\
+@item @var{c}\n\
+encoded message (Mx3).\n\
+@item @var{alph}\n\
+size of alphabet, from 2 to 2^32.\n\
+@item @var{la}\n\
+lookahead buffer size.\n\
+@item @var{n}\n\
+sliding window buffer size.\n\
+@end table\n\
+\n\
+Each token of @var{c} copies the symbols of its match from the\n\
+decoded message, or from the zeros before it, and appends its next\n\
+symbol, in a single pass.\n\
+@seealso{lz77enco}\n\
+@end deftypefn")
+{
+  octave_value_list retval;
+  int nargin = args.length ();
+
+  if (nargin != 4)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  double alph;
+  int la, n;
+  if (! lz77_get_params (args, "lz77deco", alph, la, n))
+    return retval;
+
+  if (args(0).columns () != 3)
+    {
+      error ("lz77deco: C must be a matrix with 3 columns");
+      return retval;
+    }
+
+  const Matrix c = args(0).matrix_value ();
+  octave_idx_type ntok = c.rows ();
+  int w = n - la;
+
+  double len = 0;
+  for (octave_idx_type t = 0; t < ntok; t++)
+    {
+      double p = c(t, 0);
+      double l = c(t, 1);
+      double s = c(t, 2);
+      if (! (p >= 0 && p < w && p == std::floor (p)
+             && l >= 0 && l == std::floor (l)
+             && s >= 0 && s < alph && s == std::floor (s)))
+        {
+          error ("lz77deco: C must hold offsets from 0 to N-LA-1, integer lengths and symbols from 0 to ALPH-1");
+          return retval;
+        }
+      len += l + 1;
+    }
+  if (len > std::numeric_limits<octave_idx_type>::max () / 8)
+    {
+      error ("lz77deco: the decoded message is too long");
+      return retval;
+    }
+
+  // The match of a token at distance d = w-p starts in the zeros before
+  // the message for its first symbols when d is larger than the position
+  Matrix m (1, (octave_idx_type)len);
+  double *pm = m.fortran_vec ();
+  octave_idx_type i = 0;
+  for (octave_idx_type t = 0; t < ntok; t++)
+    {
+      octave_idx_type d = w - (octave_idx_type)c(t, 0);
+      octave_idx_type l = (octave_idx_type)c(t, 1);
+      octave_idx_type z = 0;
+      for (; z < l && i < d; z++)
+        pm[i++] = 0;
+      for (; z < l; z++, i++)
+        pm[i] = pm[i - d];
+      pm[i++] = c(t, 2);
+    }
+
+  retval(0) = octave_value (m);
+  return retval;
+}
+
+/*
+%!assert (lz77deco ([8 2 1 ; 7 3 2 ; 6 7 2 ; 2 8 0], 3, 9, 18), [0 0 1 0 1 0 2 1 0 2 1 0 2 1 2 0 2 1 0 2 1 2 0 0])
+%!assert (lz77deco (zeros (0, 3), 2, 4, 8), zeros (1, 0))
+
+%!test
+%! m = randi ([0 3], 1, 10000);
+%! assert (lz77deco (lz77enco (m, 4, 16, 1024), 4, 16, 1024), m)
+
+%!demo
+%! lz77deco ([8 2 1 ; 7 3 2 ; 6 7 2 ; 2 8 0], 3, 9, 18)
+
+%% Test input validation
+%!error lz77deco (1, 2, 3, 4)
+%!error lz77deco (1, 1, 1, 1)
+%!error <3 columns> lz77deco ([1 2], 2, 2, 4)
+%!error <ALPH must be from 2 to 2\^32> lz77deco ([0 0 1], 2^33, 2, 4)
+%!error <offsets> lz77deco ([2 0 1], 2, 2, 4)
+%!error <offsets> lz77deco ([0 0 2], 2, 2, 4)
+*/
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
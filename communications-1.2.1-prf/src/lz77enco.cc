@@ -0,0 +1,279 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+
+#include <stdint.h>
+
+#include <unordered_map>
+#include <vector>
+
+#include <octave/oct.h>
+#include <octave/uint8NDArray.h>
+#include <octave/uint16NDArray.h>
+
+#include "lz77.h"
+
+#define LZ77_HASH_BITS 16
+
+static inline double
+lz77_value (double x)
+{
+  return x;
+}
+
+template <typename T>
+static inline double
+lz77_value (const octave_int<T>& x)
+{
+  return x.value ();
+}
+
+// Encode the len symbols m, which must be integers in [0,alph-1], with
+// tokens of the offset, the length and the next symbol appended to c.
+// Returns false if m has other values.
+//
+// The symbols are numbered from w = n-la zeros before the message, the
+// initial content of the search buffer, so that the symbol k is m[k-w].
+// The longest match is the longest run of the symbols from the position
+// i found at a distance of at most w, shorter than la and than the rest
+// of the message so that the next symbol follows it, and the closest
+// one among the longest. Matches of 3 symbols or more are searched for
+// through chains of the positions with the same hash of their first 3
+// symbols, from the closest one, and the last positions of each pair and
+// each symbol give the shorter ones
+template <typename T>
+static bool
+lz77_encode (const T *m, octave_idx_type len, double alph, int la, int w,
+             std::vector<double>& c)
+{
+  for (octave_idx_type k = 0; k < len; k++)
+    {
+      double x = lz77_value (m[k]);
+      if (! (x >= 0 && x < alph && x == std::floor (x)))
+        return false;
+    }
+
+  const octave_idx_type total = w + len;
+  auto sym = [&] (octave_idx_type k) -> uint32_t
+    {
+      return (k < w ? 0 : (uint32_t)lz77_value (m[k - w]));
+    };
+  auto hash = [&] (octave_idx_type k) -> uint32_t
+    {
+      uint32_t h = sym (k) * 0x9e3779b1u;
+      h = (h ^ (h >> 15) ^ sym (k + 1)) * 0x85ebca6bu;
+      h = (h ^ (h >> 13) ^ sym (k + 2)) * 0xc2b2ae35u;
+      return h >> (32 - LZ77_HASH_BITS);
+    };
+
+  // The chains, the position before k with the same hash being prev[k%w]
+  // as long as k is in the search buffer
+  std::vector<octave_idx_type> head ((size_t)1 << LZ77_HASH_BITS, -1);
+  std::vector<octave_idx_type> prev (w, -1);
+  std::unordered_map<uint64_t, octave_idx_type> last2;
+  std::unordered_map<uint32_t, octave_idx_type> last1;
+
+  octave_idx_type next = 0;
+  for (octave_idx_type i = w; i < total; )
+    {
+      if ((c.size () & 0xffff) == 0)
+        OCTAVE_QUIT;
+
+      for (; next < i; next++)
+        {
+          if (next + 2 < total)
+            {
+              uint32_t h = hash (next);
+              prev[next % w] = head[h];
+              head[h] = next;
+            }
+          last2[((uint64_t)sym (next) << 32) | sym (next + 1)] = next;
+          last1[sym (next)] = next;
+        }
+
+      octave_idx_type cap = std::min ((octave_idx_type)la, total - i) - 1;
+      octave_idx_type best = 0;
+      octave_idx_type bj = 0;
+
+      if (cap >= 3)
+        {
+          for (octave_idx_type j = head[hash (i)]; j >= 0 && i - j <= w;
+               j = prev[j % w])
+            {
+              octave_idx_type z = 0;
+              while (z < cap && sym (j + z) == sym (i + z))
+                z++;
+              if (z > best)
+                {
+                  best = z;
+                  bj = j;
+                  if (z == cap)
+                    break;
+                }
+            }
+
+          // A shorter match is that of another hash
+          if (best < 3)
+            best = 0;
+        }
+
+      if (best == 0 && cap >= 2)
+        {
+          auto e = last2.find (((uint64_t)sym (i) << 32) | sym (i + 1));
+          if (e != last2.end () && i - e->second <= w)
+            {
+              best = 2;
+              bj = e->second;
+            }
+        }
+
+      if (best == 0 && cap >= 1)
+        {
+          auto e = last1.find (sym (i));
+          if (e != last1.end () && i - e->second <= w)
+            {
+              best = 1;
+              bj = e->second;
+            }
+        }
+
+      c.push_back (best > 0 ? w - (i - bj) : 0);
+      c.push_back (best);
+      c.push_back (sym (i + best));
+      i += best + 1;
+    }
+
+  return true;
+}
+
+DEFUN_DLD (lz77enco, args, ,
+  "-*- texinfo -*-\n\
+@deftypefn {Loadable Function} {@var{c} =} lz77enco (@var{m}, @var{alph}, @var{la}, @var{n})\n\
+Lempel-Ziv 77 source algorithm implementation. Where\n\
+\n\
+@table @asis\n\
+@item @var{c}\n\
+encoded message (Mx3).\n\
+@item @var{alph}\n\
+size of alphabet, from 2 to 2^32.\n\
+@item @var{la}\n\
+lookahead buffer size.\n\
+@item @var{n}\n\
+sliding window buffer size.\n\
+@end table\n\
+\n\
+Each row of @var{c} is a token of the offset of the match in the search\n\
+buffer of the last @var{n}-@var{la} symbols, initially zeros, the length\n\
+of the match, and the symbol following it. The match is the longest one\n\
+shorter than @var{la}, and the closest one among the longest, or has a\n\
+length of 0 when the next symbol is not in the search buffer.\n\
+\n\
+The matches are found through chains of the earlier positions of the\n\
+same three symbols. @var{m} may be a uint8 or uint16 vector, such as\n\
+the bytes of a file read with @code{fread (@var{fid}, Inf, \"*uint8\")'},\n\
+and is then read without conversion.\n\
+@seealso{lz77deco}\n\
+@end deftypefn")
+{
+  octave_value_list retval;
+  int nargin = args.length ();
+
+  if (nargin != 4)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  double alph;
+  int la, n;
+  if (! lz77_get_params (args, "lz77enco", alph, la, n))
+    return retval;
+
+  if (args(0).rows () != 1 && ! args(0).is_empty ())
+    {
+      error ("lz77enco: M must be a row vector");
+      return retval;
+    }
+
+  std::vector<double> c;
+  bool ok;
+  if (args(0).is_uint8_type ())
+    {
+      uint8NDArray m = args(0).uint8_array_value ();
+      ok = lz77_encode (m.data (), m.numel (), alph, la, n - la, c);
+    }
+  else if (args(0).is_uint16_type ())
+    {
+      uint16NDArray m = args(0).uint16_array_value ();
+      ok = lz77_encode (m.data (), m.numel (), alph, la, n - la, c);
+    }
+  else
+    {
+      Matrix m = args(0).matrix_value ();
+      ok = lz77_encode (m.data (), m.numel (), alph, la, n - la, c);
+    }
+
+  if (! ok)
+    {
+      error ("lz77enco: M must hold integers from 0 to ALPH-1");
+      return retval;
+    }
+
+  octave_idx_type ntok = c.size () / 3;
+  Matrix tok (ntok, 3);
+  for (octave_idx_type t = 0; t < ntok; t++)
+    for (int j = 0; j < 3; j++)
+      tok(t, j) = c[3*t+j];
+
+  retval(0) = octave_value (tok);
+  return retval;
+}
+
+/*
+%!assert (lz77enco ([0 0 1 0 1 0 2 1 0 2 1 0 2 1 2 0 2 1 0 2 1 2 0 0], 3, 9, 18), [8 2 1; 7 3 2; 6 7 2; 2 8 0])
+%!assert (lz77enco ([2 2 2 2 2 2], 3, 4, 8), [0 0 2; 3 3 2; 0 0 2])
+%!assert (lz77enco (uint8 ([0 0 1 0 1 0 2 1 0 2 1 0 2 1 2 0 2 1 0 2 1 2 0 0]), 3, 9, 18), [8 2 1; 7 3 2; 6 7 2; 2 8 0])
+%!assert (lz77enco (zeros (1, 0), 2, 4, 8), zeros (0, 3))
+
+%!test
+%! ## A long text goes back through lz77deco
+%! m = double (repmat ("the quick brown fox jumps over the lazy dog ", 1, 500));
+%! m(randi (numel (m), 1, 200)) = randi (256, 1, 200) - 1;
+%! c = lz77enco (m, 256, 64, 4096);
+%! assert (rows (c) < numel (m) / 8)
+%! assert (all (c(:,2) < 64))
+%! assert (lz77deco (c, 256, 64, 4096), m)
+%! assert (lz77enco (uint8 (m), 256, 64, 4096), c)
+
+%% Test input validation
+%!error lz77enco ()
+%!error lz77enco (1, 1, 1, 1)
+%!error <positive integers> lz77enco (1, 2, 0, 4)
+%!error <2\*LA> lz77enco (1, 2, 3, 5)
+%!error <ALPH must be from 2 to 2\^32> lz77enco (1, 2^32 + 1, 2, 4)
+%!error <row vector> lz77enco ([0; 1], 2, 2, 4)
+%!error <integers from 0> lz77enco ([0 2], 2, 2, 4)
+*/
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
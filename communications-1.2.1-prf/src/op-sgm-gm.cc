@@ -0,0 +1,200 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+#include <octave/oct.h>
+#include <octave/oct-obj.h>
+#include <octave/ops.h>
+#include <octave/ov-bool-sparse.h>
+#include <octave/ov-re-sparse.h>
+
+#include "galois.h"
+#include "ov-galois.h"
+#include "ov-sparse-galois.h"
+#include "galois-ops.h"
+
+// sparse galois by galois ops. The products are formed from the sparse
+// array, and the other operations on the full array
+
+DEFBINOP_OP_G (sgm_gm_mul, sparse_galois, galois, *)
+DEFBINOP_OP_G (gm_sgm_mul, galois, sparse_galois, *)
+
+DEFBINOP (sgm_gm_add, sparse_galois, galois)
+{
+  CAST_BINOP_ARGS (const octave_sparse_galois&, const octave_galois&);
+
+  return new octave_galois (v1.galois_value () + v2.galois_value ());
+}
+
+DEFBINOP (sgm_gm_sub, sparse_galois, galois)
+{
+  CAST_BINOP_ARGS (const octave_sparse_galois&, const octave_galois&);
+
+  return new octave_galois (v1.galois_value () - v2.galois_value ());
+}
+
+DEFBINOP (gm_sgm_add, galois, sparse_galois)
+{
+  CAST_BINOP_ARGS (const octave_galois&, const octave_sparse_galois&);
+
+  return new octave_galois (v1.galois_value () + v2.galois_value ());
+}
+
+DEFBINOP (gm_sgm_sub, galois, sparse_galois)
+{
+  CAST_BINOP_ARGS (const octave_galois&, const octave_sparse_galois&);
+
+  return new octave_galois (v1.galois_value () - v2.galois_value ());
+}
+
+// The element by element products are taken at the non-zero elements of
+// the sparse array and stay sparse, and the comparisons are sparse logical
+// arrays
+
+DEFBINOP (sgm_gm_el_mul, sparse_galois, galois)
+{
+  CAST_BINOP_ARGS (const octave_sparse_galois&, const octave_galois&);
+
+  return new octave_sparse_galois (product (v1.sparse_galois_value (),
+                                            v2.galois_value ()));
+}
+
+DEFBINOP (gm_sgm_el_mul, galois, sparse_galois)
+{
+  CAST_BINOP_ARGS (const octave_galois&, const octave_sparse_galois&);
+
+  return new octave_sparse_galois (product (v1.galois_value (),
+                                            v2.sparse_galois_value ()));
+}
+
+DEFBINOP (sgm_gm_eq, sparse_galois, galois)
+{
+  CAST_BINOP_ARGS (const octave_sparse_galois&, const octave_galois&);
+
+  return octave_value (mx_el_eq (v1.sparse_galois_value (),
+                                 sparse_galois (v2.galois_value ())));
+}
+
+DEFBINOP (sgm_gm_ne, sparse_galois, galois)
+{
+  CAST_BINOP_ARGS (const octave_sparse_galois&, const octave_galois&);
+
+  return octave_value (mx_el_ne (v1.sparse_galois_value (),
+                                 sparse_galois (v2.galois_value ())));
+}
+
+DEFBINOP (gm_sgm_eq, galois, sparse_galois)
+{
+  CAST_BINOP_ARGS (const octave_galois&, const octave_sparse_galois&);
+
+  return octave_value (mx_el_eq (sparse_galois (v1.galois_value ()),
+                                 v2.sparse_galois_value ()));
+}
+
+DEFBINOP (gm_sgm_ne, galois, sparse_galois)
+{
+  CAST_BINOP_ARGS (const octave_galois&, const octave_sparse_galois&);
+
+  return octave_value (mx_el_ne (sparse_galois (v1.galois_value ()),
+                                 v2.sparse_galois_value ()));
+}
+
+// A concatenation with a sparse array is sparse, and starts from an empty
+// sparse logical array. That and any sparse matrix before the first
+// Galois array are converted to its field. A full Galois array only
+// starts a concatenation, such as horzcat, that is then full
+
+DEFCATOP (sgm_gm, sparse_galois, galois)
+{
+  CAST_BINOP_ARGS (octave_sparse_galois&, const octave_galois&);
+
+  return new octave_sparse_galois
+    (v1.sparse_galois_value (). concat (sparse_galois (v2.galois_value ()),
+                                        ra_idx));
+}
+
+DEFCATOP (gm_sgm, galois, sparse_galois)
+{
+  CAST_BINOP_ARGS (octave_galois&, const octave_sparse_galois&);
+
+  return new octave_galois (v1.galois_value (). concat (v2.galois_value (),
+                                                        ra_idx));
+}
+
+DEFCATOP (sm_gm, sparse_matrix, galois)
+{
+  CAST_BINOP_ARGS (octave_base_value&, const octave_galois&);
+
+  sparse_galois tmp (v1.sparse_matrix_value (), v2.m (), v2.primpoly ());
+  return new octave_sparse_galois
+    (tmp.concat (sparse_galois (v2.galois_value ()), ra_idx));
+}
+
+DEFASSIGNOP (sgm_gm_assign, sparse_galois, galois)
+{
+  CAST_BINOP_ARGS (octave_sparse_galois&, const octave_galois&);
+
+  v1.assign (idx, sparse_galois (v2.galois_value ()));
+  return octave_value ();
+}
+
+DEFASSIGNOP (gm_sgm_assign, galois, sparse_galois)
+{
+  CAST_BINOP_ARGS (octave_galois&, const octave_sparse_galois&);
+
+  v1.assign (idx, v2.galois_value ());
+  return octave_value ();
+}
+
+void
+install_sgm_gm_ops (void)
+{
+  INSTALL_BINOP (op_add, octave_sparse_galois, octave_galois, sgm_gm_add);
+  INSTALL_BINOP (op_sub, octave_sparse_galois, octave_galois, sgm_gm_sub);
+  INSTALL_BINOP (op_mul, octave_sparse_galois, octave_galois, sgm_gm_mul);
+
+  INSTALL_BINOP (op_add, octave_galois, octave_sparse_galois, gm_sgm_add);
+  INSTALL_BINOP (op_sub, octave_galois, octave_sparse_galois, gm_sgm_sub);
+  INSTALL_BINOP (op_mul, octave_galois, octave_sparse_galois, gm_sgm_mul);
+
+  INSTALL_BINOP (op_el_mul, octave_sparse_galois, octave_galois,
+                 sgm_gm_el_mul);
+  INSTALL_BINOP (op_eq, octave_sparse_galois, octave_galois, sgm_gm_eq);
+  INSTALL_BINOP (op_ne, octave_sparse_galois, octave_galois, sgm_gm_ne);
+  INSTALL_BINOP (op_el_mul, octave_galois, octave_sparse_galois,
+                 gm_sgm_el_mul);
+  INSTALL_BINOP (op_eq, octave_galois, octave_sparse_galois, gm_sgm_eq);
+  INSTALL_BINOP (op_ne, octave_galois, octave_sparse_galois, gm_sgm_ne);
+
+  INSTALL_G_CATOP (octave_sparse_galois, octave_galois, sgm_gm);
+  INSTALL_G_CATOP (octave_galois, octave_sparse_galois, gm_sgm);
+  INSTALL_G_CATOP (octave_sparse_matrix, octave_galois, sm_gm);
+  INSTALL_G_CATOP (octave_sparse_bool_matrix, octave_galois, sm_gm);
+
+  INSTALL_ASSIGNOP (op_asn_eq, octave_sparse_galois, octave_galois,
+                    sgm_gm_assign);
+  INSTALL_ASSIGNOP (op_asn_eq, octave_galois, octave_sparse_galois,
+                    gm_sgm_assign);
+}
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
@@ -0,0 +1,310 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+#include <octave/oct.h>
+#include <octave/ops.h>
+#include <octave/ov-bool-sparse.h>
+#include <octave/ov-re-mat.h>
+#include <octave/ov-re-sparse.h>
+#include <octave/ov-scalar.h>
+
+#include "galois.h"
+#include "ov-galois.h"
+#include "ov-sparse-galois.h"
+#include "galois-ops.h"
+
+// sparse galois by matrix and scalar ops. Need to create temporary
+// Galois array so that matrix values are checked. The same functions
+// serve the matrices and the scalars, through their matrix values
+
+DEFBINOP (sgm_m_add, sparse_galois, matrix)
+{
+  CAST_BINOP_ARGS (const octave_sparse_galois&, const octave_base_value&);
+
+  return new octave_galois (v1.galois_value () + v2.matrix_value ());
+}
+
+DEFBINOP (sgm_m_sub, sparse_galois, matrix)
+{
+  CAST_BINOP_ARGS (const octave_sparse_galois&, const octave_base_value&);
+
+  return new octave_galois (v1.galois_value () - v2.matrix_value ());
+}
+
+DEFBINOP (sgm_m_mul, sparse_galois, matrix)
+{
+  CAST_BINOP_ARGS (const octave_sparse_galois&, const octave_base_value&);
+
+  return new octave_galois (v1.sparse_galois_value () *
+                            galois (v2.matrix_value (), v1.m (),
+                                    v1.primpoly ()));
+}
+
+DEFBINOP (m_sgm_add, matrix, sparse_galois)
+{
+  CAST_BINOP_ARGS (const octave_base_value&, const octave_sparse_galois&);
+
+  return new octave_galois (v1.matrix_value () + v2.galois_value ());
+}
+
+DEFBINOP (m_sgm_sub, matrix, sparse_galois)
+{
+  CAST_BINOP_ARGS (const octave_base_value&, const octave_sparse_galois&);
+
+  return new octave_galois (v1.matrix_value () - v2.galois_value ());
+}
+
+DEFBINOP (m_sgm_mul, matrix, sparse_galois)
+{
+  CAST_BINOP_ARGS (const octave_base_value&, const octave_sparse_galois&);
+
+  return new octave_galois (galois (v1.matrix_value (), v2.m (),
+                                    v2.primpoly ()) *
+                            v2.sparse_galois_value ());
+}
+
+// sparse galois by sparse matrix ops, that stay sparse. The sparse matrix
+// is checked through a temporary sparse Galois array
+
+DEFBINOP (sgm_sm_add, sparse_galois, sparse_matrix)
+{
+  CAST_BINOP_ARGS (const octave_sparse_galois&, const octave_base_value&);
+
+  return new octave_sparse_galois
+    (v1.sparse_galois_value () +
+     sparse_galois (v2.sparse_matrix_value (), v1.m (), v1.primpoly ()));
+}
+
+DEFBINOP (sgm_sm_sub, sparse_galois, sparse_matrix)
+{
+  CAST_BINOP_ARGS (const octave_sparse_galois&, const octave_base_value&);
+
+  return new octave_sparse_galois
+    (v1.sparse_galois_value () -
+     sparse_galois (v2.sparse_matrix_value (), v1.m (), v1.primpoly ()));
+}
+
+DEFBINOP (sgm_sm_mul, sparse_galois, sparse_matrix)
+{
+  CAST_BINOP_ARGS (const octave_sparse_galois&, const octave_base_value&);
+
+  return new octave_sparse_galois
+    (v1.sparse_galois_value () *
+     sparse_galois (v2.sparse_matrix_value (), v1.m (), v1.primpoly ()));
+}
+
+DEFBINOP (sm_sgm_add, sparse_matrix, sparse_galois)
+{
+  CAST_BINOP_ARGS (const octave_base_value&, const octave_sparse_galois&);
+
+  return new octave_sparse_galois
+    (sparse_galois (v1.sparse_matrix_value (), v2.m (), v2.primpoly ()) +
+     v2.sparse_galois_value ());
+}
+
+DEFBINOP (sm_sgm_sub, sparse_matrix, sparse_galois)
+{
+  CAST_BINOP_ARGS (const octave_base_value&, const octave_sparse_galois&);
+
+  return new octave_sparse_galois
+    (sparse_galois (v1.sparse_matrix_value (), v2.m (), v2.primpoly ()) -
+     v2.sparse_galois_value ());
+}
+
+DEFBINOP (sm_sgm_mul, sparse_matrix, sparse_galois)
+{
+  CAST_BINOP_ARGS (const octave_base_value&, const octave_sparse_galois&);
+
+  return new octave_sparse_galois
+    (sparse_galois (v1.sparse_matrix_value (), v2.m (), v2.primpoly ()) *
+     v2.sparse_galois_value ());
+}
+
+// The element by element products, comparisons and concatenations serve
+// the matrices, scalars and sparse matrices alike, through their sparse
+// matrix values. The comparisons are those of the elements, as for the
+// full Galois arrays
+
+DEFBINOP (sgm_m_el_mul, sparse_galois, matrix)
+{
+  CAST_BINOP_ARGS (const octave_sparse_galois&, const octave_base_value&);
+
+  return new octave_sparse_galois
+    (product (v1.sparse_galois_value (),
+              sparse_galois (v2.sparse_matrix_value (), v1.m (),
+                             v1.primpoly ())));
+}
+
+DEFBINOP (m_sgm_el_mul, matrix, sparse_galois)
+{
+  CAST_BINOP_ARGS (const octave_base_value&, const octave_sparse_galois&);
+
+  return new octave_sparse_galois
+    (product (sparse_galois (v1.sparse_matrix_value (), v2.m (),
+                             v2.primpoly ()),
+              v2.sparse_galois_value ()));
+}
+
+DEFBINOP (sgm_m_eq, sparse_galois, matrix)
+{
+  CAST_BINOP_ARGS (const octave_sparse_galois&, const octave_base_value&);
+
+  return octave_value (mx_el_eq (v1.sparse_matrix_value (),
+                                 v2.sparse_matrix_value ()));
+}
+
+DEFBINOP (sgm_m_ne, sparse_galois, matrix)
+{
+  CAST_BINOP_ARGS (const octave_sparse_galois&, const octave_base_value&);
+
+  return octave_value (mx_el_ne (v1.sparse_matrix_value (),
+                                 v2.sparse_matrix_value ()));
+}
+
+DEFBINOP (m_sgm_eq, matrix, sparse_galois)
+{
+  CAST_BINOP_ARGS (const octave_base_value&, const octave_sparse_galois&);
+
+  return octave_value (mx_el_eq (v1.sparse_matrix_value (),
+                                 v2.sparse_matrix_value ()));
+}
+
+DEFBINOP (m_sgm_ne, matrix, sparse_galois)
+{
+  CAST_BINOP_ARGS (const octave_base_value&, const octave_sparse_galois&);
+
+  return octave_value (mx_el_ne (v1.sparse_matrix_value (),
+                                 v2.sparse_matrix_value ()));
+}
+
+// A concatenation with a sparse array starts from an empty sparse logical
+// array. That and the matrices before the first sparse Galois array are
+// converted to its field
+
+DEFCATOP (sgm_m, sparse_galois, matrix)
+{
+  CAST_BINOP_ARGS (octave_sparse_galois&, const octave_base_value&);
+
+  sparse_galois tmp (v2.sparse_matrix_value (), v1.m (), v1.primpoly ());
+  return new octave_sparse_galois (v1.sparse_galois_value (). concat (tmp,
+                                                                      ra_idx));
+}
+
+DEFCATOP (m_sgm, matrix, sparse_galois)
+{
+  CAST_BINOP_ARGS (octave_base_value&, const octave_sparse_galois&);
+
+  sparse_galois tmp (v1.sparse_matrix_value (), v2.m (), v2.primpoly ());
+  return new octave_sparse_galois (tmp.concat (v2.sparse_galois_value (),
+                                               ra_idx));
+}
+
+DEFASSIGNOP (sgm_m_assign, sparse_galois, matrix)
+{
+  CAST_BINOP_ARGS (octave_sparse_galois&, const octave_base_value&);
+
+  sparse_galois tmp (v2.sparse_matrix_value (), v1.m (), v1.primpoly ());
+  if (! error_state)
+    v1.assign (idx, tmp);
+  return octave_value ();
+}
+
+void
+install_sgm_m_ops (void)
+{
+  INSTALL_BINOP (op_add, octave_sparse_galois, octave_matrix, sgm_m_add);
+  INSTALL_BINOP (op_sub, octave_sparse_galois, octave_matrix, sgm_m_sub);
+  INSTALL_BINOP (op_mul, octave_sparse_galois, octave_matrix, sgm_m_mul);
+  INSTALL_BINOP (op_add, octave_sparse_galois, octave_scalar, sgm_m_add);
+  INSTALL_BINOP (op_sub, octave_sparse_galois, octave_scalar, sgm_m_sub);
+  INSTALL_BINOP (op_mul, octave_sparse_galois, octave_scalar, sgm_m_mul);
+
+  INSTALL_BINOP (op_add, octave_matrix, octave_sparse_galois, m_sgm_add);
+  INSTALL_BINOP (op_sub, octave_matrix, octave_sparse_galois, m_sgm_sub);
+  INSTALL_BINOP (op_mul, octave_matrix, octave_sparse_galois, m_sgm_mul);
+  INSTALL_BINOP (op_add, octave_scalar, octave_sparse_galois, m_sgm_add);
+  INSTALL_BINOP (op_sub, octave_scalar, octave_sparse_galois, m_sgm_sub);
+  INSTALL_BINOP (op_mul, octave_scalar, octave_sparse_galois, m_sgm_mul);
+
+  INSTALL_BINOP (op_add, octave_sparse_galois, octave_sparse_matrix,
+                 sgm_sm_add);
+  INSTALL_BINOP (op_sub, octave_sparse_galois, octave_sparse_matrix,
+                 sgm_sm_sub);
+  INSTALL_BINOP (op_mul, octave_sparse_galois, octave_sparse_matrix,
+                 sgm_sm_mul);
+  INSTALL_BINOP (op_add, octave_sparse_matrix, octave_sparse_galois,
+                 sm_sgm_add);
+  INSTALL_BINOP (op_sub, octave_sparse_matrix, octave_sparse_galois,
+                 sm_sgm_sub);
+  INSTALL_BINOP (op_mul, octave_sparse_matrix, octave_sparse_galois,
+                 sm_sgm_mul);
+
+  INSTALL_BINOP (op_el_mul, octave_sparse_galois, octave_matrix,
+                 sgm_m_el_mul);
+  INSTALL_BINOP (op_el_mul, octave_sparse_galois, octave_scalar,
+                 sgm_m_el_mul);
+  INSTALL_BINOP (op_el_mul, octave_sparse_galois, octave_sparse_matrix,
+                 sgm_m_el_mul);
+  INSTALL_BINOP (op_el_mul, octave_matrix, octave_sparse_galois,
+                 m_sgm_el_mul);
+  INSTALL_BINOP (op_el_mul, octave_scalar, octave_sparse_galois,
+                 m_sgm_el_mul);
+  INSTALL_BINOP (op_el_mul, octave_sparse_matrix, octave_sparse_galois,
+                 m_sgm_el_mul);
+
+  INSTALL_BINOP (op_eq, octave_sparse_galois, octave_matrix, sgm_m_eq);
+  INSTALL_BINOP (op_ne, octave_sparse_galois, octave_matrix, sgm_m_ne);
+  INSTALL_BINOP (op_eq, octave_sparse_galois, octave_scalar, sgm_m_eq);
+  INSTALL_BINOP (op_ne, octave_sparse_galois, octave_scalar, sgm_m_ne);
+  INSTALL_BINOP (op_eq, octave_sparse_galois, octave_sparse_matrix,
+                 sgm_m_eq);
+  INSTALL_BINOP (op_ne, octave_sparse_galois, octave_sparse_matrix,
+                 sgm_m_ne);
+  INSTALL_BINOP (op_eq, octave_matrix, octave_sparse_galois, m_sgm_eq);
+  INSTALL_BINOP (op_ne, octave_matrix, octave_sparse_galois, m_sgm_ne);
+  INSTALL_BINOP (op_eq, octave_scalar, octave_sparse_galois, m_sgm_eq);
+  INSTALL_BINOP (op_ne, octave_scalar, octave_sparse_galois, m_sgm_ne);
+  INSTALL_BINOP (op_eq, octave_sparse_matrix, octave_sparse_galois,
+                 m_sgm_eq);
+  INSTALL_BINOP (op_ne, octave_sparse_matrix, octave_sparse_galois,
+                 m_sgm_ne);
+
+  INSTALL_G_CATOP (octave_sparse_galois, octave_matrix, sgm_m);
+  INSTALL_G_CATOP (octave_sparse_galois, octave_scalar, sgm_m);
+  INSTALL_G_CATOP (octave_sparse_galois, octave_sparse_matrix, sgm_m);
+  INSTALL_G_CATOP (octave_sparse_galois, octave_sparse_bool_matrix, sgm_m);
+  INSTALL_G_CATOP (octave_matrix, octave_sparse_galois, m_sgm);
+  INSTALL_G_CATOP (octave_scalar, octave_sparse_galois, m_sgm);
+  INSTALL_G_CATOP (octave_sparse_matrix, octave_sparse_galois, m_sgm);
+  INSTALL_G_CATOP (octave_sparse_bool_matrix, octave_sparse_galois, m_sgm);
+
+  INSTALL_ASSIGNOP (op_asn_eq, octave_sparse_galois, octave_matrix,
+                    sgm_m_assign);
+  INSTALL_ASSIGNOP (op_asn_eq, octave_sparse_galois, octave_scalar,
+                    sgm_m_assign);
+  INSTALL_ASSIGNOP (op_asn_eq, octave_sparse_galois, octave_sparse_matrix,
+                    sgm_m_assign);
+}
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
@@ -0,0 +1,95 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+#include <octave/oct.h>
+#include <octave/oct-obj.h>
+#include <octave/ops.h>
+
+#include "galois.h"
+#include "ov-galois.h"
+#include "ov-sparse-galois.h"
+#include "galois-ops.h"
+
+// sparse galois unary ops.
+
+DEFUNOP (uminus, sparse_galois)
+{
+  CAST_UNOP_ARG (const octave_sparse_galois&);
+
+  // Unitary minus of Galois Field is itself!!
+  return new octave_sparse_galois (v.sparse_galois_value ());
+}
+
+DEFUNOP (uplus, sparse_galois)
+{
+  CAST_UNOP_ARG (const octave_sparse_galois&);
+
+  return new octave_sparse_galois (v.sparse_galois_value ());
+}
+
+DEFUNOP (transpose, sparse_galois)
+{
+  CAST_UNOP_ARG (const octave_sparse_galois&);
+
+  return new octave_sparse_galois (v.sparse_galois_value ().transpose ());
+}
+
+// sparse galois by sparse galois ops.
+
+DEFBINOP_OP_SG (add, sparse_galois, sparse_galois, +)
+DEFBINOP_OP_SG (sub, sparse_galois, sparse_galois, -)
+DEFBINOP_OP_SG (mul, sparse_galois, sparse_galois, *)
+
+DEFBINOP_FN (eq, sparse_galois, sparse_galois, mx_el_eq)
+DEFBINOP_FN (ne, sparse_galois, sparse_galois, mx_el_ne)
+
+DEFBINOP_FN_SG (el_mul, sparse_galois, sparse_galois, product)
+
+DEFCATOP_SG_METHOD (sgm_sgm, sparse_galois, sparse_galois, concat)
+
+DEFASSIGNOP_FN (assign, sparse_galois, sparse_galois, assign)
+
+void
+install_sgm_sgm_ops (void)
+{
+  INSTALL_UNOP (op_uminus, octave_sparse_galois, uminus);
+  INSTALL_UNOP (op_uplus, octave_sparse_galois, uplus);
+  INSTALL_UNOP (op_transpose, octave_sparse_galois, transpose);
+  INSTALL_UNOP (op_hermitian, octave_sparse_galois, transpose);
+
+  INSTALL_BINOP (op_add, octave_sparse_galois, octave_sparse_galois, add);
+  INSTALL_BINOP (op_sub, octave_sparse_galois, octave_sparse_galois, sub);
+  INSTALL_BINOP (op_mul, octave_sparse_galois, octave_sparse_galois, mul);
+  INSTALL_BINOP (op_eq, octave_sparse_galois, octave_sparse_galois, eq);
+  INSTALL_BINOP (op_ne, octave_sparse_galois, octave_sparse_galois, ne);
+  INSTALL_BINOP (op_el_mul, octave_sparse_galois, octave_sparse_galois,
+                 el_mul);
+
+  INSTALL_G_CATOP (octave_sparse_galois, octave_sparse_galois, sgm_sgm);
+
+  INSTALL_ASSIGNOP (op_asn_eq, octave_sparse_galois, octave_sparse_galois,
+                    assign);
+}
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
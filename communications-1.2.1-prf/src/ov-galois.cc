@@ -218,51 +218,58 @@ octave_galois::print (std::ostream& os, bool)
   print_raw (os);
 }
 
+// Print the primitive polynomial of GF(2^m), as in the header of the
+// full and sparse Galois arrays
 void
-octave_galois::print_raw (std::ostream& os, bool) const
+print_galois_primpoly (std::ostream& os, int m, int primpoly)
 {
   bool first = true;
-  int m = gval.m ();
-  int primpoly = gval.primpoly ();
-  Matrix data (gval.rows (), gval.cols ());
-
-  indent (os);
 
-  if (m == 1)
-    os << "GF(2) array.";
-  else
+  for (int i = m; i >= 0; i--)
     {
-      os << "GF(2^" << m << ") array. Primitive Polynomial = ";
-
-      for (int i = m; i >= 0; i--)
+      if (primpoly & (1<<i))
         {
-          if (primpoly & (1<<i))
+          if (i > 0)
             {
-              if (i > 0)
+              if (first)
                 {
-                  if (first)
-                    {
-                      first = false;
-                      os << "D";
-                    }
-                  else
-                    os << "+D";
-                  if (i != 1)
-                    os << "^" << i;
+                  first = false;
+                  os << "D";
                 }
               else
+                os << "+D";
+              if (i != 1)
+                os << "^" << i;
+            }
+          else
+            {
+              if (first)
                 {
-                  if (first)
-                    {
-                      first = false;
-                      os << "1";
-                    }
-                  else
-                    os << "+1";
+                  first = false;
+                  os << "1";
                 }
+              else
+                os << "+1";
             }
         }
-      os << " (decimal " << primpoly << ")";
+    }
+  os << " (decimal " << primpoly << ")";
+}
+
+void
+octave_galois::print_raw (std::ostream& os, bool) const
+{
+  int m = gval.m ();
+  Matrix data (gval.rows (), gval.cols ());
+
+  indent (os);
+
+  if (m == 1)
+    os << "GF(2) array.";
+  else
+    {
+      os << "GF(2^" << m << ") array. Primitive Polynomial = ";
+      print_galois_primpoly (os, m, gval.primpoly ());
     }
   newline (os);
   newline (os);
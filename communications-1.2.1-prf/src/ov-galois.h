@@ -174,6 +174,8 @@ private:
   DECLARE_OV_TYPEID_FUNCTIONS_AND_DATA
 };
 
+void print_galois_primpoly (std::ostream& os, int m, int primpoly);
+
 #endif
 
 /*
@@ -0,0 +1,280 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+#include <iostream>
+
+#include <octave/config.h>
+#include <octave/gripes.h>
+#include <octave/oct-obj.h>
+#include <octave/ov.h>
+#include <octave/pr-output.h>
+
+#include "galois.h"
+#include "ov-galois.h"
+#include "ov-sparse-galois.h"
+
+#if defined (DEFINE_OCTAVE_ALLOCATOR)
+DEFINE_OCTAVE_ALLOCATOR (octave_sparse_galois);
+#endif
+
+DEFINE_OV_TYPEID_FUNCTIONS_AND_DATA (octave_sparse_galois, "sparse galois",
+                                     "galois");
+
+octave_value
+octave_sparse_galois::resize (const dim_vector& dv, bool) const
+{
+  if (dv.length () > 2)
+    {
+      error ("Can not resize sparse galois structure to NDArray");
+      return octave_value ();
+    }
+  SparseMatrix data = gval.sparse_matrix_value ();
+  data.resize (dv);
+  return new octave_sparse_galois (data, gval.m (), gval.primpoly ());
+}
+
+octave_value_list
+octave_sparse_galois::dotref (const octave_value_list& idx)
+{
+  octave_value_list retval;
+
+  assert (idx.length () == 1);
+
+  std::string nm = idx(0).string_value ();
+
+  if (nm == __GALOIS_PRIMPOLY_STR)
+    retval(0) = octave_value ((double)gval.primpoly ());
+  else if (nm == __GALOIS_ORDER_STR)
+    retval(0) = octave_value ((double)gval.m ());
+  else if (nm == __GALOIS_DATA_STR)
+    retval(0) = octave_value (gval.sparse_matrix_value ());
+  else
+    error ("galois structure has no member `%s'", nm.c_str ());
+
+  return retval;
+}
+
+octave_value
+octave_sparse_galois::do_index_op (const octave_value_list& idx,
+                                   bool resize_ok)
+{
+  octave_value retval;
+
+  int len = idx.length ();
+
+  // The indexing is that of the sparse matrices, whose elements are
+  // already in the field
+  SparseMatrix data = gval.sparse_matrix_value ();
+
+  switch (len)
+    {
+    case 2:
+      {
+        idx_vector i = idx (0).index_vector ();
+        idx_vector j = idx (1).index_vector ();
+
+        if (! error_state)
+          retval = new octave_sparse_galois
+            (SparseMatrix (data.index (i, j, resize_ok)), gval.m (),
+             gval.primpoly ());
+      }
+      break;
+
+    case 1:
+      {
+        idx_vector i = idx (0).index_vector ();
+
+        if (! error_state)
+          retval = new octave_sparse_galois
+            (SparseMatrix (data.index (i, resize_ok)), gval.m (),
+             gval.primpoly ());
+      }
+      break;
+
+    default:
+      {
+        std::string n = type_name ();
+
+        error ("invalid number of indices (%d) for %s value",
+               len, n.c_str ());
+      }
+      break;
+    }
+
+  return retval;
+}
+
+void
+octave_sparse_galois::assign (const octave_value_list& idx,
+                              const sparse_galois& rhs)
+{
+  int len = idx.length ();
+
+  if (gval.have_field () && rhs.have_field ())
+    {
+      if ((gval.m () != rhs.m ()) || (gval.primpoly () != rhs.primpoly ()))
+        {
+          (*current_liboctave_error_handler) ("can not assign data between two different Galois Fields");
+          return;
+        }
+    }
+
+  // The assignment is that of the sparse matrices, as for the indexing
+  SparseMatrix data = gval.sparse_matrix_value ();
+  SparseMatrix rdata = rhs.sparse_matrix_value ();
+
+  switch (len)
+    {
+    case 2:
+      {
+        idx_vector i = idx (0).index_vector ();
+
+        if (! error_state)
+          {
+            idx_vector j = idx (1).index_vector ();
+
+            if (! error_state)
+              data.assign (i, j, rdata);
+          }
+      }
+      break;
+
+    case 1:
+      {
+        idx_vector i = idx (0).index_vector ();
+
+        if (! error_state)
+          data.assign (i, rdata);
+      }
+      break;
+
+    default:
+      error ("invalid number of indices (%d) for galois assignment",
+             len);
+      break;
+    }
+
+  if (! error_state)
+    gval = sparse_galois (data, gval.m (), gval.primpoly ());
+}
+
+octave_value
+octave_sparse_galois::subsref (const std::string &type,
+                               const std::list<octave_value_list>& idx)
+{
+  octave_value retval;
+
+  int skip = 1;
+
+  switch (type[0])
+    {
+    case '(':
+      retval = do_index_op (idx.front (), true);
+      break;
+
+    case '.':
+      {
+        octave_value_list t = dotref (idx.front ());
+
+        retval = (t.length () == 1) ? t(0) : octave_value (t);
+      }
+      break;
+
+    case '{':
+      error ("%s cannot be indexed with %c", type_name ().c_str (), type[0]);
+      break;
+
+    default:
+      panic_impossible ();
+    }
+
+  if (! error_state)
+    retval = retval.next_subsref (type, idx, skip);
+
+  return retval;
+}
+
+void
+#if defined (HAVE_OCTAVE_BASE_VALUE_PRINT_CONST)
+octave_sparse_galois::print (std::ostream& os, bool) const
+#else
+octave_sparse_galois::print (std::ostream& os, bool)
+#endif
+{
+  print_raw (os);
+}
+
+void
+octave_sparse_galois::print_raw (std::ostream& os, bool) const
+{
+  int m = gval.m ();
+  octave_idx_type nr = gval.rows ();
+  octave_idx_type nc = gval.cols ();
+  octave_idx_type nz = gval.nnz ();
+
+  indent (os);
+
+  if (m == 1)
+    os << "GF(2) sparse array.";
+  else
+    {
+      os << "GF(2^" << m << ") sparse array. Primitive Polynomial = ";
+      print_galois_primpoly (os, m, gval.primpoly ());
+    }
+  newline (os);
+  newline (os);
+  indent (os);
+
+  os << "Compressed Column Sparse (rows = " << nr << ", cols = " << nc
+     << ", nnz = " << nz << ")";
+  newline (os);
+
+  // The elements are listed as for the sparse matrices, one per line
+  if (nz > 0)
+    newline (os);
+  for (octave_idx_type j = 0; j < nc; j++)
+    {
+      OCTAVE_QUIT;
+
+      for (octave_idx_type k = gval.cidx (j); k < gval.cidx (j+1); k++)
+        {
+          indent (os);
+          os << "  (" << gval.ridx (k) + 1 << ", " << j + 1 << ") -> "
+             << gval.data (k);
+          newline (os);
+        }
+    }
+}
+
+bool
+octave_sparse_galois::print_name_tag (std::ostream& os,
+                                      const std::string& name) const
+{
+  indent (os);
+  os << name << " =";
+  newline (os);
+  return true;
+}
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
@@ -0,0 +1,152 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+#if !defined (octave_sparse_galois_ov_h)
+#define octave_sparse_galois_ov_h 1
+
+#include <octave/ov.h>
+#include <octave/ov-typeinfo.h>
+
+#include "galois.h"
+#include "ov-galois.h"
+#include "sparse-galois.h"
+
+class octave_value_list;
+class tree_walker;
+
+// Data structures.
+
+// The sparse Galois arrays have the class "galois", so that the methods
+// in @galois apply to them as well as to the full arrays
+
+class
+octave_sparse_galois : public octave_base_value
+{
+public:
+
+  octave_sparse_galois (void)
+    : octave_base_value (), gval (SparseMatrix (0, 0, 0)) { }
+
+  octave_sparse_galois (const SparseMatrix& data, const int _m = 1,
+                        const int _primpoly = 0)
+    : octave_base_value (), gval (data, _m, _primpoly) { }
+
+  octave_sparse_galois (const sparse_galois& gm)
+    : octave_base_value (), gval (gm) { }
+  octave_sparse_galois (const octave_sparse_galois& s)
+    : octave_base_value (), gval (s.gval) { }
+
+  ~octave_sparse_galois (void) { };
+
+  OV_REP_TYPE *clone (void) const { return new octave_sparse_galois (*this); }
+  OV_REP_TYPE *empty_clone (void) const { return new octave_sparse_galois (); }
+
+  octave_value subsref (const std::string &type,
+                        const std::list<octave_value_list>& idx);
+
+  octave_value_list subsref (const std::string& type,
+                             const std::list<octave_value_list>& idx, int)
+  { return subsref (type, idx); }
+
+  octave_value do_index_op (const octave_value_list& idx,
+                            bool resize_ok);
+
+  octave_value do_index_op (const octave_value_list& idx)
+  { return do_index_op (idx, 0); }
+
+  void assign (const octave_value_list& idx, const sparse_galois& rhs);
+
+  dim_vector dims (void) const { return gval.dims (); }
+
+  octave_value resize (const dim_vector& dv, bool) const;
+
+  octave_idx_type nnz (void) const { return gval.nnz (); }
+
+  octave_idx_type nzmax (void) const { return gval.nnz (); }
+
+  size_t byte_size (void) const { return gval.byte_size (); }
+
+  bool is_matrix_type (void) const { return true; }
+
+  bool is_sparse_type (void) const { return true; }
+
+  bool is_defined (void) const { return true; }
+
+  bool is_numeric_type (void) const { return true; }
+
+  bool is_constant (void) const { return true; }
+
+  bool is_galois_type (void) const { return true; }
+
+  bool print_as_scalar (void) const { return false; }
+
+#if defined (HAVE_OCTAVE_BASE_VALUE_PRINT_CONST)
+  void print (std::ostream& os, bool pr_as_read_syntax = false) const;
+#else
+  void print (std::ostream& os, bool pr_as_read_syntax = false);
+#endif
+
+  void print_raw (std::ostream& os, bool pr_as_read_syntax = false) const;
+
+  bool print_name_tag (std::ostream& os, const std::string& name) const;
+
+  bool is_real_matrix (void) const { return false; }
+
+  bool is_real_type (void) const { return false; }
+
+  Matrix matrix_value (bool = false) const
+  { return sparse_matrix_value ().matrix_value (); }
+
+  NDArray array_value (bool = false) const
+  { return NDArray (matrix_value ()); }
+
+  SparseMatrix sparse_matrix_value (bool = false) const
+  { return gval.sparse_matrix_value (); }
+
+  octave_value full_value (void) const
+  { return new octave_galois (gval.full ()); }
+
+  galois galois_value (void) const { return gval.full (); }
+
+  sparse_galois sparse_galois_value (void) const { return gval; }
+
+  octave_value_list dotref (const octave_value_list& idx);
+
+  int m (void) const { return gval.m (); }
+  int primpoly (void) const { return gval.primpoly (); }
+
+private:
+  // The compressed sparse column array of the Galois Field data
+  sparse_galois gval;
+
+#if defined (DECLARE_OCTAVE_ALLOCATOR)
+  DECLARE_OCTAVE_ALLOCATOR
+#endif
+
+  DECLARE_OV_TYPEID_FUNCTIONS_AND_DATA
+};
+
+#endif
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
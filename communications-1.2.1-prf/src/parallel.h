@@ -0,0 +1,128 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+#if !defined (octave_parallel_h)
+#define octave_parallel_h 1
+
+#include <octave/oct.h>
+
+#if defined (HAVE_STD_THREAD)
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif
+
+// The number of threads to use by default, one if threads are not
+// available
+static inline int
+parallel_threads (void)
+{
+#if defined (HAVE_STD_THREAD)
+  int n = std::thread::hardware_concurrency ();
+  return (n > 0 ? n : 1);
+#else
+  return 1;
+#endif
+}
+
+// An integer shared between the threads of parallel_for
+#if defined (HAVE_STD_THREAD)
+typedef std::atomic<int> parallel_int;
+#else
+typedef int parallel_int;
+#endif
+
+static inline void
+parallel_min (parallel_int& a, int v)
+{
+#if defined (HAVE_STD_THREAD)
+  int cur = a.load ();
+  while ((v < cur) && ! a.compare_exchange_weak (cur, v))
+    ;
+#else
+  if (v < a)
+    a = v;
+#endif
+}
+
+// Call fcn (i) for i = 0 to n-1 on up to nthreads threads, which take
+// the indices in increasing order. fcn must not call into the
+// interpreter, so an interrupt stops the workers taking new indices
+// and is only raised once they have all finished. An exception thrown
+// by fcn, such as std::bad_alloc, stops them in the same way, and the
+// first one is rethrown on the calling thread
+template <typename F>
+static void
+parallel_for (int n, int nthreads, F fcn)
+{
+#if defined (HAVE_STD_THREAD)
+  if ((nthreads > 1) && (n > 1))
+    {
+      std::atomic<int> next (0);
+      std::exception_ptr failure;
+      std::mutex failure_lock;
+      auto worker = [&] (void)
+        {
+          int i;
+          try
+            {
+              while ((i = next++) < n && ! octave_interrupt_state)
+                fcn (i);
+            }
+          catch (...)
+            {
+              std::lock_guard<std::mutex> lock (failure_lock);
+              if (! failure)
+                failure = std::current_exception ();
+              next = n;
+            }
+        };
+
+      std::vector<std::thread> pool;
+      for (int t = 1; (t < nthreads) && (t < n); t++)
+        pool.push_back (std::thread (worker));
+      worker ();
+      for (size_t t = 0; t < pool.size (); t++)
+        pool[t].join ();
+
+      if (failure)
+        std::rethrow_exception (failure);
+
+      OCTAVE_QUIT;
+      return;
+    }
+#endif
+
+  for (int i = 0; i < n; i++)
+    {
+      OCTAVE_QUIT;
+      fcn (i);
+    }
+}
+
+#endif
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
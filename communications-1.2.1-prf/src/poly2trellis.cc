@@ -0,0 +1,338 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+
+#include <vector>
+
+#include <octave/oct.h>
+#include <octave/oct-map.h>
+
+#include "bitpack.h"
+#include "trellis.h"
+
+// The decimal number with the octal digits of v
+static double
+poly2trellis_dec2oct (int v)
+{
+  double r = 0;
+  for (double mul = 1; v > 0; mul *= 10, v >>= 3)
+    r += (v & 7) * mul;
+  return r;
+}
+
+DEFUN_DLD (poly2trellis, args, ,
+  "-*- texinfo -*-\n\
+@deftypefn  {Loadable Function} {@var{t} =} poly2trellis (@var{m}, @var{g})\n\
+@deftypefnx {Loadable Function} {@var{t} =} poly2trellis (@var{m}, @var{g}, @var{f})\n\
+\n\
+Convert convolutional code generator polynomials into trellis form.\n\
+\n\
+The arguments @var{m} and @var{g} together describe a rate k/n feedforward\n\
+convolutional encoder.  The output @var{t} is a trellis structure describing\n\
+the same encoder with the fields listed below.\n\
+\n\
+The vector @var{m} is a 1-by-k array containing the lengths of each of the\n\
+shift registers for the k input bits to the encoder.\n\
+\n\
+The matrix @var{g} is a k-by-n octal-value matrix describing the generation\n\
+of each of the n outputs from each of the k inputs.  For a particular entry\n\
+of @var{g}, the least-significant bit corresponds to the most-delayed input\n\
+bit in the kth shift-register.\n\
+\n\
+The optional 1-by-k octal vector @var{f} gives the feedback connections\n\
+of a recursive encoder.  The value entering the ith shift register is\n\
+then its input bit added to the bits of the register selected by\n\
+@var{f}(i), whose most significant bit, which must be set, stands for\n\
+that value, and the generators in @var{g} select the bits of the\n\
+register and that value.  For example, @code{poly2trellis (4, [13 15],\n\
+13)} is the recursive systematic code of the LTE turbo code.\n\
+\n\
+The returned trellis structure contains the following fields:\n\
+\n\
+@table @samp\n\
+@item numInputSymbols\n\
+The number of k-bit input symbols possible, i.e. 2^k.\n\
+\n\
+@item numOutputSymbols\n\
+The number of n-bit output symbols possible, i.e. 2^n.\n\
+\n\
+@item numStates\n\
+The number of states in the trellis.\n\
+\n\
+@item nextStates\n\
+The state transition table for the trellis.  The ith row contains the indices\n\
+of the states reachable from the (i-1)th state for each possible input\n\
+symbol.\n\
+\n\
+@item outputs\n\
+A table of octal-encoded output values for the trellis.  The ith row contains\n\
+values representing the output symbols produced in the (i-1)th state for each\n\
+possible input symbol.\n\
+@end table\n\
+\n\
+Input symbols, output symbols, and encoder states are all interpreted with\n\
+the lowest indices being the most significant bits.\n\
+\n\
+The functions of the package that take a trellis structure keep the\n\
+tables they build from the last few of them, so that passing the same\n\
+structure again does not validate and convert it again.\n\
+\n\
+References:\n\
+\n\
+    [1] S. Lin and D. J. Costello, \"Convolutional codes,\" in @cite{Error\n\
+    Control Coding}, 2nd ed. Upper Saddle River, NJ: Pearson, 2004,\n\
+    ch. 11, pp. 453-513.\n\
+\n\
+@seealso{istrellis, convenc, vitdec}\n\
+@end deftypefn")
+{
+  octave_value retval;
+  int nargin = args.length ();
+
+  if (nargin < 2 || nargin > 3)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  // Notation agrees with Lin & Costello for the most part:
+  // m = length of each modulo-2 adder
+  //   = 1 + nu(:) = one more than length of each shift register
+  // g = generator sequences, k-by-n
+  // k = bits per input symbol = number of shift registers
+  // n = bits per output symbol = number of modulo-2 adders
+  Matrix m = args(0).matrix_value ();
+  int k = m.columns ();
+  bool ok = (m.rows () == 1 && k > 0);
+  for (int i = 0; ok && (i < k); i++)
+    ok = (m(i) > 0 && m(i) == std::floor (m(i)) && m(i) <= 25);
+  if (! ok)
+    {
+      error ("poly2trellis: M must be a 1-by-k positive integer row vector");
+      return retval;
+    }
+
+  Matrix gm = args(1).matrix_value ();
+  int n = gm.columns ();
+  if (gm.rows () != k || n < 1 || n > 16)
+    {
+      error ("poly2trellis: G must be a k-by-n octal matrix");
+      return retval;
+    }
+
+  std::vector<int> g (k * n);
+  for (int i = 0; i < k; i++)
+    for (int j = 0; j < n; j++)
+      {
+        g[i*n+j] = trellis_oct2dec (gm(i,j));
+        if (g[i*n+j] < 0)
+          {
+            error ("poly2trellis: G must be a k-by-n octal matrix");
+            return retval;
+          }
+      }
+
+  std::vector<int> f (k, 0);
+  if (nargin > 2)
+    {
+      Matrix fm = args(2).matrix_value ();
+      ok = (fm.rows () == 1 && fm.columns () == k);
+      for (int i = 0; ok && (i < k); i++)
+        {
+          f[i] = trellis_oct2dec (fm(i));
+          ok = (f[i] >= (1 << ((int)m(i) - 1)) && f[i] < (1 << (int)m(i)));
+        }
+      if (! ok)
+        {
+          error ("poly2trellis: F must be a 1-by-k octal vector with the "
+                 "highest bit of each constraint length set");
+          return retval;
+        }
+    }
+
+  // nu = total number of linear shift registers for all k
+  int nu = 0;
+  for (int i = 0; i < k; i++)
+    {
+      int mi = (int)m(i);
+      nu += mi - 1;
+
+      bool big = false;
+      bool small = true;
+      bool odd = false;
+      for (int j = 0; j < n; j++)
+        {
+          big = big || (g[i*n+j] >= (1 << mi));
+          small = small && (g[i*n+j] < (1 << (mi - 1)));
+          odd = odd || (g[i*n+j] & 1);
+        }
+      if (big)
+        {
+          error ("poly2trellis: code size is greater than constraint length");
+          return retval;
+        }
+      if (small || ! odd)
+        {
+          error ("poly2trellis: code size is less than constraint length");
+          return retval;
+        }
+    }
+
+  if (nu > 24 || k > 16)
+    {
+      error ("poly2trellis: the code must have at most 2^24 states and 16 inputs");
+      return retval;
+    }
+
+  int nstates = 1 << nu;
+  int ninputs = 1 << k;
+
+  // Each shift register shifts to the right, MSB-to-LSB, its MSB being
+  // the newest input, and holds the bits of the state from shift(i)
+  // up. The next value and the outputs of the register i are tabulated
+  // for each of its values r and input bits u at lnext[i][2*r+u] and
+  // lout[i][2*r+u]
+  std::vector<int> shift (k);
+  std::vector< std::vector<int> > lnext (k);
+  std::vector< std::vector<int> > lout (k);
+  for (int i = 0, offset = 0; i < k; i++)
+    {
+      int nui = (int)m(i) - 1;
+      shift[i] = offset;
+      offset += nui;
+
+      lnext[i].resize (2 << nui);
+      lout[i].resize (2 << nui);
+      for (int r = 0; r < (1 << nui); r++)
+        for (int u = 0; u < 2; u++)
+          {
+            // The value entering the register, with the feedback bits of
+            // the register added to the input bit
+            int a = u ^ (bitpack_popcount (f[i] & r) & 1);
+            int x = (a << nui) | r;
+            int o = 0;
+            for (int j = 0; j < n; j++)
+              o |= (bitpack_popcount (g[i*n+j] & x) & 1) << (n - j - 1);
+            lnext[i][2*r+u] = (x >> 1) << shift[i];
+            lout[i][2*r+u] = o;
+          }
+    }
+
+  Matrix next (nstates, ninputs);
+  Matrix out (nstates, ninputs);
+  std::vector<double> oct (1 << n);
+  for (int o = 0; o < (1 << n); o++)
+    oct[o] = poly2trellis_dec2oct (o);
+
+  double *pnext = next.fortran_vec ();
+  double *pout = out.fortran_vec ();
+  std::vector<int> idx (k);
+  for (int s = 0; s < nstates; s++)
+    {
+      if ((s & 0xffff) == 0)
+        OCTAVE_QUIT;
+
+      for (int i = 0; i < k; i++)
+        idx[i] = 2 * ((s >> shift[i]) & ((1 << ((int)m(i) - 1)) - 1));
+      for (int sym = 0; sym < ninputs; sym++)
+        {
+          int nx = 0;
+          int o = 0;
+          for (int i = 0; i < k; i++)
+            {
+              int e = idx[i] + ((sym >> (k - i - 1)) & 1);
+              nx |= lnext[i][e];
+              o ^= lout[i][e];
+            }
+          pnext[s + (size_t)sym*nstates] = nx;
+          pout[s + (size_t)sym*nstates] = oct[o];
+        }
+    }
+
+  octave_scalar_map t;
+  t.assign ("numInputSymbols", octave_value (ninputs));
+  t.assign ("numOutputSymbols", octave_value (1 << n));
+  t.assign ("numStates", octave_value (nstates));
+  t.assign ("nextStates", octave_value (next));
+  t.assign ("outputs", octave_value (out));
+
+  retval = octave_value (t);
+  return retval;
+}
+
+/*
+%% Test the simple (2,1,3) encoder from Lin & Costello example 11.1
+%!test
+%! T = struct ("numInputSymbols",  2,
+%!             "numOutputSymbols", 4,
+%!             "numStates",        8,
+%!             "nextStates",       [0 4; 0 4; 1 5; 1 5; 2 6; 2 6; 3 7; 3 7],
+%!             "outputs",          [0 3; 3 0; 3 0; 0 3; 1 2; 2 1; 2 1; 1 2]);
+%! t = poly2trellis (4, [13 17]);
+%! assert (t, T)
+%! assert (istrellis (t), true)
+
+%!test
+%! ## The recursive systematic code of LTE
+%! T = struct ("numInputSymbols", 2, "numOutputSymbols", 4, "numStates", 8,
+%!             "nextStates", zeros (8, 2), "outputs", zeros (8, 2));
+%! for s = 0:7
+%!   d = bitget (s, [3 2 1]);
+%!   for u = 0:1
+%!     a = mod (u + d(2) + d(3), 2);
+%!     T.nextStates(s+1,u+1) = 4 * a + floor (s / 2);
+%!     T.outputs(s+1,u+1) = 2 * u + mod (a + d(1) + d(3), 2);
+%!   endfor
+%! endfor
+%! assert (poly2trellis (4, [13 15], 13), T)
+%! assert (poly2trellis (4, [13 15], 10), poly2trellis (4, [13 15]))
+
+%!test
+%! ## Codes of several inputs
+%! t = poly2trellis ([5 4], [23 35 0; 0 5 13]);
+%! assert (t.numStates, 128)
+%! assert (t.numInputSymbols, 4)
+%! assert (t.numOutputSymbols, 8)
+%! assert (istrellis (t), true)
+%! assert (t.nextStates(1,:), [0 64 8 72])
+%! assert (t.outputs(1,:), [0 1 6 7])
+%! t = poly2trellis ([3 3], [5 7; 3 6], [5 7]);
+%! assert (istrellis (t), true)
+%! m = randi ([0 1], 1, 100);
+%! assert (vitdec (convenc (m, t), t, 20, "trunc", "hard"), m)
+
+%% Test input validation
+%!error poly2trellis ()
+%!error poly2trellis (1, 2, 3, 4)
+%!error poly2trellis (1)
+%!error poly2trellis (2, 8)
+%!error poly2trellis (0, 0)
+%!error poly2trellis (2, 0)
+%!error poly2trellis (2, 2)
+%!error poly2trellis (2, 7)
+%!error <F> poly2trellis (3, [7 5], 3)
+%!error <F> poly2trellis (3, [7 5], [7 7])
+*/
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
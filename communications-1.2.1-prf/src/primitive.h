@@ -0,0 +1,304 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+#if !defined (octave_primitive_h)
+#define octave_primitive_h 1
+
+#include <algorithm>
+#include <vector>
+
+#include "bitpack.h"
+
+// Primitive polynomials p = x^m + plow over GF(2), for m from 1 to 64.
+// The residues modulo p have degree below m and are held in one word,
+// as is plow, so that x^m itself never needs to be stored
+
+static inline bitpack_word
+primitive_mask (int m)
+{
+  return (m == 64 ? ~(bitpack_word)0 : ((bitpack_word)1 << m) - 1);
+}
+
+static inline int
+primitive_degree (bitpack_word a)
+{
+  int d = -1;
+  while (a)
+    {
+      a >>= 1;
+      d++;
+    }
+  return d;
+}
+
+// a * x modulo p
+static inline bitpack_word
+primitive_mulx (bitpack_word a, bitpack_word plow, int m)
+{
+  bitpack_word c = (a >> (m - 1)) & 1;
+  a = (a << 1) & primitive_mask (m);
+  return (c ? a ^ plow : a);
+}
+
+static inline bitpack_word
+primitive_mulmod (bitpack_word a, bitpack_word b, bitpack_word plow, int m)
+{
+  bitpack_word r = 0;
+  while (b)
+    {
+      if (b & 1)
+        r ^= a;
+      b >>= 1;
+      a = primitive_mulx (a, plow, m);
+    }
+  return r;
+}
+
+// a^e modulo p, by square and multiply from the leading bit of e
+static inline bitpack_word
+primitive_powmod (bitpack_word a, uint64_t e, bitpack_word plow, int m)
+{
+  bitpack_word r = 1;
+  for (int i = 63; i >= 0; i--)
+    {
+      r = primitive_mulmod (r, r, plow, m);
+      if ((e >> i) & 1)
+        r = primitive_mulmod (r, a, plow, m);
+    }
+  return r;
+}
+
+// The remainder of a by b in GF(2)[x], for a non-zero b
+static inline bitpack_word
+primitive_rem (bitpack_word a, bitpack_word b)
+{
+  int db = primitive_degree (b);
+  for (int da = primitive_degree (a); da >= db; da = primitive_degree (a))
+    a ^= b << (da - db);
+  return a;
+}
+
+// gcd (p, g) for a non-zero residue g, starting from p modulo g
+static inline bitpack_word
+primitive_gcd (bitpack_word g, bitpack_word plow, int m)
+{
+  int dg = primitive_degree (g);
+  bitpack_word a = 1;
+  if (dg > 0)
+    for (int i = 0; i < m; i++)
+      {
+        a <<= 1;
+        if ((a >> dg) & 1)
+          a ^= g;
+      }
+  else
+    a = 0;
+  a ^= primitive_rem (plow, g);
+
+  bitpack_word b = g;
+  while (a)
+    {
+      bitpack_word r = primitive_rem (b, a);
+      b = a;
+      a = r;
+    }
+  return b;
+}
+
+// Arithmetic modulo an integer n below 2^64, for factoring 2^m-1
+static inline uint64_t
+primitive_mul64 (uint64_t a, uint64_t b, uint64_t n)
+{
+#if defined (__SIZEOF_INT128__)
+  return (uint64_t)(((unsigned __int128)a * b) % n);
+#else
+  uint64_t r = 0;
+  a %= n;
+  while (b)
+    {
+      if (b & 1)
+        r = (r >= n - a ? r - (n - a) : r + a);
+      a = (a >= n - a ? a - (n - a) : a + a);
+      b >>= 1;
+    }
+  return r;
+#endif
+}
+
+static inline uint64_t
+primitive_pow64 (uint64_t a, uint64_t e, uint64_t n)
+{
+  uint64_t r = 1 % n;
+  a %= n;
+  while (e)
+    {
+      if (e & 1)
+        r = primitive_mul64 (r, a, n);
+      a = primitive_mul64 (a, a, n);
+      e >>= 1;
+    }
+  return r;
+}
+
+// Miller-Rabin with the first twelve prime bases, which is exact for
+// all n below 2^64
+static inline bool
+primitive_is_prime (uint64_t n)
+{
+  static const uint64_t bases[] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37};
+
+  if (n < 2)
+    return false;
+  for (int i = 0; i < 12; i++)
+    if (n % bases[i] == 0)
+      return (n == bases[i]);
+
+  uint64_t d = n - 1;
+  int s = 0;
+  while (! (d & 1))
+    {
+      d >>= 1;
+      s++;
+    }
+
+  for (int i = 0; i < 12; i++)
+    {
+      uint64_t x = primitive_pow64 (bases[i], d, n);
+      if (x == 1 || x == n - 1)
+        continue;
+      int r;
+      for (r = 1; r < s; r++)
+        {
+          x = primitive_mul64 (x, x, n);
+          if (x == n - 1)
+            break;
+        }
+      if (r == s)
+        return false;
+    }
+  return true;
+}
+
+static inline uint64_t
+primitive_gcd64 (uint64_t a, uint64_t b)
+{
+  while (b)
+    {
+      uint64_t r = a % b;
+      a = b;
+      b = r;
+    }
+  return a;
+}
+
+// A non-trivial factor of the odd composite n, by Pollard's rho
+static inline uint64_t
+primitive_rho (uint64_t n)
+{
+  for (uint64_t c = 1; ; c++)
+    {
+      uint64_t x = 2, y = 2, d = 1;
+      while (d == 1)
+        {
+          x = (primitive_mul64 (x, x, n) + c) % n;
+          y = (primitive_mul64 (y, y, n) + c) % n;
+          y = (primitive_mul64 (y, y, n) + c) % n;
+          d = primitive_gcd64 (x > y ? x - y : y - x, n);
+        }
+      if (d != n)
+        return d;
+    }
+}
+
+static inline void
+primitive_factor (uint64_t n, std::vector<uint64_t>& primes)
+{
+  for (uint64_t q = 2; (q < 64) && (n > 1); q++)
+    if (n % q == 0)
+      {
+        primes.push_back (q);
+        while (n % q == 0)
+          n /= q;
+      }
+
+  if (n == 1)
+    return;
+  if (primitive_is_prime (n))
+    primes.push_back (n);
+  else
+    {
+      uint64_t d = primitive_rho (n);
+      primitive_factor (d, primes);
+      primitive_factor (n / d, primes);
+    }
+}
+
+// The exponents (2^m-1)/q for the distinct primes q dividing 2^m-1
+static inline std::vector<uint64_t>
+primitive_cofactors (int m)
+{
+  uint64_t n = primitive_mask (m);
+  std::vector<uint64_t> primes;
+  primitive_factor (n, primes);
+  std::sort (primes.begin (), primes.end ());
+  primes.erase (std::unique (primes.begin (), primes.end ()), primes.end ());
+
+  std::vector<uint64_t> cof;
+  for (size_t i = 0; i < primes.size (); i++)
+    cof.push_back (n / primes[i]);
+  return cof;
+}
+
+// p = x^m + plow is primitive if it is irreducible and x has order
+// 2^m-1 modulo p. Irreducibility is tested first with Ben-Or's
+// algorithm, gcd (x^(2^i) - x, p) being one for all i up to m/2, as it
+// rejects most candidates after a few squarings. In the field
+// GF(2)[x]/p the order of x divides 2^m-1, and is 2^m-1 unless
+// x^((2^m-1)/q) is one for one of its prime factors q
+static inline bool
+primitive_test (bitpack_word plow, int m, const std::vector<uint64_t>& cof)
+{
+  // Fast return since primitive polynomial can't be even
+  if (! (plow & 1))
+    return false;
+
+  bitpack_word x = primitive_mulx (1, plow, m);
+  bitpack_word xi = x;
+  for (int i = 1; i <= m / 2; i++)
+    {
+      xi = primitive_mulmod (xi, xi, plow, m);
+      if ((xi == x) || (primitive_gcd (xi ^ x, plow, m) != 1))
+        return false;
+    }
+
+  for (size_t i = 0; i < cof.size (); i++)
+    if (primitive_powmod (x, cof[i], plow, m) == 1)
+      return false;
+
+  return true;
+}
+
+#endif
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
@@ -18,11 +18,16 @@
 // program with any Open Source program, as defined by the Open Source
 // Initiative (www.opensource.org)
 
+#include <algorithm>
 #include <iostream>
 #include <string>
+#include <vector>
 
 #include <octave/oct.h>
 
+#include "parallel.h"
+#include "primitive.h"
+
 enum primpoly_type
 {
   PRIMPOLY_MIN=0,
@@ -31,34 +36,41 @@ enum primpoly_type
   PRIMPOLY_K
 };
 
-static bool
-do_isprimitive (const int& a, const int& m)
+static uint64_t
+primpoly_binomial (int n, int r)
 {
-  // Fast return since primitive polynomial can't be even
-  if (!(a & 1))
-    return false;
-
-  RowVector repr (1<<m, 0);
-  int mask = 1;
-  int n = (1<<m) - 1;
+  if ((r < 0) || (r > n))
+    return 0;
+  uint64_t c = 1;
+  for (int i = 0; i < r; i++)
+    c = c * (n - i) / (i + 1);
+  return c;
+}
 
-  repr(0) = 1;
-  for (int i = 0; i < n; i++)
+// The idx-th set of j bits in increasing order of value, which is the
+// order of the combinatorial number system
+static bitpack_word
+primpoly_unrank (uint64_t idx, int j)
+{
+  bitpack_word v = 0;
+  for (int i = j; i > 0; i--)
     {
-      repr(mask) = 1;
-      mask <<= 1;
-      if (mask & (1<<m))
-        mask ^= a;
+      int c = i - 1;
+      while (primpoly_binomial (c + 1, i) <= idx)
+        c++;
+      v |= (bitpack_word)1 << c;
+      idx -= primpoly_binomial (c, i);
     }
+  return v;
+}
 
-  if (mask != 1)
-    return false;
-
-  for (int i = 0; i < n+1; i++)
-    if (!repr(i))
-      return false;
-
-  return true;
+// The next larger word with the same number of bits as v
+static bitpack_word
+primpoly_next (bitpack_word v)
+{
+  bitpack_word c = v & (~v + 1);
+  bitpack_word r = v + c;
+  return (((r ^ v) >> 2) / c) | r;
 }
 
 DEFUN_DLD (primpoly, args, nargout,
@@ -91,6 +103,10 @@ Returns the primitive polynomials having exactly @var{k} non-zero terms\n\
 The call @code{primpoly (@dots{}, \"nodisplay\")} disables the output of\n\
 the polynomial forms of the primitives. The return value is not affected.\n\
 \n\
+@var{m} can be at most 52, so that the integer representations of the\n\
+polynomials are exact. The candidates for @code{\"all\"} and @var{k} are\n\
+tested on all available processors.\n\
+\n\
 @seealso{gf, isprimitive}\n\
 @end deftypefn")
 {
@@ -110,11 +126,11 @@ the polynomial forms of the primitives. The return value is not affected.\n\
 
   m = args(0).int_value ();
 
-  // The upper limit is an artifical limit caused by memory requirements
-  // in do_is_primitive. m=22 uses an array of 32MBytes!!
-  if ((m < 1) || (m > 22))
+  // The upper limit is that of the integer representation of the
+  // polynomials in a double
+  if ((m < 1) || (m > 52))
     {
-      error ("primpoly: m must be greater than 1 and less than 22");
+      error ("primpoly: m must be between 1 and 52");
       return retval;
     }
   if (nargin > 1)
@@ -192,51 +208,74 @@ the polynomial forms of the primitives. The return value is not affected.\n\
         }
     }
 
+  std::vector<uint64_t> cof = primitive_cofactors (m);
+  bitpack_word top = (bitpack_word)1 << m;
+
   switch (type)
     {
     case PRIMPOLY_MIN:
       primpolys.resize (1);
-      for (int i = (1<<m)+1; i < (1<<(1+m)); i+=2)
-        if (do_isprimitive (i, m))
-          {
-            primpolys(0) = (double)i;
-            break;
-          }
+      for (bitpack_word plow = 1; plow < top; plow += 2)
+        {
+          OCTAVE_QUIT;
+          if (primitive_test (plow, m, cof))
+            {
+              primpolys(0) = (double)(top | plow);
+              break;
+            }
+        }
       break;
     case PRIMPOLY_MAX:
       primpolys.resize (1);
-      for (int i = (1<<(m+1))-1; i > (1<<m); i-=2)
-        if (do_isprimitive (i, m))
-          {
-            primpolys(0) = (double)i;
-            break;
-          }
-      break;
-    case PRIMPOLY_ALL:
-      for (int i = (1<<m)+1; i < (1<<(1+m)); i+=2)
-        if (do_isprimitive (i, m))
-          {
-            primpolys.resize (primpolys.length ()+1);
-            primpolys(primpolys.length ()-1) = (double)i;
-          }
-      break;
-    case PRIMPOLY_K:
-      for (int i = (1<<m)+1; i < (1<<(1+m)); i+=2)
+      for (bitpack_word i = top >> 1; i-- > 0; )
         {
-          int ki = 0;
-          for (int j = 0; j < m+1; j++)
-            if (i & (1 << j))
-              ki++;
-          if (ki == k)
+          OCTAVE_QUIT;
+          if (primitive_test (2 * i + 1, m, cof))
             {
-              if (do_isprimitive (i, m))
-                {
-                  primpolys.resize (primpolys.length ()+1);
-                  primpolys(primpolys.length ()-1) = (double)i;
-                }
+              primpolys(0) = (double)(top | (2 * i + 1));
+              break;
             }
         }
       break;
+    case PRIMPOLY_ALL:
+    case PRIMPOLY_K:
+      {
+        // The candidates are all odd plow, or those with k-2 of the
+        // bits 1 to m-1 set, tested in blocks on all processors and
+        // gathered in order
+        int j = k - 2;
+        uint64_t total = (type == PRIMPOLY_ALL ? top >> 1
+                          : primpoly_binomial (m - 1, j));
+        uint64_t bs = std::max (total >> 16, (uint64_t)1024);
+        int nblocks = (total + bs - 1) / bs;
+        std::vector<std::vector<double> > found (nblocks);
+
+        parallel_for (nblocks, parallel_threads (), [&] (int b)
+          {
+            uint64_t i0 = b * bs;
+            uint64_t i1 = std::min (total, i0 + bs);
+            bitpack_word v = (type == PRIMPOLY_K ? primpoly_unrank (i0, j) : 0);
+            for (uint64_t i = i0; i < i1; i++)
+              {
+                bitpack_word plow = (type == PRIMPOLY_ALL ? 2 * i + 1
+                                     : (v << 1) | 1);
+                if (primitive_test (plow, m, cof))
+                  found[b].push_back ((double)(top | plow));
+                if ((type == PRIMPOLY_K) && (i + 1 < i1))
+                  v = primpoly_next (v);
+              }
+          });
+
+        int nfound = 0;
+        for (int b = 0; b < nblocks; b++)
+          nfound += found[b].size ();
+        primpolys.resize (nfound);
+        nfound = 0;
+        for (int b = 0; b < nblocks; b++)
+          for (size_t i = 0; i < found[b].size (); i++)
+            primpolys(nfound++) = found[b][i];
+      }
+      break;
     default:
       error ("primpoly: impossible");
       break;
@@ -254,7 +293,7 @@ the polynomial forms of the primitives. The return value is not affected.\n\
               bool first = true;
               for (int j = m; j >= 0; j--)
                 {
-                  if ((int)primpolys(i) & (1<<j))
+                  if (((uint64_t)primpolys(i) >> j) & 1)
                     {
                       if (j > 0)
                         {
@@ -297,6 +336,15 @@ the polynomial forms of the primitives. The return value is not affected.\n\
 %!error primpoly (1, "invalid")
 %!error primpoly (1, 2, "invalid")
 %!error primpoly (1, "nodisplay", "invalid")
+
+%!assert (primpoly (3, "all", "nodisplay"), [11 13])
+%!assert (primpoly (8, "nodisplay"), 285)
+%!assert (primpoly (8, "max", "nodisplay"), 501)
+%!assert (numel (primpoly (8, "all", "nodisplay")), 16)
+%!assert (primpoly (4, 3, "nodisplay"), [19 25])
+%!assert (numel (primpoly (16, "all", "nodisplay")), 2048)
+%!assert (primpoly (32, "nodisplay"), 2^32 + 2^7 + 2^5 + 2^3 + 2^2 + 2 + 1)
+%!assert (primpoly (52, 3, "nodisplay"), 2^52 + 2.^[3 19 21 31 33 49] + 1)
 */
 
 /*
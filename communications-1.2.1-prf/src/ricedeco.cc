@@ -0,0 +1,105 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+
+
+#include <octave/oct.h>
+
+#include "golomb.h"
+
+DEFUN_DLD (ricedeco, args, ,
+  "-*- texinfo -*-\n\
+@deftypefn  {Loadable Function} {@var{sig} =} ricedeco (@var{code}, @var{K})\n\
+@deftypefnx {Loadable Function} {@var{sig} =} ricedeco (@var{code}, @var{K}, @var{nbits})\n\
+\n\
+Returns the Rice decoded signal vector using @var{code} and @var{K}.\n\
+Compulsory K is need to be specified.\n\
+A restrictions is that a signal set must strictly be non-negative.\n\
+The value of code is a cell array of row-vectors which have the\n\
+encoded rice value for a single sample. The Rice algorithm is\n\
+used to encode the \"code\" and only that can be meaningfully\n\
+decoded. @var{code} is assumed to have been of format generated\n\
+by the function @code{riceenco}.\n\
+\n\
+@var{code} may also be the stream of the codewords, as a binary vector\n\
+or as a uint8 vector of packed bits of which the first @var{nbits} are\n\
+read, as for @code{golombdeco}.\n\
+\n\
+Reference: Solomon Golomb, Run length Encodings, 1966 IEEE Trans Info Theory\n\
+\n\
+An example of the use of @code{ricedeco} is\n\
+@example\n\
+@group\n\
+ricedeco (riceenco (1:4, 2), 2)\n\
+    @result{} [1 2 3 4]\n\
+@end group\n\
+@end example\n\
+@seealso{riceenco, golombdeco}\n\
+@end deftypefn")
+{
+  octave_value_list retval;
+  int nargin = args.length ();
+
+  if (nargin < 2 || nargin > 3)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  double k = args(1).double_value ();
+  if (! (k >= 0 && k <= 53 && k == std::floor (k)))
+    {
+      error ("ricedeco: K must be an integer from 0 to 53");
+      return retval;
+    }
+
+  RowVector sig;
+  if (! golomb_decode (args(0), (nargin > 2 ? args(2).double_value () : -1),
+                       golomb_code ((uint64_t)1 << (int)k), "ricedeco", sig))
+    return retval;
+
+  retval(0) = octave_value (sig);
+  return retval;
+}
+
+/*
+%!assert (ricedeco (riceenco (1:4, 2), 2), [1:4])
+%!assert (ricedeco (riceenco (0:10, 0), 0), [0:10])
+
+%!test
+%! sig = randi ([0 1000], 1, 200);
+%! [rcode, K, Ltot] = riceenco (sig, [], "packed");
+%! assert (ricedeco (rcode, K, Ltot), sig)
+%! assert (ricedeco (riceenco (sig, K, "dense"), K), sig)
+%! assert (ricedeco (riceenco (sig, 20), 20), sig)
+
+%% Test input validation
+%!error ricedeco ()
+%!error ricedeco (1)
+%!error ricedeco (1, 2)
+%!error ricedeco (1, 2, 3)
+%!error <K must> ricedeco ({[0]}, 0.5)
+*/
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
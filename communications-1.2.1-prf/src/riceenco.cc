@@ -0,0 +1,163 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+
+
+#include <vector>
+
+#include <octave/oct.h>
+
+#include "bitstream.h"
+#include "golomb.h"
+
+DEFUN_DLD (riceenco, args, nargout,
+  "-*- texinfo -*-\n\
+@deftypefn  {Loadable Function} {@var{rcode} =} riceenco (@var{sig})\n\
+@deftypefnx {Loadable Function} {@var{rcode} =} riceenco (@var{sig}, @var{K})\n\
+@deftypefnx {Loadable Function} {@var{rcode} =} riceenco (@var{sig}, @var{K}, @var{format})\n\
+@deftypefnx {Loadable Function} {[@var{rcode}, @var{K}, @var{Ltot}] =} riceenco (@dots{})\n\
+\n\
+Returns the Rice encoded signal using @var{K} or optimal K .\n\
+Default optimal K is chosen between 0-7. Currently no other way\n\
+to increase the range except to specify explicitly. Also returns\n\
+@var{K} parameter used (in case it were to be chosen optimally)\n\
+and @var{Ltot} the total length of output code in bits.\n\
+This function uses a @var{K} if supplied or by default chooses\n\
+the optimal K for encoding signal vector into a rice coded vector.\n\
+A restrictions is that a signal set must strictly be non-negative\n\
+integers. The Rice algorithm is used to encode the data into unary coded\n\
+quotient part which is represented as a set of 1's separated from\n\
+the K-part (binary) using a zero. This scheme doesn't need any\n\
+kind of dictionaries.\n\
+\n\
+The codewords are returned in a cell array, unless @var{format} is\n\
+'dense', 'logical' or 'packed' for a single row vector of their bits,\n\
+as for @code{golombenco}. @var{K} may be empty to choose it optimally.\n\
+\n\
+Reference: Solomon Golomb, Run length Encodings, 1966 IEEE Trans\n\
+Info' Theory\n\
+\n\
+An example of the use of @code{riceenco} is\n\
+@example\n\
+@group\n\
+riceenco (1:4)\n\
+    @result{} @{[0 1], [1 0 0], [1 0 1], [1 1 0 0]@}\n\
+riceenco (1:10, 2)\n\
+    @result{} @{[0 0 1], [0 1 0], [0 1 1], [1 0 0 0],\n\
+        [1 0 0 1], [1 0 1 0], [1 0 1 1], [1 1 0 0 0],\n\
+        [1 1 0 0 1], [1 1 0 1 0]@}\n\
+@end group\n\
+@end example\n\
+@seealso{ricedeco, golombenco}\n\
+@end deftypefn")
+{
+  octave_value_list retval;
+  int nargin = args.length ();
+
+  if (nargin < 1 || nargin > 3)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  bool optimal = (nargin < 2 || args(1).is_empty ());
+  double k = 0;
+  if (! optimal)
+    {
+      k = args(1).double_value ();
+      if (! (k >= 0 && k <= 53 && k == std::floor (k)))
+        {
+          error ("riceenco: K must be an integer from 0 to 53");
+          return retval;
+        }
+    }
+
+  bitstream_format fmt = BITSTREAM_CELL;
+  if (nargin > 2
+      && ! bitstream_get_format (args(2), "riceenco", true, fmt))
+    return retval;
+
+  std::vector<uint64_t> sig;
+  if (! golomb_get_signal (args(0), "riceenco", sig))
+    return retval;
+
+  // The parameter of the shortest code, the first one of equal lengths
+  if (optimal)
+    {
+      double best = 0;
+      for (int kk = 0; kk <= 7; kk++)
+        {
+          golomb_code g ((uint64_t)1 << kk);
+          double len = 0;
+          for (size_t i = 0; i < sig.size (); i++)
+            len += g.length (sig[i]);
+          if (kk == 0 || len < best)
+            {
+              best = len;
+              k = kk;
+            }
+        }
+    }
+
+  golomb_code g ((uint64_t)1 << (int)k);
+  bitstream_writer w (fmt == BITSTREAM_CELL);
+  for (size_t i = 0; i < sig.size (); i++)
+    {
+      if ((i & 0xffff) == 0)
+        OCTAVE_QUIT;
+      g.put (w, sig[i]);
+    }
+
+  retval(0) = w.value (fmt);
+  if (nargout > 1)
+    retval(1) = octave_value (k);
+  if (nargout > 2)
+    retval(2) = octave_value ((double)w.size ());
+
+  return retval;
+}
+
+/*
+%!assert (riceenco (1:4, 2), {[0 0 1], [0 1 0], [0 1 1], [1 0 0 0]})
+%!assert (riceenco (1:4), {[0 1], [1 0 0], [1 0 1], [1 1 0 0]})
+%!assert (riceenco (1:4, 2, "dense"), [0 0 1 0 1 0 0 1 1 1 0 0 0])
+%!assert (riceenco (1:4, 2, "packed"), uint8 ([41 192]))
+
+%!test
+%! [rcode, K, Ltot] = riceenco ([100 200 300]);
+%! assert (K, 7)
+%! assert (Ltot, numel ([rcode{:}]))
+%! [rcode, K, Ltot] = riceenco ([100 200 300], [], "logical");
+%! assert (K, 7)
+%! assert (Ltot, numel (rcode))
+
+%% Test input validation
+%!error riceenco ()
+%!error riceenco (1, 2, 3)
+%!error riceenco (1, 2, 3, 4)
+%!error riceenco (-1)
+%!error <K must> riceenco (1, -1)
+*/
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
@@ -0,0 +1,116 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <octave/oct.h>
+
+DEFUN_DLD (rledeco, args, ,
+  "-*- texinfo -*-\n\
+@deftypefn {Loadable Function} {@var{rmsg} =} rledeco (@var{message})\n\
+\n\
+Returns decoded run-length @var{message}. The RLE encoded @var{message}\n\
+has to be in the form of a row-vector. The message format (encoded RLE)\n\
+is like repetition [factor, value]+.\n\
+\n\
+The length of the decoded message is found from the counts first, so\n\
+that it is written in a single pass.\n\
+\n\
+An example use of @code{rledeco} is\n\
+@example\n\
+@group\n\
+message = [1 5 2 4 3 1];\n\
+rledeco (message)\n\
+    @result{} [5 4 4 1 1 1]\n\
+@end group\n\
+@end example\n\
+@seealso{rleenco}\n\
+@end deftypefn")
+{
+  octave_value_list retval;
+  int nargin = args.length ();
+
+  if (nargin != 1)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  const Matrix msg = args(0).matrix_value ();
+  octave_idx_type n = msg.numel ();
+  if (n % 2)
+    {
+      error ("rledeco: MESSAGE must hold pairs of a count and a value");
+      return retval;
+    }
+
+  double len = 0;
+  for (octave_idx_type i = 0; i < n; i += 2)
+    {
+      double c = msg(i);
+      if (! (c >= 0 && c == std::floor (c)))
+        {
+          error ("rledeco: the counts of MESSAGE must be non-negative "
+                 "integers");
+          return retval;
+        }
+      len += c;
+    }
+  if (len > std::numeric_limits<octave_idx_type>::max () / 8)
+    {
+      error ("rledeco: the decoded message is too long");
+      return retval;
+    }
+
+  RowVector rmsg ((octave_idx_type)len);
+  double *p = rmsg.fortran_vec ();
+  for (octave_idx_type i = 0; i < n; i += 2)
+    {
+      if ((i & 0xffff) == 0)
+        OCTAVE_QUIT;
+      p = std::fill_n (p, (octave_idx_type)msg(i), msg(i+1));
+    }
+
+  retval(0) = octave_value (rmsg);
+  return retval;
+}
+
+/*
+%!assert (rledeco ([1 5 2 4 3 1]), [5 4 4 1 1 1])
+%!assert (rledeco ([0 5 2 4]), [4 4])
+%!assert (rledeco ([]), zeros (1, 0))
+
+%% Test input validation
+%!error rledeco ()
+%!error rledeco (1, 2)
+%!error <pairs> rledeco ([1 2 3])
+%!error <counts> rledeco ([1.5 2])
+%!error <too long> rledeco ([1e20 2])
+%!error <too long> rledeco ([Inf 2])
+*/
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
@@ -0,0 +1,187 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+
+
+#include <vector>
+
+#include <octave/oct.h>
+
+DEFUN_DLD (rleenco, args, ,
+  "-*- texinfo -*-\n\
+@deftypefn  {Loadable Function} {@var{rmsg} =} rleenco (@var{message})\n\
+@deftypefnx {Loadable Function} {[@var{rmsg}, @var{run}] =} rleenco (@var{message}, @var{run})\n\
+@deftypefnx {Loadable Function} {@var{rmsg} =} rleenco (@var{message}, @var{run}, \"flush\")\n\
+\n\
+Returns run-length encoded @var{message}. The RLE form is built from\n\
+@var{message}. The original @var{message} has to be in the form of a\n\
+row-vector. The encoded @var{message} format (encoded RLE) is like\n\
+[repetition factor]+, values.\n\
+\n\
+A message may also be encoded in pieces, by passing the run @var{run}\n\
+carried from the previous piece, or an empty matrix for the first one.\n\
+The last run of @var{message}, which may continue with the next piece,\n\
+is then not written to @var{rmsg} but returned in @var{run} as a pair\n\
+@code{[count, value]}, or as an empty matrix if @var{message} and\n\
+@var{run} are empty. With \"flush\", @var{message} is the last piece,\n\
+and its last run is written to @var{rmsg}. The pieces may also be ended\n\
+by appending @var{run} to the code.\n\
+\n\
+An example use of @code{rleenco} is\n\
+@example\n\
+@group\n\
+message = [5 4 4 1 1 1]\n\
+rleenco (message)\n\
+    @result{} [1 5 2 4 3 1];\n\
+[r1, run] = rleenco ([5 4 4 1], [])\n\
+    @result{} r1 = [1 5 2 4], run = [1 1]\n\
+rleenco ([1 1], run, \"flush\")\n\
+    @result{} [3 1]\n\
+@end group\n\
+@end example\n\
+@seealso{rledeco}\n\
+@end deftypefn")
+{
+  octave_value_list retval;
+  int nargin = args.length ();
+
+  if (nargin < 1 || nargin > 3)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  // The last run is held back when encoding in pieces, until the flush
+  bool hold = (nargin == 2);
+  if (nargin > 2
+      && ! (args(2).is_string () && args(2).string_value () == "flush"))
+    {
+      error ("rleenco: the third argument must be \"flush\"");
+      return retval;
+    }
+
+  const Matrix msg = args(0).matrix_value ();
+  octave_idx_type n = msg.numel ();
+
+  // The run being counted, continued from the last piece
+  double count = 0;
+  double val = 0;
+  if (nargin > 1 && ! args(1).is_empty ())
+    {
+      const Matrix run = args(1).matrix_value ();
+      if (! (run.numel () == 2 && run(0) >= 1 && run(0) == std::floor (run(0))))
+        {
+          error ("rleenco: RUN must be a pair of a positive count and a value");
+          return retval;
+        }
+      count = run(0);
+      val = run(1);
+    }
+
+  std::vector<double> r;
+  for (octave_idx_type i = 0; i < n; i++)
+    {
+      if ((i & 0xffff) == 0)
+        OCTAVE_QUIT;
+
+      if (count > 0 && msg(i) == val)
+        count++;
+      else
+        {
+          if (count > 0)
+            {
+              r.push_back (count);
+              r.push_back (val);
+            }
+          count = 1;
+          val = msg(i);
+        }
+    }
+
+  if (! hold && count > 0)
+    {
+      r.push_back (count);
+      r.push_back (val);
+    }
+
+  RowVector rmsg (r.size ());
+  for (size_t i = 0; i < r.size (); i++)
+    rmsg(i) = r[i];
+  retval(0) = octave_value (rmsg);
+
+  if (hold && count > 0)
+    {
+      RowVector run (2);
+      run(0) = count;
+      run(1) = val;
+      retval(1) = octave_value (run);
+    }
+  else
+    retval(1) = octave_value (Matrix ());
+
+  return retval;
+}
+
+/*
+%!assert (rleenco ([5 4 4 1 1 1]), [1 5 2 4 3 1])
+%!assert (rleenco ([5 4 4 1 1 1]'), [1 5 2 4 3 1])
+%!assert (rleenco ([]), zeros (1, 0))
+%!assert (rleenco ([NaN NaN]), [1 NaN 1 NaN])
+
+%!test
+%! [r1, run] = rleenco ([5 4 4 1], []);
+%! assert (r1, [1 5 2 4])
+%! assert (run, [1 1])
+%! [r2, run] = rleenco ([1 1 1], run);
+%! assert (r2, zeros (1, 0))
+%! assert (run, [4 1])
+%! assert (rleenco ([1 2], run, "flush"), [5 1 1 2])
+%! [r3, run] = rleenco ([], []);
+%! assert (r3, zeros (1, 0))
+%! assert (run, [])
+
+%!test
+%! ## The second output does not change the encoding of a whole message
+%! [r, run] = rleenco ([5 4 4 1]);
+%! assert (r, [1 5 2 4 1 1])
+%! assert (run, [])
+
+%!test
+%! msg = randi (3, 1, 1000);
+%! [r1, run1] = rleenco (msg(1:500), []);
+%! [r2, run2] = rleenco (msg(501:700), run1);
+%! r3 = rleenco (msg(701:end), run2, "flush");
+%! assert ([r1 r2 r3], rleenco (msg))
+%! [r2, run2] = rleenco (msg(501:end), run1);
+%! assert (rledeco ([r1 r2 run2]), msg)
+
+%% Test input validation
+%!error rleenco ()
+%!error rleenco (1, 2, 3, 4)
+%!error <flush> rleenco (1, [], "foo")
+%!error <RUN> rleenco (1, 2)
+%!error <RUN> rleenco (1, [0 1])
+*/
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
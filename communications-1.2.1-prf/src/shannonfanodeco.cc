@@ -0,0 +1,129 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+
+
+#include <vector>
+
+#include <octave/oct.h>
+
+#include "bitstream.h"
+#include "huffman.h"
+
+DEFUN_DLD (shannonfanodeco, args, ,
+  "-*- texinfo -*-\n\
+@deftypefn  {Loadable Function} {@var{sig} =} shannonfanodeco (@var{hcode}, @var{dict})\n\
+@deftypefnx {Loadable Function} {@var{sig} =} shannonfanodeco (@var{hcode}, @var{dict}, @var{nbits})\n\
+\n\
+Returns the original signal that was Shannon-Fano encoded. The signal\n\
+was encoded using @code{shannonfanoenco}. This function uses\n\
+a dict built from the @code{shannonfanodict} and uses it to decode a signal\n\
+list into a Shannon-Fano list. Restrictions include hcode is expected to be a binary code;\n\
+returned signal set that strictly belongs in the @code{range [1,N]},\n\
+with @code{N = length (dict)}. Also dict can only be from the\n\
+@code{shannonfanodict (...)} routine. Whenever decoding fails,\n\
+those signal values are indicated by -1, and we successively\n\
+try to restart decoding from the next bit that hasn't failed in\n\
+decoding, ad-infinitum.\n\
+\n\
+@var{hcode} may also be a uint8 vector of packed bits, the first bit of\n\
+the stream being the most significant bit of its first element, as\n\
+written by @code{shannonfanoenco}. The stream is then the first\n\
+@var{nbits} bits, by default all of them.\n\
+\n\
+The codewords are looked up in the tables of @code{huffmandeco},\n\
+indexed by 10 bits of the stream at a time.\n\
+\n\
+An example use of @code{shannonfanodeco} is\n\
+@example\n\
+@group\n\
+hd = shannonfanodict (1:4, [0.5 0.25 0.15 0.10]);\n\
+hcode = shannonfanoenco (1:4, hd)\n\
+    @result{} hcode = [0 1 0 1 1 0 1 1 1 0]\n\
+shannonfanodeco (hcode, hd)\n\
+    @result{} [1 2 3 4]\n\
+@end group\n\
+@end example\n\
+@seealso{shannonfanoenco, shannonfanodict}\n\
+@end deftypefn")
+{
+  octave_value_list retval;
+  int nargin = args.length ();
+
+  if (nargin < 2 || nargin > 3)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  // The stream in words of 64 bits, with two zero words after it
+  std::vector<uint64_t> a;
+  uint64_t nbits;
+
+  if (! bitstream_load (args(0), (nargin > 2 ? args(2).double_value () : -1),
+                        "shannonfanodeco", "HCODE", a, nbits))
+    return retval;
+
+  huffman_code c;
+  if (! get_huffman_dict (args(1), "shannonfanodeco", c))
+    return retval;
+
+  huffman_decoder dec;
+  if (! dec.build (c))
+    {
+      error ("shannonfanodeco: DICT must be a prefix-free code");
+      return retval;
+    }
+
+  // At most one symbol for each bit, those not decoded included
+  RowVector sig (nbits);
+  uint64_t pos = 0;
+  octave_idx_type n = dec.decode (&a[0], pos, nbits, sig.fortran_vec (),
+                                  true);
+
+  sig.resize (n);
+  retval(0) = octave_value (sig);
+  return retval;
+}
+
+/*
+%!assert (shannonfanodeco (shannonfanoenco (1:4, shannonfanodict (1:4, [0.5 0.25 0.15 0.10])), shannonfanodict (1:4, [0.5 0.25 0.15 0.10])), [1:4], 0)
+
+%!test
+%! dict = shannonfanodict (1:4, [0.5 0.25 0.15 0.10]);
+%! assert (shannonfanodeco ([1 1 1 1 0 1 1 1], dict), [-1 4 -1 -1 -1])
+%! assert (shannonfanodeco ([1 1 1 1 1 1 0 0], dict), [-1 -1 -1 4 1])
+%! sig = randi (4, 1, 1000);
+%! [hcode, nbits] = shannonfanoenco (sig, dict, "packed");
+%! assert (shannonfanodeco (hcode, dict, nbits), sig)
+
+%% Test input validation
+%!error shannonfanodeco ()
+%!error shannonfanodeco (1)
+%!error shannonfanodeco (1, 2, 3)
+%!error shannonfanodeco (1, 2)
+%!error shannonfanodeco (2, {})
+*/
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
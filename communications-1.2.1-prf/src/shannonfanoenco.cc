@@ -0,0 +1,106 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+
+
+#include <octave/oct.h>
+
+#include "bitstream.h"
+#include "huffman.h"
+
+DEFUN_DLD (shannonfanoenco, args, nargout,
+  "-*- texinfo -*-\n\
+@deftypefn  {Loadable Function} {@var{sf_code} =} shannonfanoenco (@var{sig}, @var{dict})\n\
+@deftypefnx {Loadable Function} {@var{sf_code} =} shannonfanoenco (@var{sig}, @var{dict}, @var{format})\n\
+@deftypefnx {Loadable Function} {[@var{sf_code}, @var{nbits}] =} shannonfanoenco (@dots{})\n\
+\n\
+Returns the Shannon-Fano encoded signal using @var{dict}.\n\
+This function uses a @var{dict} built from the @code{shannonfanodict}\n\
+and uses it to encode a signal list into a Shannon-Fano code.\n\
+Restrictions include a signal set that strictly belongs in the\n\
+@code{range [1,N]} with @code{N = length (dict)}. Also dict can only be\n\
+from the @code{shannonfanodict} routine.\n\
+\n\
+The code is returned as a row vector of doubles, unless @var{format} is\n\
+'logical', or is 'packed' for a uint8 row vector of eight bits per\n\
+element, as for @code{huffmanenco}. @var{format} may also be 'dense'\n\
+for the default. The optional output @var{nbits} is the number of bits\n\
+of the code, for @code{shannonfanodeco}.\n\
+\n\
+An example use of @code{shannonfanoenco} is\n\
+\n\
+@example\n\
+@group\n\
+hd = shannonfanodict (1:4, [0.5 0.25 0.15 0.10]);\n\
+shannonfanoenco (1:4, hd)\n\
+    @result{} [0 1 0 1 1 0 1 1 1 0]\n\
+@end group\n\
+@end example\n\
+@seealso{shannonfanodeco, shannonfanodict}\n\
+@end deftypefn")
+{
+  octave_value_list retval;
+  int nargin = args.length ();
+
+  if (nargin < 2 || nargin > 3)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  bitstream_format fmt = BITSTREAM_DENSE;
+  if (nargin > 2
+      && ! bitstream_get_format (args(2), "shannonfanoenco", false, fmt))
+    return retval;
+
+  huffman_code c;
+  if (! get_huffman_dict (args(1), "shannonfanoenco", c))
+    return retval;
+
+  bitstream_writer w;
+  if (! huffman_encode (args(0), c, "shannonfanoenco", w))
+    return retval;
+
+  retval(0) = w.value (fmt);
+  if (nargout > 1)
+    retval(1) = octave_value ((double)w.size ());
+
+  return retval;
+}
+
+/*
+%!assert (shannonfanoenco (1:4, shannonfanodict (1:4, [0.5 0.25 0.15 0.10])), [0 1 0 1 1 0 1 1 1 0], 0)
+%!assert (shannonfanoenco (1:4, shannonfanodict (1:4, [0.5 0.25 0.15 0.10]), "logical"), logical ([0 1 0 1 1 0 1 1 1 0]))
+%!assert (shannonfanoenco (1:4, shannonfanodict (1:4, [0.5 0.25 0.15 0.10]), "packed"), uint8 ([91 128]))
+
+%% Test input validation
+%!error shannonfanoenco ()
+%!error shannonfanoenco (1)
+%!error shannonfanoenco (1, 2, 3)
+%!error shannonfanoenco (1, {})
+%!error <range> shannonfanoenco (5, shannonfanodict (1:4, [0.5 0.25 0.15 0.10]))
+%!error <no codeword> shannonfanoenco (3, shannonfanodict (1:3, [0.5 0.5 0]))
+*/
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
@@ -0,0 +1,850 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+#include <algorithm>
+#include <vector>
+
+#include <octave/oct.h>
+#include <octave/gripes.h>
+
+#include "galois.h"
+#include "galois-def.h"
+#include "sparse-galois.h"
+
+// sparse galois class
+
+sparse_galois::sparse_galois (octave_idx_type _nr, octave_idx_type _nc,
+                              const int& _m, const int& _primpoly)
+  : nr (_nr), nc (_nc), c_idx (_nc + 1, 0), field (NULL)
+{
+  field = stored_galois_fields.create_galois_field (_m, _primpoly);
+}
+
+sparse_galois::sparse_galois (const SparseMatrix& a, const int& _m,
+                              const int& _primpoly)
+  : nr (a.rows ()), nc (0), c_idx (1, 0), field (NULL)
+{
+  int _n = (1<<_m) - 1;
+
+  r_idx.reserve (a.nnz ());
+  xdata.reserve (a.nnz ());
+
+  // Check the validity of the data in the matrix, and drop any zeros
+  // stored explicitly
+  for (octave_idx_type j = 0; j < a.cols (); j++)
+    {
+      for (octave_idx_type k = a.cidx (j); k < a.cidx (j+1); k++)
+        {
+          double d = a.data (k);
+          if ((d < 0) || (d > _n))
+            {
+              gripe_range_galois (_m);
+              clear ();
+              return;
+            }
+          if ((d - (double)((int)d)) != 0.)
+            {
+              gripe_integer_galois ();
+              clear ();
+              return;
+            }
+          if (d != 0)
+            append (a.ridx (k), (int)d);
+        }
+      end_column ();
+    }
+
+  field = stored_galois_fields.create_galois_field (_m, _primpoly);
+}
+
+sparse_galois::sparse_galois (const galois& a)
+  : nr (a.rows ()), nc (0), c_idx (1, 0), field (NULL)
+{
+  if (!a.have_field ())
+    {
+      gripe_copy_invalid_galois ();
+      nr = 0;
+      return;
+    }
+
+  for (octave_idx_type j = 0; j < a.cols (); j++)
+    {
+      for (octave_idx_type i = 0; i < nr; i++)
+        if (a(i, j) != 0)
+          append (i, a(i, j));
+      end_column ();
+    }
+
+  field = stored_galois_fields.create_galois_field (a.m (), a.primpoly ());
+}
+
+sparse_galois::sparse_galois (const sparse_galois& a)
+  : nr (a.nr), nc (a.nc), c_idx (a.c_idx), r_idx (a.r_idx),
+    xdata (a.xdata), field (NULL)
+{
+  if (!a.have_field ())
+    {
+      gripe_copy_invalid_galois ();
+      clear ();
+      return;
+    }
+
+  // This call to create_galois_field will just increment the usage counter
+  field = stored_galois_fields.create_galois_field (a.m (), a.primpoly ());
+}
+
+void
+sparse_galois::clear (void)
+{
+  nr = 0;
+  nc = 0;
+  c_idx.assign (1, 0);
+  r_idx.clear ();
+  xdata.clear ();
+}
+
+sparse_galois::~sparse_galois (void)
+{
+  stored_galois_fields.delete_galois_field (field);
+  field = NULL;
+}
+
+sparse_galois&
+sparse_galois::operator = (const sparse_galois& t)
+{
+  if (this == &t)
+    return *this;
+
+  if (have_field ())
+    stored_galois_fields.delete_galois_field (field);
+  field = NULL;
+
+  if (!t.have_field ())
+    {
+      gripe_copy_invalid_galois ();
+      return *this;
+    }
+
+  field = stored_galois_fields.create_galois_field (t.m (), t.primpoly ());
+
+  // Copy the data
+  nr = t.nr;
+  nc = t.nc;
+  c_idx = t.c_idx;
+  r_idx = t.r_idx;
+  xdata = t.xdata;
+
+  return *this;
+}
+
+galois
+sparse_galois::full (void) const
+{
+  if (!have_field ())
+    {
+      gripe_invalid_galois ();
+      return galois ();
+    }
+
+  galois retval (nr, nc, 0, m (), primpoly ());
+  for (octave_idx_type j = 0; j < nc; j++)
+    for (octave_idx_type k = c_idx[j]; k < c_idx[j+1]; k++)
+      retval(r_idx[k], j) = xdata[k];
+
+  return retval;
+}
+
+SparseMatrix
+sparse_galois::sparse_matrix_value (void) const
+{
+  SparseMatrix retval (nr, nc, nnz ());
+
+  for (octave_idx_type j = 0; j <= nc; j++)
+    retval.xcidx (j) = c_idx[j];
+  for (octave_idx_type k = 0; k < nnz (); k++)
+    {
+      retval.xridx (k) = r_idx[k];
+      retval.xdata (k) = xdata[k];
+    }
+
+  return retval;
+}
+
+sparse_galois
+sparse_galois::transpose (void) const
+{
+  if (!have_field ())
+    {
+      gripe_invalid_galois ();
+      return sparse_galois ();
+    }
+
+  sparse_galois retval (nc, nr, m (), primpoly ());
+  octave_idx_type nz = nnz ();
+
+  // Count the elements of each row, then place them column by column,
+  // which leaves the rows of the transpose in increasing order
+  std::vector<octave_idx_type>& t_cidx = retval.c_idx;
+  for (octave_idx_type k = 0; k < nz; k++)
+    t_cidx[r_idx[k] + 1]++;
+  for (octave_idx_type i = 0; i < nr; i++)
+    t_cidx[i+1] += t_cidx[i];
+
+  retval.r_idx.resize (nz);
+  retval.xdata.resize (nz);
+  std::vector<octave_idx_type> pos (t_cidx.begin (), t_cidx.end () - 1);
+  for (octave_idx_type j = 0; j < nc; j++)
+    for (octave_idx_type k = c_idx[j]; k < c_idx[j+1]; k++)
+      {
+        octave_idx_type p = pos[r_idx[k]]++;
+        retval.r_idx[p] = j;
+        retval.xdata[p] = xdata[k];
+      }
+
+  return retval;
+}
+
+sparse_galois&
+sparse_galois::insert (const sparse_galois& a, octave_idx_type r,
+                       octave_idx_type c)
+{
+  if (!have_field () || !a.have_field ())
+    {
+      gripe_invalid_galois ();
+      return *this;
+    }
+  if ((m () != a.m ()) || (primpoly () != a.primpoly ()))
+    {
+      (*current_liboctave_error_handler) ("inserted galois variable must "
+                                          "be in the same field");
+      return *this;
+    }
+  if (r < 0 || r + a.nr > nr || c < 0 || c + a.nc > nc)
+    {
+      (*current_liboctave_error_handler) ("range error for insert");
+      return *this;
+    }
+
+  // The columns from c on keep their elements above row r and from row
+  // r + a.nr on, with those of a in between
+  std::vector<octave_idx_type> t_cidx (1, 0);
+  std::vector<octave_idx_type> t_ridx;
+  std::vector<int> t_data;
+  t_cidx.reserve (nc + 1);
+  t_ridx.reserve (nnz () + a.nnz ());
+  t_data.reserve (nnz () + a.nnz ());
+
+  for (octave_idx_type j = 0; j < nc; j++)
+    {
+      octave_idx_type k = c_idx[j];
+      if (j >= c && j < c + a.nc)
+        {
+          for (; k < c_idx[j+1] && r_idx[k] < r; k++)
+            {
+              t_ridx.push_back (r_idx[k]);
+              t_data.push_back (xdata[k]);
+            }
+          for (octave_idx_type ka = a.c_idx[j-c]; ka < a.c_idx[j-c+1]; ka++)
+            {
+              t_ridx.push_back (a.r_idx[ka] + r);
+              t_data.push_back (a.xdata[ka]);
+            }
+          while (k < c_idx[j+1] && r_idx[k] < r + a.nr)
+            k++;
+        }
+      for (; k < c_idx[j+1]; k++)
+        {
+          t_ridx.push_back (r_idx[k]);
+          t_data.push_back (xdata[k]);
+        }
+      t_cidx.push_back (t_ridx.size ());
+    }
+
+  c_idx.swap (t_cidx);
+  r_idx.swap (t_ridx);
+  xdata.swap (t_data);
+
+  return *this;
+}
+
+sparse_galois
+sparse_galois::concat (const sparse_galois& rb,
+                       const Array<octave_idx_type>& ra_idx)
+{
+  if (rb.rows () > 0 && rb.cols () > 0)
+    insert (rb, ra_idx(0), ra_idx(1));
+  return *this;
+}
+
+// The sparse vector a + f * b, where a and b have their rows in
+// increasing order
+static void
+sparse_axpy (const sparse_galois& g, std::vector<octave_idx_type>& ar,
+             std::vector<int>& ad, int f,
+             const std::vector<octave_idx_type>& br,
+             const std::vector<int>& bd)
+{
+  std::vector<octave_idx_type> rr;
+  std::vector<int> rd;
+  rr.reserve (ar.size () + br.size ());
+  rd.reserve (ar.size () + br.size ());
+
+  size_t i = 0, j = 0;
+  while (i < ar.size () || j < br.size ())
+    {
+      if (j == br.size () || (i < ar.size () && ar[i] < br[j]))
+        {
+          rr.push_back (ar[i]);
+          rd.push_back (ad[i++]);
+        }
+      else
+        {
+          octave_idx_type r = br[j];
+          int d = g.multiply (f, bd[j++]);
+          if (i < ar.size () && ar[i] == r)
+            d ^= ad[i++];
+          if (d != 0)
+            {
+              rr.push_back (r);
+              rd.push_back (d);
+            }
+        }
+    }
+
+  ar.swap (rr);
+  ad.swap (rd);
+}
+
+int
+sparse_galois::rank (void) const
+{
+  if (!have_field ())
+    {
+      gripe_invalid_galois ();
+      return 0;
+    }
+
+  // The rows of a wide matrix, such as a parity check matrix, are fewer
+  // and fill in far less than its columns
+  if (nr < nc)
+    return transpose ().rank ();
+
+  // Each column is reduced by the earlier reduced columns until its last
+  // non-zero row is not the last one of any of them. The reduced columns
+  // that remain non-zero are independent, and span the columns. Working
+  // on the last row keeps the columns of a banded or staircase matrix,
+  // such as the parity part of most LDPC codes, from filling in
+  std::vector<std::vector<octave_idx_type> > basis_r;
+  std::vector<std::vector<int> > basis_d;
+  std::vector<octave_idx_type> owner (nr, -1);
+
+  for (octave_idx_type j = 0; j < nc; j++)
+    {
+      OCTAVE_QUIT;
+
+      std::vector<octave_idx_type> cr (r_idx.begin () + c_idx[j],
+                                       r_idx.begin () + c_idx[j+1]);
+      std::vector<int> cd (xdata.begin () + c_idx[j],
+                           xdata.begin () + c_idx[j+1]);
+
+      while (! cr.empty ())
+        {
+          octave_idx_type low = cr.back ();
+          octave_idx_type o = owner[low];
+          if (o < 0)
+            {
+              owner[low] = basis_r.size ();
+              basis_r.push_back (cr);
+              basis_d.push_back (cd);
+              break;
+            }
+          int f = divide (cd.back (), basis_d[o].back ());
+          sparse_axpy (*this, cr, cd, f, basis_r[o], basis_d[o]);
+        }
+    }
+
+  return basis_r.size ();
+}
+
+sparse_galois
+sparse_galois::rref (std::vector<octave_idx_type>& piv) const
+{
+  piv.clear ();
+
+  if (!have_field ())
+    {
+      gripe_invalid_galois ();
+      return sparse_galois ();
+    }
+
+  // The rows are the columns of the transpose. Each is reduced by the
+  // earlier pivot rows until its first non-zero column is not the pivot
+  // column of any of them, and is then scaled so that its pivot is one
+  sparse_galois t = transpose ();
+  std::vector<std::vector<octave_idx_type> > basis_c;
+  std::vector<std::vector<int> > basis_d;
+  std::vector<octave_idx_type> owner (nc, -1);
+
+  for (octave_idx_type i = 0; i < nr; i++)
+    {
+      OCTAVE_QUIT;
+
+      std::vector<octave_idx_type> rc (t.r_idx.begin () + t.c_idx[i],
+                                       t.r_idx.begin () + t.c_idx[i+1]);
+      std::vector<int> rd (t.xdata.begin () + t.c_idx[i],
+                           t.xdata.begin () + t.c_idx[i+1]);
+
+      while (! rc.empty ())
+        {
+          octave_idx_type o = owner[rc.front ()];
+          if (o < 0)
+            {
+              int f = divide (1, rd.front ());
+              for (size_t k = 0; k < rd.size (); k++)
+                rd[k] = multiply (f, rd[k]);
+              owner[rc.front ()] = basis_c.size ();
+              basis_c.push_back (rc);
+              basis_d.push_back (rd);
+              break;
+            }
+          sparse_axpy (*this, rc, rd, rd.front (), basis_c[o], basis_d[o]);
+        }
+    }
+
+  for (octave_idx_type j = 0; j < nc; j++)
+    if (owner[j] >= 0)
+      piv.push_back (j);
+
+  // The pivot rows are then cleared above the later pivots, from the
+  // last one back, so that the rows subtracted are already reduced and
+  // only add elements in the columns without a pivot
+  for (octave_idx_type l = (octave_idx_type)piv.size () - 1; l >= 0; l--)
+    {
+      OCTAVE_QUIT;
+
+      std::vector<octave_idx_type>& rc = basis_c[owner[piv[l]]];
+      std::vector<int>& rd = basis_d[owner[piv[l]]];
+      size_t p = 1;
+      while (p < rc.size ())
+        {
+          octave_idx_type o = owner[rc[p]];
+          if (o < 0)
+            p++;
+          else
+            sparse_axpy (*this, rc, rd, rd[p], basis_c[o], basis_d[o]);
+        }
+    }
+
+  // The pivot rows in the order of their pivots, and then the zero rows
+  sparse_galois retval (nc, 0, m (), primpoly ());
+  for (size_t l = 0; l < piv.size (); l++)
+    {
+      octave_idx_type o = owner[piv[l]];
+      for (size_t k = 0; k < basis_c[o].size (); k++)
+        retval.append (basis_c[o][k], basis_d[o][k]);
+      retval.end_column ();
+    }
+  for (octave_idx_type i = piv.size (); i < nr; i++)
+    retval.end_column ();
+
+  return retval.transpose ();
+}
+
+// Add or subtract two sparse Galois arrays, which are the same thing
+static sparse_galois
+sparse_add (const char *op, const sparse_galois& a, const sparse_galois& b)
+{
+  if (!a.have_field () || !b.have_field ())
+    {
+      gripe_invalid_galois ();
+      return sparse_galois ();
+    }
+  if ((a.m () != b.m ()) || (a.primpoly () != b.primpoly ()))
+    {
+      gripe_nonconformant_galois (op, a.m (), a.primpoly (), b.m (),
+                                  b.primpoly ());
+      return sparse_galois ();
+    }
+  if ((a.rows () != b.rows ()) || (a.cols () != b.cols ()))
+    {
+      gripe_nonconformant (op, a.rows (), a.cols (), b.rows (), b.cols ());
+      return sparse_galois ();
+    }
+
+  sparse_galois retval (a.rows (), 0, a.m (), a.primpoly ());
+  for (octave_idx_type j = 0; j < a.cols (); j++)
+    {
+      octave_idx_type ka = a.cidx (j);
+      octave_idx_type kb = b.cidx (j);
+      while (ka < a.cidx (j+1) || kb < b.cidx (j+1))
+        {
+          if (kb == b.cidx (j+1)
+              || (ka < a.cidx (j+1) && a.ridx (ka) < b.ridx (kb)))
+            {
+              retval.append (a.ridx (ka), a.data (ka));
+              ka++;
+            }
+          else if (ka == a.cidx (j+1) || b.ridx (kb) < a.ridx (ka))
+            {
+              retval.append (b.ridx (kb), b.data (kb));
+              kb++;
+            }
+          else
+            {
+              int d = a.data (ka) ^ b.data (kb);
+              if (d != 0)
+                retval.append (a.ridx (ka), d);
+              ka++;
+              kb++;
+            }
+        }
+      retval.end_column ();
+    }
+
+  return retval;
+}
+
+sparse_galois
+operator + (const sparse_galois& a, const sparse_galois& b)
+{
+  return sparse_add ("operator +", a, b);
+}
+
+sparse_galois
+operator - (const sparse_galois& a, const sparse_galois& b)
+{
+  return sparse_add ("operator -", a, b);
+}
+
+sparse_galois
+operator * (const sparse_galois& a, const sparse_galois& b)
+{
+  if (!a.have_field () || !b.have_field ())
+    {
+      gripe_invalid_galois ();
+      return sparse_galois ();
+    }
+  if ((a.m () != b.m ()) || (a.primpoly () != b.primpoly ()))
+    {
+      gripe_differ_galois ();
+      return sparse_galois ();
+    }
+
+  octave_idx_type a_nr = a.rows ();
+  octave_idx_type a_nc = a.cols ();
+  octave_idx_type b_nr = b.rows ();
+  octave_idx_type b_nc = b.cols ();
+
+  if (a_nc != b_nr)
+    {
+      gripe_nonconformant ("operator *", a_nr, a_nc, b_nr, b_nc);
+      return sparse_galois ();
+    }
+
+  // Column j of the product is accumulated in acc, as the sum of the
+  // columns of a picked out by column j of b. The rows touched are
+  // listed in rows, and marked with the column in mark
+  sparse_galois retval (a_nr, 0, a.m (), a.primpoly ());
+  std::vector<int> acc (a_nr, 0);
+  std::vector<octave_idx_type> mark (a_nr, -1);
+  std::vector<octave_idx_type> rows;
+
+  for (octave_idx_type j = 0; j < b_nc; j++)
+    {
+      OCTAVE_QUIT;
+
+      rows.clear ();
+      for (octave_idx_type kb = b.cidx (j); kb < b.cidx (j+1); kb++)
+        {
+          octave_idx_type l = b.ridx (kb);
+          int f = b.data (kb);
+          for (octave_idx_type ka = a.cidx (l); ka < a.cidx (l+1); ka++)
+            {
+              octave_idx_type i = a.ridx (ka);
+              if (mark[i] != j)
+                {
+                  mark[i] = j;
+                  acc[i] = 0;
+                  rows.push_back (i);
+                }
+              acc[i] ^= a.multiply (a.data (ka), f);
+            }
+        }
+
+      std::sort (rows.begin (), rows.end ());
+      for (size_t k = 0; k < rows.size (); k++)
+        if (acc[rows[k]] != 0)
+          retval.append (rows[k], acc[rows[k]]);
+      retval.end_column ();
+    }
+
+  return retval;
+}
+
+galois
+operator * (const sparse_galois& a, const galois& b)
+{
+  if (!a.have_field () || !b.have_field ())
+    {
+      gripe_invalid_galois ();
+      return galois ();
+    }
+  if ((a.m () != b.m ()) || (a.primpoly () != b.primpoly ()))
+    {
+      gripe_differ_galois ();
+      return galois ();
+    }
+
+  octave_idx_type a_nr = a.rows ();
+  octave_idx_type a_nc = a.cols ();
+  octave_idx_type b_nr = b.rows ();
+  octave_idx_type b_nc = b.cols ();
+
+  if (b_nr == 1 && b_nc == 1)
+    {
+      // Scaling by a scalar keeps the product sparse, but is returned full
+      // as are the other products with a full array
+      galois retval (a_nr, a_nc, 0, a.m (), a.primpoly ());
+      for (octave_idx_type j = 0; j < a_nc; j++)
+        for (octave_idx_type k = a.cidx (j); k < a.cidx (j+1); k++)
+          retval(a.ridx (k), j) = a.multiply (a.data (k), b(0, 0));
+      return retval;
+    }
+  else if (a_nc != b_nr)
+    {
+      gripe_nonconformant ("operator *", a_nr, a_nc, b_nr, b_nc);
+      return galois ();
+    }
+
+  galois retval (a_nr, b_nc, 0, a.m (), a.primpoly ());
+  for (octave_idx_type i = 0; i < b_nc; i++)
+    {
+      OCTAVE_QUIT;
+
+      for (octave_idx_type j = 0; j < b_nr; j++)
+        {
+          int f = b(j, i);
+          if (f == 0)
+            continue;
+          for (octave_idx_type k = a.cidx (j); k < a.cidx (j+1); k++)
+            retval(a.ridx (k), i) ^= a.multiply (a.data (k), f);
+        }
+    }
+
+  return retval;
+}
+
+galois
+operator * (const galois& a, const sparse_galois& b)
+{
+  if (!a.have_field () || !b.have_field ())
+    {
+      gripe_invalid_galois ();
+      return galois ();
+    }
+  if ((a.m () != b.m ()) || (a.primpoly () != b.primpoly ()))
+    {
+      gripe_differ_galois ();
+      return galois ();
+    }
+
+  octave_idx_type a_nr = a.rows ();
+  octave_idx_type a_nc = a.cols ();
+  octave_idx_type b_nr = b.rows ();
+  octave_idx_type b_nc = b.cols ();
+
+  if (a_nr == 1 && a_nc == 1)
+    {
+      galois retval (b_nr, b_nc, 0, b.m (), b.primpoly ());
+      for (octave_idx_type j = 0; j < b_nc; j++)
+        for (octave_idx_type k = b.cidx (j); k < b.cidx (j+1); k++)
+          retval(b.ridx (k), j) = b.multiply (a(0, 0), b.data (k));
+      return retval;
+    }
+  else if (a_nc != b_nr)
+    {
+      gripe_nonconformant ("operator *", a_nr, a_nc, b_nr, b_nc);
+      return galois ();
+    }
+
+  // Column j of the product is the sum of the columns of a picked out by
+  // column j of b, which are read in order
+  galois retval (a_nr, b_nc, 0, a.m (), a.primpoly ());
+  for (octave_idx_type j = 0; j < b_nc; j++)
+    {
+      OCTAVE_QUIT;
+
+      for (octave_idx_type k = b.cidx (j); k < b.cidx (j+1); k++)
+        {
+          octave_idx_type l = b.ridx (k);
+          int f = b.data (k);
+          for (octave_idx_type i = 0; i < a_nr; i++)
+            if (a(i, l) != 0)
+              retval(i, j) ^= b.multiply (a(i, l), f);
+        }
+    }
+
+  return retval;
+}
+
+// The field and the dimensions of the operands of the element by element
+// operations, a scalar going with any array
+template <class M1, class M2>
+static bool
+check_elem_args (const char *op, const M1& a, const M2& b)
+{
+  if (!a.have_field () || !b.have_field ())
+    {
+      gripe_invalid_galois ();
+      return false;
+    }
+  if ((a.m () != b.m ()) || (a.primpoly () != b.primpoly ()))
+    {
+      gripe_nonconformant_galois (op, a.m (), a.primpoly (), b.m (),
+                                  b.primpoly ());
+      return false;
+    }
+  if ((a.rows () != b.rows () || a.cols () != b.cols ())
+      && (a.rows () != 1 || a.cols () != 1)
+      && (b.rows () != 1 || b.cols () != 1))
+    {
+      gripe_nonconformant (op, a.rows (), a.cols (), b.rows (), b.cols ());
+      return false;
+    }
+
+  return true;
+}
+
+// The sparse array a with its elements multiplied by f
+static sparse_galois
+sparse_scale (const sparse_galois& a, int f)
+{
+  sparse_galois retval (a.rows (), 0, a.m (), a.primpoly ());
+  for (octave_idx_type j = 0; j < a.cols (); j++)
+    {
+      if (f != 0)
+        for (octave_idx_type k = a.cidx (j); k < a.cidx (j+1); k++)
+          retval.append (a.ridx (k), a.multiply (a.data (k), f));
+      retval.end_column ();
+    }
+
+  return retval;
+}
+
+static int
+sparse_scalar (const sparse_galois& a)
+{
+  return (a.nnz () > 0 ? a.data (0) : 0);
+}
+
+sparse_galois
+product (const sparse_galois& a, const sparse_galois& b)
+{
+  if (!check_elem_args ("product", a, b))
+    return sparse_galois ();
+
+  if (b.rows () == 1 && b.cols () == 1)
+    return sparse_scale (a, sparse_scalar (b));
+  else if (a.rows () == 1 && a.cols () == 1)
+    return sparse_scale (b, sparse_scalar (a));
+
+  // The product is non-zero where both arrays are
+  sparse_galois retval (a.rows (), 0, a.m (), a.primpoly ());
+  for (octave_idx_type j = 0; j < a.cols (); j++)
+    {
+      octave_idx_type ka = a.cidx (j);
+      octave_idx_type kb = b.cidx (j);
+      while (ka < a.cidx (j+1) && kb < b.cidx (j+1))
+        {
+          if (a.ridx (ka) < b.ridx (kb))
+            ka++;
+          else if (b.ridx (kb) < a.ridx (ka))
+            kb++;
+          else
+            {
+              retval.append (a.ridx (ka), a.multiply (a.data (ka),
+                                                      b.data (kb)));
+              ka++;
+              kb++;
+            }
+        }
+      retval.end_column ();
+    }
+
+  return retval;
+}
+
+sparse_galois
+product (const sparse_galois& a, const galois& b)
+{
+  if (!check_elem_args ("product", a, b))
+    return sparse_galois ();
+
+  if (b.rows () == 1 && b.cols () == 1)
+    return sparse_scale (a, b(0, 0));
+  else if (a.rows () == 1 && a.cols () == 1)
+    return sparse_scale (sparse_galois (b), sparse_scalar (a));
+
+  sparse_galois retval (a.rows (), 0, a.m (), a.primpoly ());
+  for (octave_idx_type j = 0; j < a.cols (); j++)
+    {
+      for (octave_idx_type k = a.cidx (j); k < a.cidx (j+1); k++)
+        {
+          int d = a.multiply (a.data (k), b(a.ridx (k), j));
+          if (d != 0)
+            retval.append (a.ridx (k), d);
+        }
+      retval.end_column ();
+    }
+
+  return retval;
+}
+
+sparse_galois
+product (const galois& a, const sparse_galois& b)
+{
+  return product (b, a);
+}
+
+// The comparisons are those of the sparse matrices of the elements, once
+// the fields are checked
+SparseBoolMatrix
+mx_el_eq (const sparse_galois& a, const sparse_galois& b)
+{
+  if (!check_elem_args ("mx_el_eq", a, b))
+    return SparseBoolMatrix ();
+
+  return mx_el_eq (a.sparse_matrix_value (), b.sparse_matrix_value ());
+}
+
+SparseBoolMatrix
+mx_el_ne (const sparse_galois& a, const sparse_galois& b)
+{
+  if (!check_elem_args ("mx_el_ne", a, b))
+    return SparseBoolMatrix ();
+
+  return mx_el_ne (a.sparse_matrix_value (), b.sparse_matrix_value ());
+}
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
@@ -0,0 +1,154 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+#if !defined (octave_sparse_galois_h)
+#define octave_sparse_galois_h 1
+
+#include <vector>
+
+#include <octave/oct.h>
+#include <octave/boolSparse.h>
+#include <octave/dSparse.h>
+
+#include "galois.h"
+#include "galoisfield.h"
+
+// A Galois array in compressed sparse column form. The non-zero elements
+// of column j are data (k) in the rows ridx (k), for k from cidx (j) to
+// cidx (j+1) - 1, with the rows in increasing order. Only the non-zero
+// elements are stored, so that the parity check matrices of long LDPC
+// codes take memory in proportion to their number of edges
+
+class
+sparse_galois
+{
+public:
+  sparse_galois (void) : nr (0), nc (0), c_idx (1, 0), field (NULL) { }
+  sparse_galois (octave_idx_type _nr, octave_idx_type _nc, const int& _m=1,
+                 const int& _primpoly=0);
+  sparse_galois (const SparseMatrix& a, const int& _m=1,
+                 const int& _primpoly=0);
+  sparse_galois (const galois& a);
+  sparse_galois (const sparse_galois& a);
+  ~sparse_galois (void);
+
+  sparse_galois& operator = (const sparse_galois& a);
+
+  octave_idx_type rows (void) const { return nr; }
+  octave_idx_type cols (void) const { return nc; }
+  octave_idx_type columns (void) const { return nc; }
+  octave_idx_type nnz (void) const { return c_idx[nc]; }
+  dim_vector dims (void) const { return dim_vector (nr, nc); }
+
+  size_t byte_size (void) const
+  {
+    return ((nc + 1 + nnz ()) * sizeof (octave_idx_type)
+            + nnz () * sizeof (int));
+  }
+
+  octave_idx_type cidx (octave_idx_type j) const { return c_idx[j]; }
+  octave_idx_type ridx (octave_idx_type k) const { return r_idx[k]; }
+  int data (octave_idx_type k) const { return xdata[k]; }
+
+  // Append the element a of row i to a new column, the columns of an
+  // array created with no columns being filled in order, and the rows
+  // of each in increasing order
+  void append (octave_idx_type i, int a)
+  {
+    r_idx.push_back (i);
+    xdata.push_back (a);
+  }
+
+  // Close the new column, after appending its elements
+  void end_column (void)
+  {
+    c_idx.push_back (r_idx.size ());
+    nc++;
+  }
+
+  galois full (void) const;
+  SparseMatrix sparse_matrix_value (void) const;
+
+  sparse_galois transpose (void) const;
+
+  // Replace the elements from row r and column c on by the array a
+  sparse_galois& insert (const sparse_galois& a, octave_idx_type r,
+                         octave_idx_type c);
+  sparse_galois concat (const sparse_galois& rb,
+                        const Array<octave_idx_type>& ra_idx);
+
+  // The rank, by reduction of the columns on their last non-zero row
+  int rank (void) const;
+
+  // The reduced row echelon form, with the pivot column of each of its
+  // non-zero rows in piv
+  sparse_galois rref (std::vector<octave_idx_type>& piv) const;
+
+private:
+  void clear (void);
+
+  octave_idx_type nr;
+  octave_idx_type nc;
+  std::vector<octave_idx_type> c_idx;
+  std::vector<octave_idx_type> r_idx;
+  std::vector<int> xdata;
+
+  // Pointer to the Galois field structure used
+  galois_field_node *field;
+
+public:
+  // Is the variable initialized??
+  bool have_field (void) const { return (field ? true : false); };
+
+  // Access to Galois field structures
+  int m (void) const { return (field->m); }
+  int primpoly (void) const { return (field->primpoly); }
+
+  int multiply (const int& a, const int& b) const
+  { return (field->multiply (a, b)); }
+  int divide (const int& a, const int& b) const
+  { return (field->divide (a, b)); }
+};
+
+sparse_galois operator + (const sparse_galois& a, const sparse_galois& b);
+sparse_galois operator - (const sparse_galois& a, const sparse_galois& b);
+sparse_galois operator * (const sparse_galois& a, const sparse_galois& b);
+
+galois operator * (const sparse_galois& a, const galois& b);
+galois operator * (const galois& a, const sparse_galois& b);
+
+sparse_galois product (const sparse_galois& a, const sparse_galois& b);
+sparse_galois product (const sparse_galois& a, const galois& b);
+sparse_galois product (const galois& a, const sparse_galois& b);
+
+SparseBoolMatrix mx_el_eq (const sparse_galois& a, const sparse_galois& b);
+SparseBoolMatrix mx_el_ne (const sparse_galois& a, const sparse_galois& b);
+
+void install_sgm_sgm_ops (void);
+void install_sgm_gm_ops (void);
+void install_sgm_m_ops (void);
+
+#endif
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
@@ -0,0 +1,221 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+#include <octave/oct.h>
+#include <octave/oct-locbuf.h>
+#include <octave/uint8NDArray.h>
+#include <octave/uint16NDArray.h>
+
+#include "syndrome.h"
+
+DEFUN_DLD (syndecode, args, ,
+  "-*- texinfo -*-\n\
+@deftypefn {Loadable Function} {[@var{ccode}, @var{err}] =} syndecode (@var{code}, @var{h}, @var{t})\n\
+Syndrome decoding of the binary codewords in the rows of @var{code}, with\n\
+the parity check matrix @var{h} and the syndrome table @var{t}. The table\n\
+can be in any of the formats returned by @code{syndtable}, and is used\n\
+without conversion.\n\
+\n\
+The corrected codewords are returned in @var{ccode}, and the number of\n\
+corrected bits in each codeword in the column vector @var{err}.\n\
+@seealso{syndtable, decode}\n\
+@end deftypefn")
+{
+  octave_value_list retval;
+
+  if (args.length () != 3)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  Matrix code = args(0).matrix_value ();
+  Matrix h = args(1).matrix_value ();
+  int m = h.rows ();
+  int n = h.columns ();
+  int nsym = code.rows ();
+
+  if (m > (int)(sizeof (int) << 3) - 1)
+    {
+      error ("syndecode: codeword minus message length must be less than %d",
+             (int)(sizeof (int) << 3));
+      return retval;
+    }
+
+  if (code.columns () != n)
+    {
+      error ("syndecode: CODE must have the same number of columns as H");
+      return retval;
+    }
+
+  unsigned int nrows = ((unsigned int)1 << m);
+  int nbytes = (n + 7) >> 3;
+  bool packed = args(2).is_uint8_type ();
+  bool index = args(2).is_uint16_type ();
+  Matrix table;
+  uint8NDArray ptable;
+  uint16NDArray itable;
+
+  if (packed)
+    {
+      ptable = args(2).uint8_array_value ();
+      if ((ptable.rows () != nbytes) || (ptable.columns () != (int)nrows))
+        {
+          error ("syndecode: packed table must be of size %d by %d", nbytes,
+                 (int)nrows);
+          return retval;
+        }
+
+      // The bits past the last element of the rows would be written past
+      // the end of the codewords
+      int last = (n & 7) ? ((0xff << (n & 7)) & 0xff) : 0;
+      for (unsigned int i = 0; i < nrows; i++)
+        if (ptable(nbytes - 1, i).value () & last)
+          {
+            error ("syndecode: packed table has bits set past column %d",
+                   n);
+            return retval;
+          }
+    }
+  else if (index)
+    {
+      itable = args(2).uint16_array_value ();
+      if (itable.columns () != (int)nrows)
+        {
+          error ("syndecode: index table must have %d columns", (int)nrows);
+          return retval;
+        }
+
+      for (octave_idx_type i = 0; i < itable.numel (); i++)
+        if (itable(i).value () > n)
+          {
+            error ("syndecode: index table must have error positions from "
+                   "1 to %d", n);
+            return retval;
+          }
+    }
+  else
+    {
+      table = args(2).matrix_value ();
+      if ((table.rows () != (int)nrows) || (table.columns () != n))
+        {
+          error ("syndecode: syndrome table must be of size %d by %d",
+                 (int)nrows, n);
+          return retval;
+        }
+    }
+
+  // The syndrome of a single error in each bit, as in syndtable
+  OCTAVE_LOCAL_BUFFER (unsigned int, col, n);
+  syndrome_columns (col, h, m, n);
+
+  ColumnVector err (nsym, 0.);
+  int depth = itable.rows ();
+  const octave_uint8 *pdata = ptable.data ();
+  const octave_uint16 *idata = itable.data ();
+
+  for (int l = 0; l < nsym; l++)
+    {
+      OCTAVE_QUIT;
+
+      unsigned int syndrome = 0;
+      for (int k = 0; k < n; k++)
+        if (code(l, k) != 0)
+          syndrome ^= col[k];
+
+      if (syndrome == 0)
+        continue;
+
+      int nerr = 0;
+      if (packed)
+        {
+          const octave_uint8 *leader = pdata + (size_t)syndrome * nbytes;
+          for (int b = 0; b < nbytes; b++)
+            {
+              int bits = leader[b].value ();
+              for (int k = b << 3; bits != 0; k++, bits >>= 1)
+                if (bits & 1)
+                  {
+                    code(l, k) = ! code(l, k);
+                    nerr++;
+                  }
+            }
+        }
+      else if (index)
+        {
+          const octave_uint16 *leader = idata + (size_t)syndrome * depth;
+          for (int j = 0; j < depth; j++)
+            {
+              int k = leader[j].value ();
+              if (k == 0)
+                break;
+              code(l, k-1) = ! code(l, k-1);
+              nerr++;
+            }
+        }
+      else
+        for (int k = 0; k < n; k++)
+          if (table(syndrome, k) != 0)
+            {
+              code(l, k) = ! code(l, k);
+              nerr++;
+            }
+
+      err(l) = nerr;
+    }
+
+  retval(1) = octave_value (err);
+  retval(0) = octave_value (code);
+  return retval;
+}
+
+/*
+%% Test input validation
+%!error syndecode ()
+%!error syndecode (1, 2)
+%!error syndecode (1, 2, 3, 4)
+%!error <same number of columns> syndecode ([1 0], [1 0 1], zeros (2, 3))
+%!error <past column 3> syndecode ([1 0 1], [1 0 1], uint8 ([0 8]))
+%!error <positions from 1 to 3> syndecode ([1 0 1], [1 0 1], uint16 ([0 4]))
+
+%!test
+%! [par, gen] = cyclgen (15, cyclpoly (15, 7));
+%! code = mod (randi ([0 1], 50, 7) * gen, 2);
+%! noisy = code;
+%! noisy(:, [2, 9]) = ! noisy(:, [2, 9]);
+%! noisy(1:10, 4) = ! noisy(1:10, 4);
+%! t = syndtable (par);
+%! [c1, e1] = syndecode (noisy, par, t);
+%! [c2, e2] = syndecode (noisy, par, syndtable (par, "packed"));
+%! [c3, e3] = syndecode (noisy, par, syndtable (par, "index"));
+%! st = t(mod (noisy * par', 2) * 2.^(7:-1:0)' + 1, :);
+%! assert (c1, mod (noisy + st, 2))
+%! assert (e1, sum (st, 2))
+%! assert (c2, c1)
+%! assert (c3, c1)
+%! assert (e2, e1)
+%! assert (e3, e1)
+*/
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
@@ -0,0 +1,112 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+#if !defined (octave_syndrome_h)
+#define octave_syndrome_h 1
+
+#include <octave/oct.h>
+#include <octave/oct-locbuf.h>
+
+// The syndrome of a single error in each of the n bits, for the m by n
+// parity check matrix h. Row i of h gives bit m-i-1 of the syndrome, so
+// that the syndrome of a codeword is the index of its row in syndtable
+template <typename MT>
+static inline void
+syndrome_columns (unsigned int *col, const MT& h, int m, int n)
+{
+  for (int k = 0; k < n; k++)
+    {
+      col[k] = 0;
+      for (int i = 0; i < m; i++)
+        if (h(i, k) != 0)
+          col[k] |= ((unsigned int)1<<(m-i-1));
+    }
+}
+
+// Find a coset leader for each of the 2^m syndromes. The error patterns
+// of nerrs bits are walked in lexicographic order of the error positions
+// pos, for increasing nerrs, and store (syndrome, pos, nerrs) is called
+// for the first pattern found with each non-zero syndrome. part[j] is the
+// syndrome of the errors pos[0..j], so that a step only recomputes the
+// partial syndromes of the positions that changed, usually one or two.
+// The walk stops as soon as every syndrome has a leader. Syndromes that
+// can not be reached, for a parity check matrix of deficient rank, are
+// not stored.
+template <typename F>
+static void
+syndrome_coset_leaders (const unsigned int *col, int n, int m, F store)
+{
+  unsigned int nrows = ((unsigned int)1 << m);
+  boolNDArray filled (dim_vector (nrows, 1), false);
+  unsigned int nfilled = nrows;
+
+  // The zero syndrome is for no errors
+  nfilled--;
+  filled(0) = true;
+
+  OCTAVE_LOCAL_BUFFER (int, pos, n);
+  OCTAVE_LOCAL_BUFFER (unsigned int, part, n);
+
+  for (int nerrs = 1; (nfilled != 0) && (nerrs <= n); nerrs++)
+    {
+      for (int j = 0; j < nerrs; j++)
+        {
+          pos[j] = j;
+          part[j] = (j > 0 ? part[j-1] : 0) ^ col[j];
+        }
+
+      while (true)
+        {
+          unsigned int syndrome = part[nerrs-1];
+          if (!filled(syndrome))
+            {
+              filled(syndrome) = true;
+              store (syndrome, pos, nerrs);
+              if (--nfilled == 0)
+                break;
+            }
+
+          int i = nerrs - 1;
+          while ((i >= 0) && (pos[i] == n - nerrs + i))
+            i--;
+          if (i < 0)
+            break;
+
+          if (i < nerrs - 1)
+            OCTAVE_QUIT;
+
+          pos[i]++;
+          part[i] = (i > 0 ? part[i-1] : 0) ^ col[pos[i]];
+          for (int j = i + 1; j < nerrs; j++)
+            {
+              pos[j] = pos[j-1] + 1;
+              part[j] = part[j-1] ^ col[pos[j]];
+            }
+        }
+    }
+}
+
+#endif
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
@@ -19,63 +19,70 @@
 // Initiative (www.opensource.org)
 
 #include <octave/oct.h>
+#include <octave/oct-locbuf.h>
+#include <octave/uint8NDArray.h>
+#include <octave/uint16NDArray.h>
 
-#define COL_MAJ(N) (N / (sizeof (int) << 3))
-#define COL_MIN(N) (N % (sizeof (int) << 3))
-
-Array<int>
-get_errs (const int& nmin, const int& nmax, const int &nerrs)
-{
-  Array<int> pos;
-  int cols = COL_MAJ (nmax)+1;
-
-  OCTAVE_QUIT;
-  if (nerrs == 1)
-    {
-      pos.resize (dim_vector (nmax-nmin, cols), 0);
-      for (int i = nmin; i < nmax; i++)
-        {
-          pos(i-nmin, COL_MAJ (i)) = (1<<COL_MIN (i));
-        }
-    }
-  else
-    {
-      for (int i = nmin; i < nmax - nerrs + 1; i++)
-        {
-          Array<int> new_pos = get_errs (i+1, nmax, nerrs-1);
-          int l = pos.rows ();
-          pos.resize (dim_vector (l+new_pos.rows (), cols), 0);
-          for (int j=0; j<new_pos.rows (); j++)
-            {
-              for (int k = 0; k < cols; k++)
-                pos(l+j, k) = new_pos(j, k);
-              pos(l+j, COL_MAJ (i)) += (1<<COL_MIN (i));
-            }
-        }
-    }
-  return pos;
-}
+#include "syndrome.h"
 
 DEFUN_DLD (syndtable, args, nargout,
   "-*- texinfo -*-\n\
-@deftypefn {Loadable Function} {@var{t} =} syndtable (@var{h})\n\
+@deftypefn  {Loadable Function} {@var{t} =} syndtable (@var{h})\n\
+@deftypefnx {Loadable Function} {@var{t} =} syndtable (@var{h}, @var{format})\n\
 Create the syndrome decoding table from the parity check matrix @var{h}.\n\
 Each row of the returned matrix @var{t} represents the error vector in\n\
 a received symbol for a certain syndrome. The row selected is determined\n\
 by a conversion of the syndrome to an integer representation, and using\n\
 this to reference each row of @var{t}.\n\
-@seealso{hammgen, cyclgen}\n\
+\n\
+The optional argument @var{format} selects a more compact representation\n\
+of the table. Both of these are transposed with respect to the default,\n\
+so that the column @var{s}+1 holds the error vector for the syndrome\n\
+@var{s} in contiguous memory. Valid values are\n\
+\n\
+@table @asis\n\
+@item \"dense\"\n\
+The default, a double matrix with one element per bit.\n\
+@item \"packed\"\n\
+A uint8 matrix with ceil(N/8) rows. Bit @var{j} of the error vector is\n\
+held in bit mod(@var{j},8) of row fix(@var{j}/8)+1, with @var{j} starting\n\
+from zero.\n\
+@item \"index\"\n\
+A uint16 matrix whose rows are the positions, starting from one, of the\n\
+bits in error. The unused entries are zero. The number of rows is the\n\
+largest weight of an error vector in the table.\n\
+@end table\n\
+\n\
+All three formats can be used with @code{syndecode}.\n\
+@seealso{syndecode, hammgen, cyclgen}\n\
 @end deftypefn")
 {
   octave_value retval;
   int nargin = args.length ();
 
-  if (nargin != 1)
+  if (nargin < 1 || nargin > 2)
     {
       print_usage ();
       return retval;
     }
 
+  enum { DENSE, PACKED, INDEX } format = DENSE;
+  if (nargin > 1)
+    {
+      std::string fmt = args(1).string_value ();
+      if (fmt == "dense")
+        format = DENSE;
+      else if (fmt == "packed")
+        format = PACKED;
+      else if (fmt == "index")
+        format = INDEX;
+      else
+        {
+          error ("syndtable: unrecognized table format '%s'", fmt.c_str ());
+          return retval;
+        }
+    }
+
   if (!args(0).is_real_matrix ())
     {
       error ("syndtable: parity check matrix must be a real matrix");
@@ -108,48 +115,56 @@ this to reference each row of @var{t}.\n\
           return retval;
         }
 
-  RowVector filled (nrows, 0);
-  Matrix table (nrows, n, 0);
-  unsigned int nfilled = nrows;
-  int nerrs = 1;
+  if ((format == INDEX) && (n > 0xFFFF))
+    {
+      error ("syndtable: index format is limited to codewords of 65535 bits");
+      return retval;
+    }
 
-  // The first row of the table is for no errors
-  nfilled--;
-  filled(0) = 1;
+  // The syndrome of a single error in each bit
+  OCTAVE_LOCAL_BUFFER (unsigned int, col, n);
+  syndrome_columns (col, h, m, n);
+
+  Matrix table;
+  uint8NDArray ptable;
+  uint16NDArray itable;
+  int nbytes = (n + 7) >> 3;
+  if (format == DENSE)
+    table = Matrix (nrows, n, 0);
+  else if (format == PACKED)
+    ptable = uint8NDArray (dim_vector (nbytes, nrows), octave_uint8 (0));
+  else
+    itable = uint16NDArray (dim_vector (1, nrows), octave_uint16 (0));
 
-  while (nfilled != 0)
+  // The first row of the table is for no errors, and the others are
+  // filled in the order of a full enumeration of the error patterns
+  syndrome_coset_leaders (col, n, m,
+    [&] (unsigned int syndrome, const int *pos, int nerrs)
     {
-      // Get all possible combinations of nerrs bit errors in n bits
-      Array<int> errpos = get_errs (0, n, nerrs);
-
-      // Calculate the syndrome with the error vectors just calculated
-      for (int j = 0; j < errpos.rows (); j++)
+      if (format == DENSE)
+        for (int j = 0; j < nerrs; j++)
+          table(syndrome, pos[j]) = 1;
+      else if (format == PACKED)
+        for (int j = 0; j < nerrs; j++)
+          {
+            octave_uint8& b = ptable(pos[j] >> 3, syndrome);
+            b = octave_uint8 (b.value () | (1 << (pos[j] & 7)));
+          }
+      else
         {
-          int syndrome = 0;
-          for (int i = 0; i < m; i++)
-            {
-              for (int k = 0; k < n; k++)
-                syndrome ^= (errpos(j, COL_MAJ (k)) &
-                             ((unsigned int)h(i, k) << COL_MIN (k)) ?
-                             ((unsigned int)1<<(m-i-1)) : 0);
-            }
-
-          // Now use the syndrome as the rows indices to put the error vectors
-          // in place
-          if (((unsigned int)syndrome < nrows) && !filled(syndrome))
-            {
-              filled(syndrome) = 1;
-              nfilled--;
-              for (int i = 0; i < n; i++)
-                table(syndrome, i) = ((errpos(j, COL_MAJ (i)) &
-                                      ((unsigned int)1 << COL_MIN (i))) != 0);
-            }
+          if (nerrs > itable.rows ())
+            itable.resize (dim_vector (nerrs, nrows), octave_uint16 (0));
+          for (int j = 0; j < nerrs; j++)
+            itable(j, syndrome) = octave_uint16 (pos[j] + 1);
         }
+    });
 
-      nerrs++;
-    }
-
-  retval = octave_value (table);
+  if (format == DENSE)
+    retval = octave_value (table);
+  else if (format == PACKED)
+    retval = octave_value (ptable);
+  else
+    retval = octave_value (itable);
   return retval;
 }
 
@@ -158,4 +173,35 @@ this to reference each row of @var{t}.\n\
 %!error syndtable ()
 %!error syndtable (1, 2)
 %!error syndtable ([1 2])
+%!error syndtable (1, 2, 3)
+%!error <unrecognized table format> syndtable ([1 0 1], "sparse")
+
+%!test
+%! par = hammgen (3);
+%! t = syndtable (par);
+%! assert (size (t), [8, 7])
+%! assert (sum (t, 2), [0; ones(7, 1)])
+%! s = mod (t * par', 2) * [4; 2; 1];
+%! assert (s, [0:7]')
+
+%!test
+%! par = cyclgen (15, cyclpoly (15, 7));
+%! t = syndtable (par);
+%! assert (size (t), [256, 15])
+%! s = mod (t * par', 2) * 2.^(7:-1:0)';
+%! assert (s, [0:255]')
+
+%!test
+%! par = cyclgen (15, cyclpoly (15, 7));
+%! t = syndtable (par);
+%! p = syndtable (par, "packed");
+%! assert (class (p), "uint8")
+%! assert (size (p), [2, 256])
+%! assert (double (p'), t * [2.^(0:7), zeros(1, 7); zeros(1, 8), 2.^(0:6)]')
+%! x = syndtable (par, "index");
+%! assert (class (x), "uint16")
+%! assert (rows (x), max (sum (t, 2)))
+%! for s = 1:256
+%!   assert (sort (double (nonzeros (x(:, s))))', find (t(s, :)))
+%! endfor
 */
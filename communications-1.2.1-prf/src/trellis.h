@@ -0,0 +1,242 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+#if !defined (octave_trellis_h)
+#define octave_trellis_h 1
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <octave/oct.h>
+#include <octave/oct-map.h>
+
+// A trellis structure as returned by poly2trellis, with the outputs
+// converted from octal. The input symbol i in the state s leads to the
+// state next[s*ninputs+i] with the output symbol out[s*ninputs+i]. The
+// k bits of the input symbols and the n bits of the output symbols are
+// sent most significant bit first.
+//
+// The predecessors of each state are listed in pred, with npred entries
+// per state padded with -1, together with the input and output symbols
+// of the transitions. The trellis is a butterfly if it has one input
+// bit, and each state s leads to the states s>>1 and (s>>1)+nstates/2,
+// as for the shift registers of poly2trellis with or without feedback.
+// The predecessors of the state j are then 2*(j%h) and 2*(j%h)+1, with
+// h = nstates/2, and bf_in and bf_out give the input and output symbols
+// from the state p to the lower half of the states, at p, and to the
+// upper half, at nstates+p
+struct conv_trellis
+{
+  int k;
+  int n;
+  int nstates;
+  int ninputs;
+  int noutputs;
+  std::vector<int> next;
+  std::vector<int> out;
+
+  int npred;
+  std::vector<int> pred;
+  std::vector<int> pred_in;
+  std::vector<int> pred_out;
+
+  bool butterfly;
+  std::vector<int> bf_in;
+  std::vector<int> bf_out;
+};
+
+// The base 2 logarithm of a, or -1 if it is not a power of 2
+static inline int
+trellis_log2 (double a)
+{
+  for (int i = 0; i < 31; i++)
+    if (a == (double)(1 << i))
+      return i;
+  return -1;
+}
+
+// The value of the octal digits of a, or -1 if a has other digits
+static inline int
+trellis_oct2dec (double a)
+{
+  if (a < 0 || a != std::floor (a) || a > 1e9)
+    return -1;
+
+  int v = (int)a;
+  int r = 0;
+  for (int mul = 1; v > 0; mul <<= 3, v /= 10)
+    {
+      if (v % 10 > 7)
+        return -1;
+      r += (v % 10) * mul;
+    }
+  return r;
+}
+
+// The trellises read last, with the tables of the structures they were
+// read from. Keeping the tables keeps their data from being freed and
+// its address reused, and as Octave copies arrays when they are
+// modified, a table at the same address holds the same values, so that
+// a structure passed again is neither validated nor converted again.
+// Only the trellises of up to 65536 branches are kept
+struct trellis_cache_entry
+{
+  Matrix next;
+  Matrix out;
+  conv_trellis t;
+};
+
+#define TRELLIS_CACHE_SIZE 4
+
+static trellis_cache_entry trellis_cache[TRELLIS_CACHE_SIZE];
+static int trellis_cache_next = 0;
+
+// Read the trellis structure arg, reporting an error as fcn otherwise
+static bool
+get_trellis (const octave_value& arg, const char *fcn, conv_trellis& t)
+{
+  if (! arg.is_map ())
+    {
+      error ("%s: T must be a valid trellis structure", fcn);
+      return false;
+    }
+
+  octave_scalar_map s = arg.scalar_map_value ();
+  if (! (s.isfield ("numInputSymbols") && s.isfield ("numOutputSymbols")
+         && s.isfield ("numStates") && s.isfield ("nextStates")
+         && s.isfield ("outputs")))
+    {
+      error ("%s: T must be a valid trellis structure", fcn);
+      return false;
+    }
+
+  t.k = trellis_log2 (s.getfield ("numInputSymbols").double_value ());
+  t.n = trellis_log2 (s.getfield ("numOutputSymbols").double_value ());
+  int nu = trellis_log2 (s.getfield ("numStates").double_value ());
+  if (t.k < 1 || t.k > 16 || t.n < 1 || t.n > 16 || nu < 0 || nu > 24)
+    {
+      error ("%s: T must be a valid trellis structure", fcn);
+      return false;
+    }
+
+  t.nstates = 1 << nu;
+  t.ninputs = 1 << t.k;
+  t.noutputs = 1 << t.n;
+
+  const Matrix next = s.getfield ("nextStates").matrix_value ();
+  const Matrix out = s.getfield ("outputs").matrix_value ();
+  if (next.rows () != t.nstates || next.columns () != t.ninputs
+      || out.rows () != t.nstates || out.columns () != t.ninputs)
+    {
+      error ("%s: T must be a valid trellis structure", fcn);
+      return false;
+    }
+
+  for (int c = 0; c < TRELLIS_CACHE_SIZE; c++)
+    {
+      const trellis_cache_entry& e = trellis_cache[c];
+      if (e.next.data () == next.data () && e.out.data () == out.data ()
+          && e.t.k == t.k && e.t.n == t.n && e.t.nstates == t.nstates)
+        {
+          t = e.t;
+          return true;
+        }
+    }
+
+  int ns = t.nstates * t.ninputs;
+  t.next.resize (ns);
+  t.out.resize (ns);
+  for (int st = 0; st < t.nstates; st++)
+    for (int i = 0; i < t.ninputs; i++)
+      {
+        double a = next(st, i);
+        int o = trellis_oct2dec (out(st, i));
+        if (a < 0 || a >= t.nstates || a != std::floor (a)
+            || o < 0 || o >= t.noutputs)
+          {
+            error ("%s: T must be a valid trellis structure", fcn);
+            return false;
+          }
+        t.next[st*t.ninputs+i] = (int)a;
+        t.out[st*t.ninputs+i] = o;
+      }
+
+  std::vector<int> deg (t.nstates, 0);
+  for (int e = 0; e < ns; e++)
+    deg[t.next[e]]++;
+  t.npred = *std::max_element (deg.begin (), deg.end ());
+  t.pred.assign ((size_t)t.nstates * t.npred, -1);
+  t.pred_in.assign ((size_t)t.nstates * t.npred, 0);
+  t.pred_out.assign ((size_t)t.nstates * t.npred, 0);
+  std::fill (deg.begin (), deg.end (), 0);
+  for (int st = 0; st < t.nstates; st++)
+    for (int i = 0; i < t.ninputs; i++)
+      {
+        int e = st*t.ninputs+i;
+        int j = t.next[e];
+        int p = j*t.npred + deg[j]++;
+        t.pred[p] = st;
+        t.pred_in[p] = i;
+        t.pred_out[p] = t.out[e];
+      }
+
+  int h = t.nstates / 2;
+  t.butterfly = (t.k == 1 && t.nstates >= 2);
+  for (int st = 0; t.butterfly && (st < t.nstates); st++)
+    {
+      int a = t.next[2*st];
+      int b = t.next[2*st+1];
+      t.butterfly = ((a == (st >> 1) && b == (st >> 1) + h)
+                     || (b == (st >> 1) && a == (st >> 1) + h));
+    }
+
+  if (t.butterfly)
+    {
+      t.bf_in.resize (2 * t.nstates);
+      t.bf_out.resize (2 * t.nstates);
+      for (int st = 0; st < t.nstates; st++)
+        for (int i = 0; i < 2; i++)
+          {
+            int hi = (t.next[2*st+i] >= h);
+            t.bf_in[hi*t.nstates+st] = i;
+            t.bf_out[hi*t.nstates+st] = t.out[2*st+i];
+          }
+    }
+
+  if (ns <= 65536)
+    {
+      trellis_cache_entry& e = trellis_cache[trellis_cache_next];
+      e.next = next;
+      e.out = out;
+      e.t = t;
+      trellis_cache_next = (trellis_cache_next + 1) % TRELLIS_CACHE_SIZE;
+    }
+
+  return true;
+}
+
+#endif
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
@@ -0,0 +1,929 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <octave/oct.h>
+
+#include "trellis.h"
+#include "viterbi.h"
+
+// PKG_ADD: autoload ("vitdecinit", "vitdec.oct");
+// PKG_DEL: autoload ("vitdecinit", "vitdec.oct", "remove");
+// PKG_ADD: autoload ("vitdecstep", "vitdec.oct");
+// PKG_DEL: autoload ("vitdecstep", "vitdec.oct", "remove");
+
+enum vitdec_mode
+{
+  VITDEC_TRUNC=0,
+  VITDEC_TERM,
+  VITDEC_CONT
+};
+
+enum vitdec_type
+{
+  VITDEC_UNQUANT=0,
+  VITDEC_HARD,
+  VITDEC_SOFT
+};
+
+// The decoding options shared by vitdec and the streaming decoder: the
+// traceback depth, the type of the received values with the largest
+// soft decision, and the puncturing pattern, empty if there is none
+struct vitdec_options
+{
+  int tblen;
+  vitdec_type type;
+  int nsdec;
+  int maxq;
+  std::vector<bool> punct;
+};
+
+// The costs of the received value x being sent as a 0 and as a 1. The
+// hard decisions cost their Hamming distance, the soft decisions of
+// nsdec bits their distance to 0 and to 2^nsdec-1, and the unquantized
+// values, +1 for a 0 and -1 for a 1, the difference of their squared
+// distances to +1 and to -1, divided by 4. The bits removed by the
+// puncturing are NaN, and cost nothing either way
+template <typename T>
+static inline void
+vitdec_cost (double x, vitdec_type type, int maxq, T *c)
+{
+  if (std::isnan (x))
+    {
+      c[0] = 0;
+      c[1] = 0;
+      return;
+    }
+
+  switch (type)
+    {
+    case VITDEC_UNQUANT:
+      c[0] = (T)(x < 0 ? -x : 0);
+      c[1] = (T)(x > 0 ? x : 0);
+      break;
+
+    case VITDEC_HARD:
+      c[0] = (T)x;
+      c[1] = (T)(1 - x);
+      break;
+
+    case VITDEC_SOFT:
+      c[0] = (T)x;
+      c[1] = (T)(maxq - x);
+      break;
+    }
+}
+
+// The traceback depth, limited for the survivor memory of the
+// continuous decoding
+#define VITDEC_MAX_TBLEN (1 << 24)
+
+static bool
+vitdec_get_tblen (const octave_value& arg, const char *fcn,
+                  vitdec_options& opt)
+{
+  double tb = arg.double_value ();
+  if (! (tb >= 1 && tb < VITDEC_MAX_TBLEN && tb == std::floor (tb)))
+    {
+      error ("%s: TBLEN must be a positive integer less than 2^24", fcn);
+      return false;
+    }
+
+  opt.tblen = (int)tb;
+  return true;
+}
+
+// Read the decision type at args(i), followed by the number of soft
+// decision bits for "soft", advancing i past them
+static bool
+vitdec_get_type (const octave_value_list& args, int& i, const char *fcn,
+                 vitdec_options& opt)
+{
+  if (! args(i).is_string ())
+    {
+      error ("%s: DECTYPE must be a string", fcn);
+      return false;
+    }
+
+  std::string dectype = args(i++).string_value ();
+  opt.nsdec = 0;
+  opt.maxq = 1;
+  if (dectype == "unquant")
+    opt.type = VITDEC_UNQUANT;
+  else if (dectype == "hard")
+    opt.type = VITDEC_HARD;
+  else if (dectype == "soft")
+    {
+      opt.type = VITDEC_SOFT;
+      double nsdec = (i < args.length () ? args(i++).double_value () : 0);
+      if (! (nsdec >= 1 && nsdec <= 13 && nsdec == std::floor (nsdec)))
+        {
+          error ("%s: NSDEC must be an integer from 1 to 13", fcn);
+          return false;
+        }
+      opt.nsdec = (int)nsdec;
+      opt.maxq = (1 << opt.nsdec) - 1;
+    }
+  else
+    {
+      error ("%s: DECTYPE must be \"unquant\", \"hard\" or \"soft\"", fcn);
+      return false;
+    }
+
+  return true;
+}
+
+static bool
+vitdec_get_punct (const octave_value& arg, const char *fcn,
+                  vitdec_options& opt)
+{
+  opt.punct.clear ();
+  if (arg.is_empty ())
+    return true;
+
+  Matrix p = arg.matrix_value ();
+  bool ok = (p.rows () == 1 || p.columns () == 1);
+  bool any = false;
+  for (octave_idx_type i = 0; ok && (i < p.numel ()); i++)
+    {
+      ok = (p(i) == 0 || p(i) == 1);
+      opt.punct.push_back (p(i) != 0);
+      any = any || (p(i) != 0);
+    }
+
+  if (! ok || ! any)
+    {
+      error ("%s: PUNCT must be a binary vector with at least one 1", fcn);
+      return false;
+    }
+
+  return true;
+}
+
+// The survivor decisions of a general trellis are stored in one byte
+// per state, which must be able to hold any predecessor number.
+
+static bool
+vitdec_check_trellis (const conv_trellis& t, const char *fcn)
+{
+  if (! t.butterfly && t.npred > 256)
+    {
+      error ("%s: T has states with more than 256 predecessors", fcn);
+      return false;
+    }
+
+  return true;
+}
+
+static bool
+vitdec_check_code (const Matrix& code, const vitdec_options& opt,
+                   const char *fcn)
+{
+  if (! (code.rows () == 1 || code.columns () == 1 || code.numel () == 0))
+    {
+      error ("%s: CODE must be a vector", fcn);
+      return false;
+    }
+
+  for (octave_idx_type i = 0; i < code.numel (); i++)
+    {
+      double x = code(i);
+      if (opt.type == VITDEC_UNQUANT ? ! std::isfinite (x)
+          : (x < 0 || x > opt.maxq || x != std::floor (x)))
+        {
+          if (opt.type == VITDEC_UNQUANT)
+            error ("%s: CODE must be finite", fcn);
+          else if (opt.type == VITDEC_HARD)
+            error ("%s: CODE must be binary for hard decisions", fcn);
+          else
+            error ("%s: CODE must be integers from 0 to %d", fcn, opt.maxq);
+          return false;
+        }
+    }
+
+  return true;
+}
+
+// Append the received values of code to x, with a NaN for each bit
+// removed by the puncturing pattern, whose position pi is carried from
+// one call to the next. The removed bits are inserted as soon as the
+// pattern reaches them, so that the result does not depend on how the
+// received values are split between the calls
+static void
+vitdec_depuncture (const double *code, octave_idx_type len,
+                   const std::vector<bool>& punct, size_t& pi,
+                   std::vector<double>& x)
+{
+  if (punct.empty ())
+    {
+      x.insert (x.end (), code, code + len);
+      return;
+    }
+
+  size_t plen = punct.size ();
+  for (octave_idx_type i = 0; i <= len; i++)
+    {
+      while (! punct[pi])
+        {
+          x.push_back (octave_NaN);
+          pi = (pi + 1 == plen ? 0 : pi + 1);
+        }
+      if (i == len)
+        break;
+      x.push_back (code[i]);
+      pi = (pi + 1 == plen ? 0 : pi + 1);
+    }
+}
+
+// 0 for float path metrics, 1 for int16_t and 2 for int32_t. The integer
+// metrics grow by at most (2*nu+4)*n*maxq before being renormalized and
+// saturated
+static int
+vitdec_metric_type (const conv_trellis& t, const vitdec_options& opt)
+{
+  if (opt.type == VITDEC_UNQUANT)
+    return 0;
+
+  int nu = 0;
+  while ((1 << nu) < t.nstates)
+    nu++;
+  double bound = (2.*nu + 4) * t.n * opt.maxq + 1;
+
+  return (bound < 32767 ? 1 : 2);
+}
+
+static void
+vitdec_put_symbol (int sym, int k, double *msg)
+{
+  for (int i = 0; i < k; i++)
+    msg[i] = (sym >> (k - i - 1)) & 1;
+}
+
+// Trace back from the best state after the last step of vit down to the
+// step lo, putting the symbols of the steps lo to hi-1 into msg, the
+// symbol of the step v at msg + (v-first)*k
+template <typename T>
+static void
+vitdec_trace (const viterbi<T>& vit, octave_idx_type lo, octave_idx_type hi,
+              octave_idx_type first, int k, double *msg)
+{
+  if (hi <= lo)
+    return;
+
+  octave_idx_type u = vit.steps () - 1;
+  vit.traceback (vit.best_state (), u, u - lo + 1,
+                 [&] (octave_idx_type v, int sym)
+    {
+      if (v < hi)
+        vitdec_put_symbol (sym, k, msg + (v - first) * k);
+    });
+}
+
+// Continuous decoding of nsteps symbols of the received values x, the
+// output of the step w from the start of the stream being the symbol of
+// the step w-tblen, and zero for the first tblen steps. Rather than
+// tracing back tblen steps after each step, the decoder traces back
+// 2*tblen steps from the best state after each step w that ends a
+// block of tblen steps, for the outputs of the steps w-tblen+1 to w,
+// each traced back over at least tblen steps. This is two steps of
+// traceback per symbol instead of tblen. The output of the step w is put
+// at msg + (w-first)*k, those of the steps after the last block being
+// left to the caller. The survivor memory of vit must hold 2*tblen steps
+template <typename T>
+static void
+vitdec_continue (viterbi<T>& vit, const conv_trellis& t, const double *x,
+                 octave_idx_type nsteps, const vitdec_options& opt,
+                 octave_idx_type first, double *msg)
+{
+  int n = t.n;
+  int k = t.k;
+  octave_idx_type tblen = opt.tblen;
+  std::vector<T> cost (2 * n);
+
+  for (octave_idx_type i = 0; i < nsteps; i++)
+    {
+      if ((i & 1023) == 0)
+        OCTAVE_QUIT;
+
+      for (int b = 0; b < n; b++)
+        vitdec_cost (x[i*n+b], opt.type, opt.maxq, &cost[2*b]);
+      vit.step (&cost[0]);
+
+      octave_idx_type w = vit.steps ();
+      if (w % tblen == 0)
+        vitdec_trace (vit, std::max (w - 2*tblen, (octave_idx_type)0),
+                      w - tblen, first - tblen, k, msg);
+    }
+}
+
+// Decode the nsteps symbols of x into the input bits msg. Truncated and
+// terminated decoding keep the decisions of every step, and trace back
+// once from the end
+template <typename T>
+static void
+vitdec_decode (const conv_trellis& t, const double *x,
+               octave_idx_type nsteps, vitdec_mode mode,
+               const vitdec_options& opt, double *msg)
+{
+  int k = t.k;
+  int n = t.n;
+
+  if (mode == VITDEC_CONT)
+    {
+      octave_idx_type tblen = opt.tblen;
+      viterbi<T> vit (t, opt.maxq, 2 * tblen);
+      vit.start (0);
+      vitdec_continue (vit, t, x, nsteps, opt, 0, msg);
+
+      // The outputs after the last block are traced back from the end
+      octave_idx_type done = nsteps - nsteps % tblen;
+      vitdec_trace (vit, std::max (done - tblen, (octave_idx_type)0),
+                    nsteps - tblen, -tblen, k, msg);
+      return;
+    }
+
+  viterbi<T> vit (t, opt.maxq, nsteps);
+  std::vector<T> cost (2 * n);
+
+  vit.start (0);
+
+  for (octave_idx_type u = 0; u < nsteps; u++)
+    {
+      if ((u & 1023) == 0)
+        OCTAVE_QUIT;
+
+      for (int b = 0; b < n; b++)
+        vitdec_cost (x[u*n+b], opt.type, opt.maxq, &cost[2*b]);
+      vit.step (&cost[0]);
+    }
+
+  int s = (mode == VITDEC_TERM ? 0 : vit.best_state ());
+  vit.traceback (s, nsteps - 1, nsteps, [&] (octave_idx_type v, int sym)
+    {
+      vitdec_put_symbol (sym, k, msg + v*k);
+    });
+}
+
+DEFUN_DLD (vitdec, args, ,
+  "-*- texinfo -*-\n\
+@deftypefn  {Loadable Function} {@var{msg} =} vitdec (@var{code}, @var{t}, @var{tblen}, @var{opmode}, @var{dectype})\n\
+@deftypefnx {Loadable Function} {@var{msg} =} vitdec (@var{code}, @var{t}, @var{tblen}, @var{opmode}, \"soft\", @var{nsdec})\n\
+@deftypefnx {Loadable Function} {@var{msg} =} vitdec (@dots{}, @var{punct})\n\
+Decode the convolutionally encoded vector @var{code} with the Viterbi\n\
+algorithm on the trellis structure @var{t}. Each @math{n} elements of\n\
+@var{code} are an output symbol of @var{t}, and each gives @math{k} bits\n\
+of the decoded message @var{msg}, which has the orientation of\n\
+@var{code}.\n\
+\n\
+@var{tblen} is the traceback depth, a positive integer less than 2^24,\n\
+typically about five times the constraint length of the code.\n\
+@var{opmode} is one of\n\
+\n\
+@table @asis\n\
+@item \"trunc\"\n\
+The encoder starts in the all-zeros state, and the decoder traces back\n\
+from the state with the best metric at the end of @var{code}.\n\
+@item \"term\"\n\
+The encoder starts and ends in the all-zeros state, and the decoder\n\
+traces back from the all-zeros state.\n\
+@item \"cont\"\n\
+The encoder starts in the all-zeros state, and the output is delayed\n\
+by @var{tblen} symbols, its first @var{tblen}*@math{k} bits being zero.\n\
+Every @var{tblen} symbols, and at the end of @var{code}, the decoder\n\
+traces back from the state with the best metric the symbols of the\n\
+outputs since the last traceback, each of them at least @var{tblen}\n\
+symbols back, for two steps of traceback per symbol.\n\
+@end table\n\
+\n\
+@var{dectype} is one of\n\
+\n\
+@table @asis\n\
+@item \"unquant\"\n\
+@var{code} is real, +1 for a 0 and -1 for a 1, decoded with Euclidean\n\
+metrics.\n\
+@item \"hard\"\n\
+@var{code} is binary, decoded with Hamming metrics.\n\
+@item \"soft\"\n\
+@var{code} holds integers from 0, the most confident 0, to\n\
+2^@var{nsdec}-1, the most confident 1.\n\
+@end table\n\
+\n\
+If the binary vector @var{punct} is given and not empty, @var{code} was\n\
+punctured with it as by @code{convenc}, and the removed bits are decoded\n\
+as erasures.\n\
+\n\
+The path metrics of the hard and soft decisions are 16 bit integers when\n\
+they fit, and the add-compare-select steps of codes of one input bit are\n\
+vectorized over the states.\n\
+@seealso{vitdecinit, convenc, poly2trellis, istrellis}\n\
+@end deftypefn")
+{
+  octave_value retval;
+  int nargin = args.length ();
+
+  if (nargin < 5 || nargin > 7)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  conv_trellis t;
+  if (! get_trellis (args(1), "vitdec", t)
+      || ! vitdec_check_trellis (t, "vitdec"))
+    return retval;
+
+  vitdec_options opt;
+  if (! vitdec_get_tblen (args(2), "vitdec", opt))
+    return retval;
+
+  if (! args(3).is_string ())
+    {
+      error ("vitdec: OPMODE must be a string");
+      return retval;
+    }
+
+  std::string opmode = args(3).string_value ();
+  vitdec_mode mode;
+  if (opmode == "trunc")
+    mode = VITDEC_TRUNC;
+  else if (opmode == "term")
+    mode = VITDEC_TERM;
+  else if (opmode == "cont")
+    mode = VITDEC_CONT;
+  else
+    {
+      error ("vitdec: OPMODE must be \"trunc\", \"term\" or \"cont\"");
+      return retval;
+    }
+
+  int i = 4;
+  if (! vitdec_get_type (args, i, "vitdec", opt))
+    return retval;
+
+  if (i < nargin && ! vitdec_get_punct (args(i++), "vitdec", opt))
+    return retval;
+
+  if (i < nargin)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  Matrix code = args(0).matrix_value ();
+  if (! vitdec_check_code (code, opt, "vitdec"))
+    return retval;
+
+  std::vector<double> x;
+  size_t pi = 0;
+  vitdec_depuncture (code.data (), code.numel (), opt.punct, pi, x);
+
+  // The erasures after the last received value that complete no symbol
+  // were removed past the end of the code, whose length is a multiple of
+  // n that need not fill the puncturing pattern
+  while (x.size () % t.n != 0 && ! x.empty () && std::isnan (x.back ()))
+    x.pop_back ();
+
+  octave_idx_type len = x.size ();
+  if (len % t.n != 0)
+    {
+      if (opt.punct.empty ())
+        error ("vitdec: length of CODE must be a multiple of %d", t.n);
+      else
+        error ("vitdec: length of CODE does not match PUNCT");
+      return retval;
+    }
+
+  octave_idx_type nsteps = len / t.n;
+  Matrix msg (nsteps * t.k, 1, 0.);
+
+  if (nsteps > 0)
+    switch (vitdec_metric_type (t, opt))
+      {
+      case 0:
+        vitdec_decode<float> (t, &x[0], nsteps, mode, opt,
+                              msg.fortran_vec ());
+        break;
+
+      case 1:
+        vitdec_decode<int16_t> (t, &x[0], nsteps, mode, opt,
+                                msg.fortran_vec ());
+        break;
+
+      default:
+        vitdec_decode<int32_t> (t, &x[0], nsteps, mode, opt,
+                                msg.fortran_vec ());
+        break;
+      }
+
+  if (code.rows () == 1 && code.columns () != 1)
+    retval = octave_value (msg.transpose ());
+  else
+    retval = octave_value (msg);
+
+  return retval;
+}
+
+DEFUN_DLD (vitdecinit, args, ,
+  "-*- texinfo -*-\n\
+@deftypefn  {Loadable Function} {@var{dec} =} vitdecinit (@var{t}, @var{tblen}, @var{dectype})\n\
+@deftypefnx {Loadable Function} {@var{dec} =} vitdecinit (@var{t}, @var{tblen}, \"soft\", @var{nsdec})\n\
+@deftypefnx {Loadable Function} {@var{dec} =} vitdecinit (@dots{}, @var{punct})\n\
+Create the state @var{dec} of a streaming Viterbi decoder, for the\n\
+trellis structure @var{t}, with the traceback depth @var{tblen}, the\n\
+decision type @var{dectype} and the puncturing pattern @var{punct}, as\n\
+for @code{vitdec}. The decoder is fed with @code{vitdecstep}, and\n\
+starts in the all-zeros state.\n\
+@seealso{vitdecstep, vitdec}\n\
+@end deftypefn")
+{
+  octave_value retval;
+  int nargin = args.length ();
+
+  if (nargin < 3 || nargin > 5)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  conv_trellis t;
+  if (! get_trellis (args(0), "vitdecinit", t)
+      || ! vitdec_check_trellis (t, "vitdecinit"))
+    return retval;
+
+  vitdec_options opt;
+  if (! vitdec_get_tblen (args(1), "vitdecinit", opt))
+    return retval;
+
+  int i = 2;
+  if (! vitdec_get_type (args, i, "vitdecinit", opt))
+    return retval;
+
+  if (i < nargin && ! vitdec_get_punct (args(i++), "vitdecinit", opt))
+    return retval;
+
+  if (i < nargin)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  // The state of a new decoder, saved as vitdecstep saves it
+  ColumnVector metrics (t.nstates, octave_Inf);
+  metrics(0) = 0;
+  int wps = (t.butterfly ? BITPACK_WORDS (t.nstates) : (t.nstates + 7) / 8);
+  uint64NDArray survivors (dim_vector (wps, 2 * opt.tblen),
+                           octave_uint64 (0));
+
+  RowVector punct (opt.punct.size ());
+  for (size_t j = 0; j < opt.punct.size (); j++)
+    punct(j) = opt.punct[j];
+
+  octave_scalar_map s;
+  s.assign ("trellis", args(0));
+  s.assign ("tblen", octave_value (opt.tblen));
+  s.assign ("dectype", octave_value (args(2).string_value ()));
+  s.assign ("nsdec", octave_value (opt.nsdec));
+  s.assign ("punct", octave_value (punct));
+  s.assign ("position", octave_value (0));
+  s.assign ("pending", octave_value (RowVector (0)));
+  s.assign ("metrics", octave_value (metrics));
+  s.assign ("survivors", octave_value (survivors));
+  s.assign ("norm", octave_value (0));
+  s.assign ("steps", octave_value (0));
+
+  retval = octave_value (s);
+  return retval;
+}
+
+// Decode the received values code with the saved decoder state s, and
+// flush it if flush is true. The metrics of a new decoder are infinite
+// except in the all-zeros state, and are saturated on loading. Returns
+// false if s does not match the trellis and the options
+template <typename T>
+static bool
+vitdec_stream (const conv_trellis& t, const vitdec_options& opt,
+               octave_scalar_map& s, const Matrix& code, bool flush,
+               Matrix& msg)
+{
+  int n = t.n;
+  int k = t.k;
+
+  octave_idx_type tblen = opt.tblen;
+  viterbi<T> vit (t, opt.maxq, 2 * tblen);
+  if (! vit.load (s.getfield ("metrics").column_vector_value (),
+                  s.getfield ("survivors").uint64_array_value (),
+                  s.getfield ("norm").double_value (),
+                  s.getfield ("steps").double_value ()))
+    {
+      error ("vitdecstep: DEC must be a decoder returned by vitdecinit");
+      return false;
+    }
+
+  // The received values of the last incomplete symbol come first
+  std::vector<double> x;
+  RowVector pending = s.getfield ("pending").row_vector_value ();
+  for (octave_idx_type i = 0; i < pending.numel (); i++)
+    x.push_back (pending(i));
+
+  double pos = s.getfield ("position").double_value ();
+  size_t pi = 0;
+  if (! opt.punct.empty ())
+    {
+      if (! (pos >= 0 && pos < opt.punct.size () && pos == std::floor (pos)))
+        {
+          error ("vitdecstep: DEC must be a decoder returned by vitdecinit");
+          return false;
+        }
+      pi = (size_t)pos;
+    }
+  vitdec_depuncture (code.data (), code.numel (), opt.punct, pi, x);
+
+  // The outputs of the steps from done0, after the last block of the
+  // previous calls, are given up to the last block, or all of them and
+  // the last symbols not yet given when flushing
+  octave_idx_type nsteps = x.size () / n;
+  octave_idx_type done0 = vit.steps () - vit.steps () % tblen;
+  octave_idx_type total = vit.steps () + nsteps;
+  octave_idx_type done = total - total % tblen;
+  octave_idx_type nout = (flush ? total - done0 : done - done0);
+  octave_idx_type nflush = (flush ? std::min (tblen, total) : 0);
+
+  msg = Matrix ((nout + nflush) * k, 1, 0.);
+  double *m = msg.fortran_vec ();
+  if (nsteps > 0)
+    vitdec_continue (vit, t, &x[0], nsteps, opt, done0, m);
+
+  if (nflush > 0)
+    {
+      vitdec_trace (vit, std::max (done - tblen, (octave_idx_type)0),
+                    total - tblen, done0 - tblen, k, m);
+      vitdec_trace (vit, total - nflush, total, total - nout - nflush, k, m);
+    }
+
+  RowVector rest (x.size () - nsteps * n);
+  for (octave_idx_type i = 0; i < rest.numel (); i++)
+    rest(i) = x[nsteps*n + i];
+
+  ColumnVector metrics;
+  uint64NDArray survivors;
+  double norm, steps;
+  vit.save (metrics, survivors, norm, steps);
+
+  s.assign ("position", octave_value ((double)pi));
+  s.assign ("pending", octave_value (rest));
+  s.assign ("metrics", octave_value (metrics));
+  s.assign ("survivors", octave_value (survivors));
+  s.assign ("norm", octave_value (norm));
+  s.assign ("steps", octave_value (steps));
+  return true;
+}
+
+DEFUN_DLD (vitdecstep, args, ,
+  "-*- texinfo -*-\n\
+@deftypefn  {Loadable Function} {[@var{msg}, @var{dec}] =} vitdecstep (@var{dec}, @var{code})\n\
+@deftypefnx {Loadable Function} {[@var{msg}, @var{dec}] =} vitdecstep (@var{dec}, @var{code}, \"flush\")\n\
+Continue the streaming Viterbi decoding of @var{dec}, returned by\n\
+@code{vitdecinit}, with the received values @var{code}, and return the\n\
+decoded bits @var{msg} with the new state of the decoder.\n\
+\n\
+The path metrics and the last 2*@var{tblen} decisions are carried from\n\
+one call to the next, as are the position in the puncturing pattern and\n\
+the values of an incomplete symbol. As for @code{vitdec} in \"cont\"\n\
+mode, the output is delayed by @var{tblen} symbols and traced back\n\
+every @var{tblen} symbols counted from the start of the stream. Each\n\
+call returns the outputs up to the last of these tracebacks, those of\n\
+the following symbols being returned by a later call.\n\
+\n\
+With \"flush\", the outputs not yet returned, followed by the last\n\
+@var{tblen} symbols, are traced back from the best state and returned,\n\
+after which the decoder should not be used any more. The concatenated\n\
+outputs of any split of the received values, flushed at the end, are\n\
+then the output of @code{vitdec} in \"cont\" mode followed by the last\n\
+@var{tblen} symbols. @var{msg} has the orientation of @var{code}.\n\
+@seealso{vitdecinit, vitdec}\n\
+@end deftypefn")
+{
+  octave_value_list retval;
+  int nargin = args.length ();
+
+  if (nargin < 2 || nargin > 3)
+    {
+      print_usage ();
+      return retval;
+    }
+
+  bool flush = false;
+  if (nargin > 2)
+    {
+      if (! (args(2).is_string () && args(2).string_value () == "flush"))
+        {
+          error ("vitdecstep: the third argument must be \"flush\"");
+          return retval;
+        }
+      flush = true;
+    }
+
+  octave_scalar_map s;
+  if (args(0).is_map ())
+    s = args(0).scalar_map_value ();
+  const char *fields[] = {"trellis", "tblen", "dectype", "nsdec", "punct",
+                          "position", "pending", "metrics", "survivors",
+                          "norm", "steps"};
+  for (int f = 0; f < 11; f++)
+    if (! (args(0).is_map () && s.isfield (fields[f])))
+      {
+        error ("vitdecstep: DEC must be a decoder returned by vitdecinit");
+        return retval;
+      }
+
+  conv_trellis t;
+  if (! get_trellis (s.getfield ("trellis"), "vitdecstep", t)
+      || ! vitdec_check_trellis (t, "vitdecstep"))
+    return retval;
+
+  vitdec_options opt;
+  if (! vitdec_get_tblen (s.getfield ("tblen"), "vitdecstep", opt))
+    return retval;
+  octave_value_list targs;
+  targs(0) = s.getfield ("dectype");
+  targs(1) = s.getfield ("nsdec");
+  int i = 0;
+  if (! vitdec_get_type (targs, i, "vitdecstep", opt)
+      || ! vitdec_get_punct (s.getfield ("punct"), "vitdecstep", opt))
+    return retval;
+
+  Matrix code = args(1).matrix_value ();
+  if (! vitdec_check_code (code, opt, "vitdecstep"))
+    return retval;
+
+  Matrix msg;
+  bool ok;
+  switch (vitdec_metric_type (t, opt))
+    {
+    case 0:
+      ok = vitdec_stream<float> (t, opt, s, code, flush, msg);
+      break;
+
+    case 1:
+      ok = vitdec_stream<int16_t> (t, opt, s, code, flush, msg);
+      break;
+
+    default:
+      ok = vitdec_stream<int32_t> (t, opt, s, code, flush, msg);
+      break;
+    }
+
+  if (! ok)
+    return retval;
+
+  retval(1) = octave_value (s);
+  if (code.rows () == 1 && code.columns () != 1)
+    retval(0) = octave_value (msg.transpose ());
+  else
+    retval(0) = octave_value (msg);
+
+  return retval;
+}
+
+/*
+%!test
+%! ## Any split of the received values gives the output of "cont" mode
+%! t = poly2trellis (7, [171 133]);
+%! msg = randi ([0 1], 1, 2000);
+%! code = convenc (msg, t);
+%! e = randperm (numel (code), 40);
+%! code(e) = 1 - code(e);
+%! ref = vitdec (code, t, 35, "cont", "hard");
+%! dec = vitdecinit (t, 35, "hard");
+%! out = [];
+%! i = 0;
+%! while (i < numel (code))
+%!   j = min (i + randi (97), numel (code));
+%!   [m, dec] = vitdecstep (dec, code(i+1:j));
+%!   out = [out m];
+%!   i = j;
+%! endwhile
+%! assert (out, ref(1:numel (out)))
+%! assert (numel (out), 2000 - mod (2000, 35))
+%! [m, dec] = vitdecstep (dec, [], "flush");
+%! trunc = vitdec (code, t, 35, "trunc", "hard");
+%! assert ([out m], [ref trunc(end-34:end)])
+
+%!test
+%! ## The puncturing position and the incomplete symbols are carried
+%! t = poly2trellis ([5 4], [23 35 0; 0 5 13]);
+%! p = [1 1 1 0 1 1];
+%! msg = randi ([0 1], 1, 1000);
+%! code = 7 * convenc (msg, t, p)';
+%! ref = vitdec (code, t, 30, "cont", "soft", 3, p);
+%! dec = vitdecinit (t, 30, "soft", 3, p);
+%! [m1, dec] = vitdecstep (dec, code(1:101));
+%! [m2, dec] = vitdecstep (dec, code(102:end));
+%! [m3, dec] = vitdecstep (dec, [], "flush");
+%! assert ([m1; m2; m3](1:numel (ref)), ref)
+%! assert (size (m1, 2), 1)
+
+%!error vitdecinit (poly2trellis (3, [7 5]), 5)
+%!error <TBLEN> vitdecinit (poly2trellis (3, [7 5]), 0, "hard")
+%!error <TBLEN> vitdecinit (poly2trellis (3, [7 5]), 2^24, "hard")
+%!error <DEC> vitdecstep (struct (), [0 1])
+%!error <flush> vitdecstep (vitdecinit (poly2trellis (3, [7 5]), 5, "hard"), [], "foo")
+*/
+
+/*
+%% Test input validation
+%!error vitdec ()
+%!error vitdec (1, 2, 3, 4)
+%!error <valid trellis> vitdec ([0 0], struct (), 5, "trunc", "hard")
+%!error <TBLEN> vitdec ([0 0], poly2trellis (3, [7 5]), 0, "trunc", "hard")
+%!error <2\^24> vitdec ([0 0], poly2trellis (3, [7 5]), 2^24, "trunc", "hard")
+%!error <OPMODE> vitdec ([0 0], poly2trellis (3, [7 5]), 5, "foo", "hard")
+%!error <DECTYPE> vitdec ([0 0], poly2trellis (3, [7 5]), 5, "trunc", "foo")
+%!error <NSDEC> vitdec ([0 0], poly2trellis (3, [7 5]), 5, "trunc", "soft")
+%!error <multiple of 2> vitdec ([0 0 0], poly2trellis (3, [7 5]), 5, "trunc", "hard")
+%!error <binary> vitdec ([0 2], poly2trellis (3, [7 5]), 5, "trunc", "hard")
+
+%!test
+%! t = poly2trellis (7, [171 133]);
+%! msg = [randi([0 1], 1, 200) zeros(1, 6)];
+%! code = convenc (msg, t);
+%! code([5 50 120 300]) = 1 - code([5 50 120 300]);
+%! assert (vitdec (code, t, 30, "trunc", "hard"), msg)
+%! assert (vitdec (code', t, 30, "term", "hard"), msg')
+%! assert (vitdec (7 * code, t, 30, "term", "soft", 3), msg)
+%! rx = 1 - 2 * code;
+%! rx([5 50 120 300]) *= 0.1;
+%! assert (vitdec (rx + 0.2 * cos (1:numel (rx)), t, 30, "term", "unquant"),
+%!         msg)
+%! dec = vitdec (code, t, 30, "cont", "hard");
+%! assert (dec, [zeros(1, 30) msg(1:end-30)])
+
+%!test
+%! ## Codes of several input bits are decoded on their predecessors
+%! t = poly2trellis ([5 4], [23 35 0; 0 5 13]);
+%! msg = randi ([0 1], 1, 300);
+%! code = convenc (msg, t);
+%! code(10) = 1 - code(10);
+%! assert (vitdec (code, t, 34, "trunc", "hard"), msg)
+%! assert (vitdec (code, t, 34, "cont", "hard"), [zeros(1, 68) msg(1:end-68)])
+
+%!test
+%! ## Punctured bits are decoded as erasures
+%! t = poly2trellis (7, [171 133]);
+%! p = [1 1 0 1 1 0];
+%! msg = [randi([0 1], 1, 600) zeros(1, 6)];
+%! code = convenc (msg, t, p);
+%! code(100) = 1 - code(100);
+%! assert (vitdec (code, t, 40, "term", "hard", p), msg)
+%! assert (vitdec (7 * code, t, 40, "trunc", "soft", 3, p), msg)
+%! assert (vitdec (1 - 2 * code, t, 40, "term", "unquant", p), msg)
+%! assert (vitdec (code, t, 40, "cont", "hard", p),
+%!         [zeros(1, 40) msg(1:end-40)])
+
+%!test
+%! ## Codes of any length, that need not fill the puncturing pattern
+%! t = poly2trellis (7, [171 133]);
+%! p = [1 1 0 1 1 0];
+%! for len = 600:605
+%!   msg = [randi([0 1], 1, len-6) zeros(1, 6)];
+%!   code = convenc (msg, t, p);
+%!   assert (vitdec (code, t, 40, "term", "hard", p), msg)
+%!   assert (vitdec (1 - 2 * code, t, 40, "trunc", "unquant", p), msg)
+%! endfor
+%! t = poly2trellis ([5 4], [23 35 0; 0 5 13]);
+%! p = [1 1 1 0 1 1 0 1 1];
+%! for len = 998:2:1004
+%!   msg = [randi([0 1], 1, len-8) zeros(1, 8)];
+%!   code = convenc (msg, t, p);
+%!   assert (vitdec (code, t, 34, "term", "hard", p), msg)
+%! endfor
+
+%!error <PUNCT> vitdec ([0 0], poly2trellis (3, [7 5]), 5, "trunc", "hard", [0 0])
+%!error <PUNCT> vitdec ([0 0 0], poly2trellis (3, [7 5]), 5, "trunc", "hard", [1 0])
+*/
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/
@@ -0,0 +1,327 @@
+//Copyright (C) 2026 The Octave Forge communications package developers
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License as
+// published by the Free Software Foundation; either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see
+// <http://www.gnu.org/licenses/>.
+//
+// In addition to the terms of the GPL, you are permitted to link this
+// program with any Open Source program, as defined by the Open Source
+// Initiative (www.opensource.org)
+
+#if !defined (octave_viterbi_h)
+#define octave_viterbi_h 1
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include <octave/oct.h>
+#include <octave/uint64NDArray.h>
+
+#include "bitpack.h"
+#include "trellis.h"
+
+// The Viterbi algorithm on the trellis t, with path metrics of type T,
+// int16_t, int32_t or float. The branch metric of an output symbol is
+// the sum over its bits of the cost of the bit being 0 or 1, given for
+// each step as the 2*n values cost[2*b] and cost[2*b+1] of the bit b,
+// sent b-th. An erased bit has equal costs.
+//
+// The metrics are kept relative to the smallest one of the previous
+// step, and saturated at cap, so that the integer metrics can not
+// overflow. With a cost of at most maxcost per bit, cap is larger than
+// any difference between the metrics of the paths from the start state
+// after the nu steps needed to reach every state, so that a path from
+// any other state never survives.
+//
+// The decisions of each step are kept in the survivor memory, of nslots
+// steps used circularly, one bit per state for a butterfly trellis and
+// one byte per state otherwise. The butterfly steps are loops over the
+// states without any dependencies between iterations, which the
+// compiler vectorizes
+template <typename T>
+class viterbi
+{
+public:
+
+  viterbi (const conv_trellis& _t, double maxcost, octave_idx_type _nslots)
+    : t (_t), S (_t.nstates), H (_t.nstates / 2), nslots (_nslots),
+      pm (_t.nstates), npm (_t.nstates), dec (_t.nstates), renorm (0),
+      nsteps (0)
+  {
+    int nu = 0;
+    while ((1 << nu) < S)
+      nu++;
+
+    if (std::numeric_limits<T>::is_integer)
+      cap = (T)std::min ((2.*nu + 3) * t.n * maxcost + 1,
+                         (double)(std::numeric_limits<T>::max () / 2));
+    else
+      cap = std::numeric_limits<T>::infinity ();
+
+    wps = (t.butterfly ? BITPACK_WORDS (S) : (S + 7) / 8);
+    surv.assign ((size_t)nslots * wps, 0);
+
+    if (t.butterfly)
+      {
+        // The bits of the output symbols from the even and odd
+        // predecessors to the lower and upper halves of the states
+        mask.resize ((size_t)4 * t.n * H);
+        for (int c = 0; c < 4; c++)
+          for (int b = 0; b < t.n; b++)
+            for (int j = 0; j < H; j++)
+              {
+                int p = 2*j + (c & 1);
+                int o = t.bf_out[(c >> 1)*S + p];
+                mask[((size_t)c*t.n + b)*H + j] = (o >> (t.n - b - 1)) & 1;
+              }
+        bm.resize ((size_t)4 * H);
+      }
+    else
+      bm.resize (t.noutputs);
+  }
+
+  // Start the paths in the state s0, or in every state if s0 < 0
+  void start (int s0)
+  {
+    std::fill (pm.begin (), pm.end (), (s0 < 0 ? 0 : cap));
+    if (s0 >= 0)
+      pm[s0] = 0;
+    renorm = 0;
+    nsteps = 0;
+  }
+
+  // The step nsteps, whose decisions are stored in the slot nsteps%nslots
+  void step (const T *cost)
+  {
+    T base = -renorm;
+    for (int b = 0; b < t.n; b++)
+      base += cost[2*b];
+
+    bitpack_word *sv = &surv[(size_t)(nsteps % nslots) * wps];
+    T mn = cap;
+
+    if (t.butterfly)
+      {
+        const int h = H;
+        const int nb = t.n;
+        const T c = cap;
+
+        for (int q = 0; q < 4; q++)
+          {
+            T *bq = &bm[(size_t)q*h];
+            for (int j = 0; j < h; j++)
+              bq[j] = base;
+            for (int b = 0; b < nb; b++)
+              {
+                T d = cost[2*b+1] - cost[2*b];
+                const T *mk = &mask[((size_t)q*nb + b)*h];
+                for (int j = 0; j < h; j++)
+                  bq[j] += mk[j] * d;
+              }
+          }
+
+        mn = butterflies (h, c, &pm[0], &bm[0], &bm[h], &bm[2*h], &bm[3*h],
+                          &npm[0], &npm[h], &dec[0], &dec[h]);
+
+        // Eight decisions of one byte each are gathered into a byte by
+        // a multiplication, bit i coming from byte i
+        const unsigned char *dc = &dec[0];
+        for (int w = 0; w < wps; w++)
+          {
+            bitpack_word v = 0;
+            for (int i = 0; (i < 8) && (64*w + 8*i < S); i++)
+              {
+                const unsigned char *p = dc + 64*w + 8*i;
+                int nb = std::min (8, S - 64*w - 8*i);
+                bitpack_word x = 0;
+                for (int l = 0; l < nb; l++)
+                  x |= (bitpack_word)p[l] << (8*l);
+                v |= ((x * 0x0102040810204080ULL) >> 56) << (8*i);
+              }
+            sv[w] = v;
+          }
+      }
+    else
+      {
+        for (int o = 0; o < t.noutputs; o++)
+          {
+            T x = base;
+            for (int b = 0; b < t.n; b++)
+              if ((o >> (t.n - b - 1)) & 1)
+                x += cost[2*b+1] - cost[2*b];
+            bm[o] = x;
+          }
+
+        unsigned char *d = reinterpret_cast<unsigned char *> (sv);
+        int np = t.npred;
+        for (int j = 0; j < S; j++)
+          {
+            T best = cap;
+            int bi = 0;
+            for (int i = 0; i < np; i++)
+              {
+                int p = t.pred[j*np+i];
+                if (p >= 0)
+                  {
+                    T x = pm[p] + bm[t.pred_out[j*np+i]];
+                    if (x < best)
+                      {
+                        best = x;
+                        bi = i;
+                      }
+                  }
+              }
+            npm[j] = best;
+            d[j] = bi;
+            mn = std::min (mn, best);
+          }
+      }
+
+    pm.swap (npm);
+    renorm = mn;
+    nsteps++;
+  }
+
+  // The state with the smallest metric, the first one on ties
+  int best_state (void) const
+  {
+    return (std::min_element (pm.begin (), pm.end ()) - pm.begin ());
+  }
+
+  // Trace back count steps from the state j after the step u, which must
+  // still be in the survivor memory, calling emit (v, sym) with the input
+  // symbol sym of each step v from u down. Returns the state before the
+  // last step traced
+  template <typename F>
+  int traceback (int j, octave_idx_type u, octave_idx_type count, F emit) const
+  {
+    octave_idx_type slot = u % nslots;
+    for (octave_idx_type c = 0; c < count; c++, u--)
+      {
+        const bitpack_word *sv = &surv[(size_t)slot * wps];
+        int p, sym;
+        if (t.butterfly)
+          {
+            int d = bitpack_get (sv, j);
+            p = 2*(j % H) + d;
+            sym = t.bf_in[(j >= H ? S : 0) + p];
+          }
+        else
+          {
+            int i = reinterpret_cast<const unsigned char *> (sv)[j];
+            p = std::max (t.pred[j*t.npred+i], 0);
+            sym = t.pred_in[j*t.npred+i];
+          }
+        emit (u, sym);
+        j = p;
+        slot = (slot > 0 ? slot - 1 : nslots - 1);
+      }
+    return j;
+  }
+
+  octave_idx_type steps (void) const { return nsteps; }
+
+  // The path metrics, the survivor memory and the step count, that
+  // load restores to continue decoding from the same point. The metrics
+  // are saved as doubles, which hold the values of any T exactly
+  void save (ColumnVector& metrics, uint64NDArray& survivors,
+             double& norm, double& steps) const
+  {
+    metrics = ColumnVector (S);
+    for (int j = 0; j < S; j++)
+      metrics(j) = pm[j];
+    survivors = uint64NDArray (dim_vector (wps, nslots));
+    std::copy (surv.begin (), surv.end (),
+               reinterpret_cast<bitpack_word *> (survivors.fortran_vec ()));
+    norm = renorm;
+    steps = nsteps;
+  }
+
+  // Restore the state saved by a decoder of the same trellis, metric type
+  // and survivor memory. Returns false if the sizes differ
+  bool load (const ColumnVector& metrics, const uint64NDArray& survivors,
+             double norm, double steps)
+  {
+    if (metrics.numel () != S || survivors.numel () != (octave_idx_type)surv.size ()
+        || steps < 0)
+      return false;
+
+    for (int j = 0; j < S; j++)
+      pm[j] = (T)std::max (0., std::min ((double)cap, metrics(j)));
+    const bitpack_word *sv =
+      reinterpret_cast<const bitpack_word *> (survivors.data ());
+    std::copy (sv, sv + surv.size (), surv.begin ());
+    renorm = (T)std::max (0., std::min ((double)cap, norm));
+    nsteps = (octave_idx_type)steps;
+    return true;
+  }
+
+private:
+
+  // The add-compare-select of the butterflies from the states 2*j and
+  // 2*j+1 to the states j and j+h, with the branch metrics b0 to b3 of
+  // the four transitions. Returns the smallest new metric. The arrays
+  // are distinct, so that the loop has no dependencies to check
+  static T butterflies (int h, T c, const T * __restrict a,
+                        const T * __restrict b0, const T * __restrict b1,
+                        const T * __restrict b2, const T * __restrict b3,
+                        T * __restrict lo, T * __restrict hi,
+                        unsigned char * __restrict dlo,
+                        unsigned char * __restrict dhi)
+  {
+    T mn = c;
+    for (int j = 0; j < h; j++)
+      {
+        T m0 = a[2*j] + b0[j];
+        T m1 = a[2*j+1] + b1[j];
+        T m2 = a[2*j] + b2[j];
+        T m3 = a[2*j+1] + b3[j];
+        dlo[j] = (m1 < m0);
+        dhi[j] = (m3 < m2);
+        T x = (m1 < m0 ? m1 : m0);
+        T y = (m3 < m2 ? m3 : m2);
+        x = (x < c ? x : c);
+        y = (y < c ? y : c);
+        lo[j] = x;
+        hi[j] = y;
+        T z = (x < y ? x : y);
+        mn = (z < mn ? z : mn);
+      }
+    return mn;
+  }
+
+  const conv_trellis& t;
+  int S;
+  int H;
+  int wps;
+  octave_idx_type nslots;
+  T cap;
+
+  std::vector<T> pm;
+  std::vector<T> npm;
+  std::vector<T> mask;
+  std::vector<T> bm;
+  std::vector<unsigned char> dec;
+  std::vector<bitpack_word> surv;
+  T renorm;
+  octave_idx_type nsteps;
+};
+
+#endif
+
+/*
+;;; Local Variables: ***
+;;; mode: C++ ***
+;;; End: ***
+*/